@@ -0,0 +1,83 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "glplatform.h"
+#include "glcore_dispatch.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+//
+// Compares the cost of calling OpenGL through the process wide function
+// pointers and through the current context's dispatch table. The call used,
+// glUniform1f() on location -1, is ignored by the driver so the measured time
+// is dominated by the call itself.
+//
+
+#define CALLS 10000000
+
+static double now()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static double time_global()
+{
+	double start = now();
+	for (int i = 0; i < CALLS; i++)
+		glUniform1f(-1, (float)i);
+	return now() - start;
+}
+
+static double time_dispatch()
+{
+	double start = now();
+	for (int i = 0; i < CALLS; i++)
+		glplatform_dispatch_glUniform1f(-1, (float)i);
+	return now() - start;
+}
+
+int main()
+{
+	struct glplatform_win_callbacks cb;
+	memset(&cb, 0, sizeof(cb));
+
+	if (!glplatform_init()) {
+		fprintf(stderr, "Failed to initialize GL window manager\n");
+		exit(-1);
+	}
+
+	struct glplatform_win *win = glplatform_create_window("dispatch benchmark", &cb, NULL, 256, 256);
+	if (!win) {
+		fprintf(stderr, "Failed to create OpenGL window\n");
+		exit(-1);
+	}
+
+	glplatform_gl_context_t ctx = glplatform_create_context(win, 3, 3);
+	if (!ctx) {
+		fprintf(stderr, "Failed to create OpenGL context\n");
+		exit(-1);
+	}
+	glplatform_make_current(win, ctx);
+	if (!glplatform_glcore_init_context(3, 3)) {
+		fprintf(stderr, "Failed to initialize OpenGL bindings\n");
+		exit(-1);
+	}
+
+	//Warm up both paths before measuring
+	time_global();
+	time_dispatch();
+
+	double global = time_global();
+	double dispatch = time_dispatch();
+	printf("global pointers: %6.2f ns/call\n", global * 1e9 / CALLS);
+	printf("dispatch table : %6.2f ns/call\n", dispatch * 1e9 / CALLS);
+
+	glplatform_destroy_context(ctx);
+	glplatform_destroy_window(win);
+	glplatform_shutdown();
+	return 0;
+}
@@ -0,0 +1,675 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "glplatform.h"
+
+#define GLPLATFORM_GL_VERSION 45
+#define GLPLATFORM_GL_ENABLE_ALL
+#include "glcore_entry_points.h"
+#include "glcore.h"
+#include "capture_format.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+//
+// Replays a trace written by glplatform_capture_begin() and reports the CPU
+// time spent issuing each frame's calls and the time until the GPU finished
+// them. The trace is rendered to a hidden window of the captured size. The
+// replay creates no OpenGL objects of its own so the names recorded in the
+// trace stay valid, frames are instead timed with glFinish() and GL_TIMESTAMP.
+//
+// usage: glreplay trace
+//
+
+#define MAX_MAPPINGS 32
+
+struct sync_entry {
+	uint64_t captured;
+	GLsync sync;
+};
+
+struct mapping {
+	GLuint buffer;
+	uint8_t *ptr;
+	uint64_t offset;
+	uint64_t length;
+};
+
+struct frame_times {
+	double cpu;
+	double total;
+	double gpu;
+};
+
+static const char *g_names[] = {
+#define GLPLATFORM_GL_FUNC(ret, name, params, args) \
+	#name,
+#define GLPLATFORM_GL_VOID_FUNC(name, params, args) \
+	#name,
+#include "glcore_entry_points.h"
+};
+
+static const char *g_sigs[] = {
+#define GLPLATFORM_GL_SIGNATURE(ret, name, params, args, sig, store, load) \
+	sig,
+#define GLPLATFORM_GL_VOID_SIGNATURE(name, params, args, sig, store, load) \
+	sig,
+#include "glcore_entry_points.h"
+};
+
+static const uint8_t *g_pos;
+static const uint8_t *g_end;
+static bool g_truncated;
+
+static void *g_arg_mem[CAPTURE_MAX_ARGS];
+static size_t g_arg_mem_size[CAPTURE_MAX_ARGS];
+
+static struct sync_entry *g_syncs;
+static int g_num_syncs;
+static struct mapping g_mappings[MAX_MAPPINGS];
+
+static bool g_warned[CAPTURE_NUM_ENTRY_POINTS];
+
+static double now()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static double gpu_now()
+{
+	GLint64 t = 0;
+	glGetInteger64v(GL_TIMESTAMP, &t);
+	return t * 1e-9;
+}
+
+static const void *get(size_t size)
+{
+	const void *ret = g_pos;
+	if ((size_t)(g_end - g_pos) < size) {
+		g_truncated = true;
+		g_pos = g_end;
+		return NULL;
+	}
+	g_pos += size;
+	return ret;
+}
+
+static uint8_t get_u8()
+{
+	const uint8_t *p = get(1);
+	return p ? *p : 0;
+}
+
+static uint16_t get_u16()
+{
+	uint16_t v = 0;
+	const void *p = get(sizeof(v));
+	if (p)
+		memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+static uint32_t get_u32()
+{
+	uint32_t v = 0;
+	const void *p = get(sizeof(v));
+	if (p)
+		memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+static uint64_t get_u64()
+{
+	uint64_t v = 0;
+	const void *p = get(sizeof(v));
+	if (p)
+		memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+static float get_f32()
+{
+	float v = 0;
+	const void *p = get(sizeof(v));
+	if (p)
+		memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+static double get_f64()
+{
+	double v = 0;
+	const void *p = get(sizeof(v));
+	if (p)
+		memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+//
+// Per-argument scratch memory. Data is copied out of the trace so that
+// arrays are suitably aligned.
+//
+static void *arg_mem(int j, size_t size)
+{
+	if (size > g_arg_mem_size[j]) {
+		void *mem = realloc(g_arg_mem[j], size);
+		if (!mem) {
+			fprintf(stderr, "Out of memory\n");
+			exit(-1);
+		}
+		g_arg_mem[j] = mem;
+		g_arg_mem_size[j] = size;
+	}
+	return g_arg_mem[j];
+}
+
+static GLsync find_sync(uint64_t captured)
+{
+	int i;
+	for (i = 0; i < g_num_syncs; i++) {
+		if (g_syncs[i].captured == captured)
+			return g_syncs[i].sync;
+	}
+	return NULL;
+}
+
+static void add_sync(uint64_t captured, GLsync sync)
+{
+	struct sync_entry *syncs = realloc(g_syncs, sizeof(struct sync_entry) * (g_num_syncs + 1));
+	if (!syncs)
+		return;
+	g_syncs = syncs;
+	g_syncs[g_num_syncs].captured = captured;
+	g_syncs[g_num_syncs].sync = sync;
+	g_num_syncs++;
+}
+
+static void remove_sync(uint64_t captured)
+{
+	int i;
+	for (i = 0; i < g_num_syncs; i++) {
+		if (g_syncs[i].captured == captured) {
+			g_syncs[i] = g_syncs[--g_num_syncs];
+			return;
+		}
+	}
+}
+
+static GLuint bound_buffer(GLenum target)
+{
+	GLint buffer = 0;
+	GLenum binding = capture_buffer_binding(target);
+	if (binding)
+		glGetIntegerv(binding, &buffer);
+	return buffer;
+}
+
+static struct mapping *find_mapping(GLuint buffer)
+{
+	int i;
+	for (i = 0; i < MAX_MAPPINGS; i++) {
+		if (g_mappings[i].ptr && g_mappings[i].buffer == buffer)
+			return g_mappings + i;
+	}
+	return NULL;
+}
+
+//
+// Track mappings made by the trace so recorded writes can be applied to them
+//
+static void track_mapping(int index, const union capture_arg *argv, void *ptr)
+{
+	struct mapping *m;
+	GLint64 size = 0;
+	int i;
+	if (!ptr)
+		return;
+	for (i = 0; i < MAX_MAPPINGS && g_mappings[i].ptr; i++);
+	if (i == MAX_MAPPINGS)
+		return;
+	m = g_mappings + i;
+	m->ptr = (uint8_t *)ptr;
+	switch (index) {
+	case CAPTURE_glMapBuffer:
+		m->buffer = bound_buffer(argv[0].i);
+		glGetBufferParameteri64v(argv[0].i, GL_BUFFER_SIZE, &size);
+		m->offset = 0;
+		m->length = size;
+		break;
+	case CAPTURE_glMapNamedBuffer:
+		m->buffer = argv[0].i;
+		glGetNamedBufferParameteri64v(argv[0].i, GL_BUFFER_SIZE, &size);
+		m->offset = 0;
+		m->length = size;
+		break;
+	default:
+		m->buffer = (index == CAPTURE_glMapBufferRange) ? bound_buffer(argv[0].i) : argv[0].i;
+		m->offset = argv[1].l;
+		m->length = argv[2].l;
+		break;
+	}
+}
+
+static void buffer_write()
+{
+	GLuint buffer = get_u32();
+	uint64_t offset = get_u64();
+	uint32_t size = get_u32();
+	const void *data = get(size);
+	struct mapping *m = find_mapping(buffer);
+	if (!data)
+		return;
+	if (m && offset >= m->offset && offset + size <= m->offset + m->length) {
+		memcpy(m->ptr + (offset - m->offset), data, size);
+	} else if (!m) {
+		GLint prev = 0;
+		glGetIntegerv(GL_COPY_WRITE_BUFFER_BINDING, &prev);
+		glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+		glBufferSubData(GL_COPY_WRITE_BUFFER, offset, size, data);
+		glBindBuffer(GL_COPY_WRITE_BUFFER, prev);
+	}
+}
+
+static void get_strings(int j, union capture_arg *argv)
+{
+	uint32_t count = get_u32();
+	const uint8_t *start = g_pos;
+	size_t total = count * sizeof(char *);
+	uint32_t i;
+
+	for (i = 0; i < count; i++) {
+		uint32_t length = get_u32();
+		get(length);
+		total += length + 1;
+	}
+	char **strings = arg_mem(j, total);
+	char *chars = (char *)(strings + count);
+	g_pos = start;
+	for (i = 0; i < count; i++) {
+		uint32_t length = get_u32();
+		const void *p = get(length);
+		strings[i] = chars;
+		if (p)
+			memcpy(chars, p, length);
+		chars[length] = 0;
+		chars += length + 1;
+	}
+	argv[j].p = strings;
+}
+
+//
+// Decode the arguments of a call. Returns false if the call must not be
+// replayed because it writes to client memory of unknown size.
+//
+static bool get_args(int index, union capture_arg *argv)
+{
+	const char *sig = g_sigs[index] + 1;
+	bool replay = true;
+	int j;
+
+	for (j = 0; sig[j]; j++) {
+		switch (sig[j]) {
+		case 'i':
+		case 'n':
+			argv[j].i = get_u32();
+			break;
+		case 'l':
+			argv[j].l = get_u64();
+			break;
+		case 'f':
+			argv[j].f = get_f32();
+			break;
+		case 'd':
+			argv[j].d = get_f64();
+			break;
+		case 's':
+			argv[j].s = find_sync(get_u64());
+			break;
+		case 'x':
+		case 'X':
+			argv[j].x = NULL;
+			break;
+		default:
+			switch (get_u8()) {
+			case CAPTURE_POINTER_VALUE:
+				argv[j].p = (const void *)(uintptr_t)get_u64();
+				break;
+			case CAPTURE_POINTER_DATA: {
+				uint32_t size = get_u32();
+				const void *data = get(size);
+				void *mem = arg_mem(j, size ? size : 1);
+				if (data)
+					memcpy(mem, data, size);
+				argv[j].p = mem;
+				break;
+			}
+			case CAPTURE_POINTER_STRINGS:
+				get_strings(j, argv);
+				break;
+			case CAPTURE_POINTER_OUTPUT: {
+				uint32_t size = get_u32();
+				argv[j].o = arg_mem(j, size ? size : 1);
+				break;
+			}
+			default:
+				argv[j].o = NULL;
+				replay = false;
+				break;
+			}
+			break;
+		}
+	}
+	return replay;
+}
+
+//
+// Calls that refer to the window's framebuffer are redirected to the
+// replay window's back buffer, which is the default when rendering to it.
+//
+static void fix_framebuffer_args(int index, union capture_arg *argv)
+{
+	if (index == CAPTURE_glDrawBuffer || index == CAPTURE_glReadBuffer) {
+		switch (argv[0].i) {
+		case GL_FRONT:
+		case GL_FRONT_LEFT:
+		case GL_BACK_LEFT:
+			argv[0].i = GL_BACK;
+			break;
+		}
+	}
+}
+
+static void warn_once(int index, const char *reason)
+{
+	if (!g_warned[index]) {
+		fprintf(stderr, "Warning: %s: %s\n", g_names[index], reason);
+		g_warned[index] = true;
+	}
+}
+
+static void call(int index, union capture_arg *argv, bool replay, union capture_arg *result)
+{
+	memset(result, 0, sizeof(*result));
+	if (!replay) {
+		warn_once(index, "output of unknown size, not replayed");
+		return;
+	}
+	switch (index) {
+#define GLPLATFORM_GL_LOAD(n, field) (argv[n].field)
+#define GLPLATFORM_GL_SIGNATURE(ret, name, params, args, sig, store, load) \
+	case CAPTURE_##name: \
+		if (name) { \
+			ret r = name load; \
+			memcpy(result, &r, sizeof(r)); \
+		} else { \
+			warn_once(index, "not supported by this context"); \
+		} \
+		break;
+#define GLPLATFORM_GL_VOID_SIGNATURE(name, params, args, sig, store, load) \
+	case CAPTURE_##name: \
+		if (name) \
+			name load; \
+		else \
+			warn_once(index, "not supported by this context"); \
+		break;
+#include "glcore_entry_points.h"
+	}
+}
+
+//
+// Consume the recorded return value and any generated names, and update
+// the tables translating handles from the capture. Returns false if GL
+// generated different names than the capture, in which case the rest of the
+// trace would operate on the wrong objects.
+//
+static bool finish_call(int index, const union capture_arg *argv, const union capture_arg *result)
+{
+	const char *sig = g_sigs[index];
+	uint64_t captured = 0;
+
+	switch (sig[0]) {
+	case 'i':
+		get_u32();
+		break;
+	case 'l':
+	case 's':
+		captured = get_u64();
+		break;
+	}
+
+	if (capture_is_gen(g_names[index], sig + 1)) {
+		int n = strchr(sig + 1, 'n') - (sig + 1);
+		uint32_t count = argv[n].i;
+		const GLuint *names = argv[n + 1].o;
+		const void *p = get(count * sizeof(GLuint));
+		if (p && names && memcmp(p, names, count * sizeof(GLuint))) {
+			fprintf(stderr, "%s generated different names than the capture, was the "
+					"capture begun after objects were created?\n", g_names[index]);
+			return false;
+		}
+	}
+
+	switch (index) {
+	case CAPTURE_glFenceSync:
+		add_sync(captured, result->s);
+		break;
+	case CAPTURE_glDeleteSync: {
+		int i;
+		for (i = 0; i < g_num_syncs; i++) {
+			if (g_syncs[i].sync == argv[0].s) {
+				remove_sync(g_syncs[i].captured);
+				break;
+			}
+		}
+		break;
+	}
+	case CAPTURE_glMapBuffer:
+	case CAPTURE_glMapBufferRange:
+	case CAPTURE_glMapNamedBuffer:
+	case CAPTURE_glMapNamedBufferRange:
+		track_mapping(index, argv, result->o);
+		break;
+	}
+	return true;
+}
+
+static void unmap(int index, const union capture_arg *argv)
+{
+	GLuint buffer = (index == CAPTURE_glUnmapBuffer) ? bound_buffer(argv[0].i) : argv[0].i;
+	struct mapping *m = find_mapping(buffer);
+	if (m)
+		m->ptr = NULL;
+}
+
+static uint8_t *read_trace(const char *path, size_t *size)
+{
+	FILE *f = fopen(path, "rb");
+	uint8_t *data = NULL;
+	long length;
+	if (!f)
+		return NULL;
+	if (fseek(f, 0, SEEK_END) || (length = ftell(f)) < 0 || fseek(f, 0, SEEK_SET))
+		goto error0;
+	data = malloc(length ? length : 1);
+	if (!data)
+		goto error0;
+	if (fread(data, 1, length, f) != (size_t)length)
+		goto error1;
+	fclose(f);
+	*size = length;
+	return data;
+error1:
+	free(data);
+	data = NULL;
+error0:
+	fclose(f);
+	return NULL;
+}
+
+static void report(const struct frame_times *frames, int num_frames)
+{
+	struct frame_times sum = {0, 0, 0};
+	struct frame_times min = frames[0];
+	struct frame_times max = frames[0];
+	int i;
+
+	printf("%6s %12s %12s %12s\n", "frame", "cpu (ms)", "total (ms)", "gpu (ms)");
+	for (i = 0; i < num_frames; i++) {
+		const struct frame_times *t = frames + i;
+		printf("%6d %12.3f %12.3f %12.3f\n", i, t->cpu * 1e3, t->total * 1e3, t->gpu * 1e3);
+		sum.cpu += t->cpu;
+		sum.total += t->total;
+		sum.gpu += t->gpu;
+		if (t->cpu < min.cpu) min.cpu = t->cpu;
+		if (t->total < min.total) min.total = t->total;
+		if (t->gpu < min.gpu) min.gpu = t->gpu;
+		if (t->cpu > max.cpu) max.cpu = t->cpu;
+		if (t->total > max.total) max.total = t->total;
+		if (t->gpu > max.gpu) max.gpu = t->gpu;
+	}
+	printf("%6s %12.3f %12.3f %12.3f\n", "avg",
+		sum.cpu * 1e3 / num_frames, sum.total * 1e3 / num_frames, sum.gpu * 1e3 / num_frames);
+	printf("%6s %12.3f %12.3f %12.3f\n", "min", min.cpu * 1e3, min.total * 1e3, min.gpu * 1e3);
+	printf("%6s %12.3f %12.3f %12.3f\n", "max", max.cpu * 1e3, max.total * 1e3, max.gpu * 1e3);
+}
+
+static bool replay(struct frame_times **frames_out, int *num_frames_out)
+{
+	struct frame_times *frames = NULL;
+	int num_frames = 0;
+	union capture_arg argv[CAPTURE_MAX_ARGS];
+	union capture_arg result;
+
+	glFinish();
+	double cpu_start = now();
+	double gpu_start = gpu_now();
+	while (g_pos < g_end && !g_truncated) {
+		uint16_t op = get_u16();
+		if (op == CAPTURE_OP_FRAME) {
+			double cpu = now() - cpu_start;
+			glFinish();
+			double total = now() - cpu_start;
+			double gpu = gpu_now() - gpu_start;
+			struct frame_times *f = realloc(frames, sizeof(struct frame_times) * (num_frames + 1));
+			if (!f)
+				break;
+			frames = f;
+			frames[num_frames].cpu = cpu;
+			frames[num_frames].total = total;
+			frames[num_frames].gpu = gpu;
+			num_frames++;
+			cpu_start = now();
+			gpu_start = gpu_now();
+		} else if (op == CAPTURE_OP_BUFFER_WRITE) {
+			buffer_write();
+		} else if (op < CAPTURE_NUM_ENTRY_POINTS) {
+			bool replay = get_args(op, argv);
+			if (g_truncated)
+				break;
+			fix_framebuffer_args(op, argv);
+			if (op == CAPTURE_glUnmapBuffer || op == CAPTURE_glUnmapNamedBuffer)
+				unmap(op, argv);
+			call(op, argv, replay, &result);
+			if (!finish_call(op, argv, &result)) {
+				free(frames);
+				return false;
+			}
+		} else {
+			fprintf(stderr, "Invalid op %u in trace\n", op);
+			free(frames);
+			return false;
+		}
+	}
+	if (g_truncated)
+		fprintf(stderr, "Warning: trace is truncated\n");
+	*frames_out = frames;
+	*num_frames_out = num_frames;
+	return true;
+}
+
+int main(int argc, char **argv)
+{
+	struct glplatform_win_callbacks cb;
+	struct glplatform_fbformat fbformat = {
+		.color_bits = 24,
+		.alpha_bits = 8,
+		.stencil_bits = 8,
+		.depth_bits = 24,
+		.accum_bits = 0
+	};
+	struct capture_header header;
+	struct frame_times *frames;
+	int num_frames;
+	size_t size;
+
+	if (argc != 2) {
+		fprintf(stderr, "usage: %s trace\n", argv[0]);
+		exit(-1);
+	}
+
+	uint8_t *trace = read_trace(argv[1], &size);
+	if (!trace) {
+		fprintf(stderr, "Failed to read %s\n", argv[1]);
+		exit(-1);
+	}
+	if (size < sizeof(header)) {
+		fprintf(stderr, "%s is not a trace\n", argv[1]);
+		exit(-1);
+	}
+	memcpy(&header, trace, sizeof(header));
+	if (memcmp(header.magic, CAPTURE_MAGIC, sizeof(header.magic)) ||
+			header.version != CAPTURE_VERSION) {
+		fprintf(stderr, "%s is not a trace or has an unsupported version\n", argv[1]);
+		exit(-1);
+	}
+	if (header.num_entry_points != CAPTURE_NUM_ENTRY_POINTS) {
+		fprintf(stderr, "%s was captured with different OpenGL bindings\n", argv[1]);
+		exit(-1);
+	}
+	g_pos = trace + sizeof(header);
+	g_end = trace + size;
+
+	memset(&cb, 0, sizeof(cb));
+	if (!glplatform_init()) {
+		fprintf(stderr, "Failed to initialize GL window manager\n");
+		exit(-1);
+	}
+
+	struct glplatform_win *win = glplatform_create_window("glreplay", &cb, &fbformat,
+			header.width ? header.width : 256,
+			header.height ? header.height : 256);
+	if (!win) {
+		fprintf(stderr, "Failed to create OpenGL window\n");
+		exit(-1);
+	}
+
+	glplatform_gl_context_t ctx = glplatform_create_context(win, 4, 5);
+	if (!ctx)
+		ctx = glplatform_create_context(win, 3, 3);
+	if (!ctx) {
+		fprintf(stderr, "Failed to create OpenGL context\n");
+		exit(-1);
+	}
+	glplatform_make_current(win, ctx);
+	if (!glplatform_glcore_init(3, 3)) {
+		fprintf(stderr, "Failed to initialize OpenGL bindings\n");
+		exit(-1);
+	}
+
+	if (!replay(&frames, &num_frames))
+		exit(-1);
+	if (num_frames)
+		report(frames, num_frames);
+	else
+		fprintf(stderr, "No frames in trace\n");
+
+	free(frames);
+	free(trace);
+	glplatform_destroy_window(win);
+	glplatform_shutdown();
+	return 0;
+}
@@ -0,0 +1,145 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "glplatform.h"
+#include "glcore.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+//
+// Measures the CPU cost of issuing draw calls in a regular context and
+// in a context created with GLPLATFORM_CONTEXT_NO_ERROR.
+//
+
+#define DRAW_CALLS 200000
+
+static double now()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static GLuint compile_program()
+{
+	const char *vertex_shader_text =
+		"#version 330\n"
+		"uniform vec4 offset;\n"
+		"void main()\n"
+		"{\n"
+			"gl_Position = offset;\n"
+		"}\n";
+	const char *fragment_shader_text =
+		"#version 330\n"
+		"uniform vec4 color;\n"
+		"out vec4 frag_color;\n"
+		"void main()\n"
+		"{\n"
+			"frag_color = color;\n"
+		"}\n";
+	GLuint vs = glCreateShader(GL_VERTEX_SHADER);
+	glShaderSource(vs, 1, &vertex_shader_text, NULL);
+	glCompileShader(vs);
+	GLuint fs = glCreateShader(GL_FRAGMENT_SHADER);
+	glShaderSource(fs, 1, &fragment_shader_text, NULL);
+	glCompileShader(fs);
+	GLuint program = glCreateProgram();
+	glAttachShader(program, vs);
+	glAttachShader(program, fs);
+	glLinkProgram(program);
+	glDeleteShader(vs);
+	glDeleteShader(fs);
+	GLint success;
+	glGetProgramiv(program, GL_LINK_STATUS, &success);
+	if (!success) {
+		glDeleteProgram(program);
+		return 0;
+	}
+	return program;
+}
+
+static bool run(struct glplatform_win *win, uint32_t flags)
+{
+	struct glplatform_context_attribs attribs = {
+		.maj_ver = 3,
+		.min_ver = 3,
+		.flags = flags
+	};
+	glplatform_gl_context_t ctx = glplatform_create_context_attribs(win, &attribs);
+	if (!ctx) {
+		fprintf(stderr, "Failed to create OpenGL context\n");
+		return false;
+	}
+	glplatform_make_current(win, ctx);
+	if (!glplatform_glcore_init(3, 3)) {
+		fprintf(stderr, "Failed to initialize OpenGL bindings\n");
+		goto error0;
+	}
+
+	GLuint program = compile_program();
+	if (!program) {
+		fprintf(stderr, "Failed to build program\n");
+		goto error0;
+	}
+	GLuint vao;
+	glGenVertexArrays(1, &vao);
+	glBindVertexArray(vao);
+	glUseProgram(program);
+	GLint offset_loc = glGetUniformLocation(program, "offset");
+	GLint color_loc = glGetUniformLocation(program, "color");
+	glViewport(0, 0, win->width, win->height);
+	glFinish();
+
+	double start = now();
+	for (int i = 0; i < DRAW_CALLS; i++) {
+		glUniform4f(offset_loc, (i & 255) / 128.0f - 1.0f, 0, 0, 1);
+		glUniform4f(color_loc, 1, 1, 1, 1);
+		glDrawArrays(GL_POINTS, 0, 1);
+	}
+	double submit = now() - start;
+	glFinish();
+	double total = now() - start;
+
+	printf("%-10s: %7.1f ns/draw submit, %7.1f ns/draw including glFinish()%s\n",
+		(flags & GLPLATFORM_CONTEXT_NO_ERROR) ? "no-error" : "default",
+		submit * 1e9 / DRAW_CALLS,
+		total * 1e9 / DRAW_CALLS,
+		(flags & GLPLATFORM_CONTEXT_NO_ERROR) &&
+			!(glplatform_get_context_flags(ctx) & GLPLATFORM_CONTEXT_NO_ERROR) ?
+			" (no-error unavailable)" : "");
+
+	glDeleteVertexArrays(1, &vao);
+	glDeleteProgram(program);
+	//Each measurement starts without the previous context around
+	glplatform_destroy_context(ctx);
+	return true;
+error0:
+	glplatform_destroy_context(ctx);
+	return false;
+}
+
+int main()
+{
+	struct glplatform_win_callbacks cb;
+	memset(&cb, 0, sizeof(cb));
+
+	if (!glplatform_init()) {
+		fprintf(stderr, "Failed to initialize GL window manager\n");
+		exit(-1);
+	}
+
+	struct glplatform_win *win = glplatform_create_window("no-error benchmark", &cb, NULL, 256, 256);
+	if (!win) {
+		fprintf(stderr, "Failed to create OpenGL window\n");
+		exit(-1);
+	}
+
+	if (!run(win, 0) || !run(win, GLPLATFORM_CONTEXT_NO_ERROR))
+		exit(-1);
+
+	glplatform_destroy_window(win);
+	glplatform_shutdown();
+	return 0;
+}
@@ -0,0 +1,121 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "glplatform.h"
+#include "glcore.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+//
+// Measures the time to bind the OpenGL entry points and render a first frame
+// with glplatform_glcore_init() and glplatform_glcore_init_lazy(). Pass
+// "eager" or "lazy" to measure one mode in a fresh process, otherwise both
+// are measured in turn and the second run benefits from a warm driver.
+//
+
+static double now()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static GLuint compile_program()
+{
+	const char *vertex_shader_text =
+		"#version 330\n"
+		"void main()\n"
+		"{\n"
+			"gl_Position = vec4(0, 0, 0, 1);\n"
+		"}\n";
+	const char *fragment_shader_text =
+		"#version 330\n"
+		"uniform vec4 color;\n"
+		"out vec4 frag_color;\n"
+		"void main()\n"
+		"{\n"
+			"frag_color = color;\n"
+		"}\n";
+	GLuint vs = glCreateShader(GL_VERTEX_SHADER);
+	glShaderSource(vs, 1, &vertex_shader_text, NULL);
+	glCompileShader(vs);
+	GLuint fs = glCreateShader(GL_FRAGMENT_SHADER);
+	glShaderSource(fs, 1, &fragment_shader_text, NULL);
+	glCompileShader(fs);
+	GLuint program = glCreateProgram();
+	glAttachShader(program, vs);
+	glAttachShader(program, fs);
+	glLinkProgram(program);
+	glDeleteShader(vs);
+	glDeleteShader(fs);
+	return program;
+}
+
+static bool run(struct glplatform_win *win, bool lazy)
+{
+	glplatform_gl_context_t ctx = glplatform_create_context(win, 3, 3);
+	if (!ctx) {
+		fprintf(stderr, "Failed to create OpenGL context\n");
+		return false;
+	}
+	glplatform_make_current(win, ctx);
+
+	double start = now();
+	bool success = lazy ? glplatform_glcore_init_lazy(3, 3) : glplatform_glcore_init(3, 3);
+	double init = now() - start;
+	if (!success) {
+		fprintf(stderr, "Failed to initialize OpenGL bindings\n");
+		return false;
+	}
+
+	GLuint program = compile_program();
+	GLuint vao;
+	glGenVertexArrays(1, &vao);
+	glBindVertexArray(vao);
+	glUseProgram(program);
+	glUniform4f(glGetUniformLocation(program, "color"), 1, 1, 1, 1);
+	glViewport(0, 0, win->width, win->height);
+	glClearColor(0, 0, 0, 1);
+	glClear(GL_COLOR_BUFFER_BIT);
+	glDrawArrays(GL_POINTS, 0, 1);
+	glFinish();
+	double first_frame = now() - start;
+
+	printf("%-5s: %8.1f us binding, %8.1f us to first frame\n",
+		lazy ? "lazy" : "eager",
+		init * 1e6,
+		first_frame * 1e6);
+
+	glDeleteVertexArrays(1, &vao);
+	glDeleteProgram(program);
+	glplatform_destroy_context(ctx);
+	return true;
+}
+
+int main(int argc, char **argv)
+{
+	struct glplatform_win_callbacks cb;
+	memset(&cb, 0, sizeof(cb));
+	bool eager = argc < 2 || !strcmp(argv[1], "eager");
+	bool lazy = argc < 2 || !strcmp(argv[1], "lazy");
+
+	if (!glplatform_init()) {
+		fprintf(stderr, "Failed to initialize GL window manager\n");
+		exit(-1);
+	}
+
+	struct glplatform_win *win = glplatform_create_window("startup benchmark", &cb, NULL, 256, 256);
+	if (!win) {
+		fprintf(stderr, "Failed to create OpenGL window\n");
+		exit(-1);
+	}
+
+	if ((eager && !run(win, false)) || (lazy && !run(win, true)))
+		exit(-1);
+
+	glplatform_destroy_window(win);
+	glplatform_shutdown();
+	return 0;
+}
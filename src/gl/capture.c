@@ -0,0 +1,617 @@
+#include "glutil.h"
+#include "priv.h"
+
+#ifdef GLPLATFORM_CAPTURE
+
+#define GLPLATFORM_GL_VERSION 45
+#define GLPLATFORM_GL_ENABLE_ALL
+#include "glcore_entry_points.h"
+#include "glcore_dispatch.h"
+#include "capture_format.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_MAPPINGS 32
+
+//
+// Entry points whose pointer arguments can't be sized from their signature
+// alone. Typed arrays of other entry points hold as many elements as the
+// nearest GLsizei argument times 'components', or 4 elements when there is
+// no GLsizei argument (e.g. glTexParameterfv()).
+//
+enum call_class {
+	CLASS_DEFAULT,
+	CLASS_FIXED,                //Arrays of 'components' elements
+	CLASS_BUFFER_DATA,          //Data sized by the preceding GLsizeiptr
+	CLASS_BINARY,               //Data sized by the following GLsizei
+	CLASS_TEX_IMAGE,            //Pixels sized by the GLsizei dimensions, format and type
+	CLASS_COMPRESSED_TEX_IMAGE, //Data sized by the preceding GLsizei
+	CLASS_CLEAR_DATA,           //One pixel of the preceding format and type
+	CLASS_READ_PIXELS,          //Pixels written to client memory
+	CLASS_READ_BUFFER,          //Output sized by the preceding GLsizeiptr
+	CLASS_GEN                   //Names written to an array
+};
+
+struct call_desc {
+	uint8_t call_class;
+	uint8_t components;
+};
+
+struct mapping {
+	GLuint buffer;
+	uint8_t *ptr;
+	uint64_t offset;
+	uint64_t length;
+	bool write_on_unmap;
+};
+
+static const char *g_names[] = {
+#define GLPLATFORM_GL_FUNC(ret, name, params, args) \
+	#name,
+#define GLPLATFORM_GL_VOID_FUNC(name, params, args) \
+	#name,
+#include "glcore_entry_points.h"
+};
+
+static const char *g_sigs[] = {
+#define GLPLATFORM_GL_SIGNATURE(ret, name, params, args, sig, store, load) \
+	sig,
+#define GLPLATFORM_GL_VOID_SIGNATURE(name, params, args, sig, store, load) \
+	sig,
+#include "glcore_entry_points.h"
+};
+
+static struct call_desc g_desc[CAPTURE_NUM_ENTRY_POINTS];
+static struct mapping g_mappings[MAX_MAPPINGS];
+static FILE *g_file;
+static bool g_installed;
+static _Thread_local bool t_capture;
+
+//Entry points the capture wrappers forward to
+static struct glplatform_gl_dispatch next;
+
+static bool prefix(const char *name, const char *p)
+{
+	return !strncmp(name, p, strlen(p));
+}
+
+static void classify(int index)
+{
+	const char *name = g_names[index];
+	const char *sig = g_sigs[index];
+	struct call_desc *desc = g_desc + index;
+	desc->call_class = CLASS_DEFAULT;
+	desc->components = 1;
+
+	if (prefix(name, "glUniform") || prefix(name, "glProgramUniform")) {
+		const char *s = strstr(name, "Uniform") + 7;
+		if (prefix(s, "Matrix")) {
+			desc->components = (s[6] - '0') * (s[7] == 'x' ? s[8] - '0' : s[6] - '0');
+		} else if (s[0] >= '1' && s[0] <= '4') {
+			desc->components = s[0] - '0';
+		}
+	} else if (prefix(name, "glVertexAttrib") && strpbrk(sig, "1248")) {
+		const char *s = strpbrk(name + 14, "1234");
+		desc->call_class = CLASS_FIXED;
+		desc->components = (s && !strchr(name, 'P')) ? s[0] - '0' : 1;
+	} else if (index == CAPTURE_glViewportArrayv || index == CAPTURE_glScissorArrayv) {
+		desc->components = 4;
+	} else if (index == CAPTURE_glDepthRangeArrayv) {
+		desc->components = 2;
+	} else if (index == CAPTURE_glBufferData || index == CAPTURE_glBufferSubData ||
+			index == CAPTURE_glBufferStorage || index == CAPTURE_glNamedBufferData ||
+			index == CAPTURE_glNamedBufferSubData || index == CAPTURE_glNamedBufferStorage) {
+		desc->call_class = CLASS_BUFFER_DATA;
+	} else if (index == CAPTURE_glProgramBinary || index == CAPTURE_glShaderBinary) {
+		desc->call_class = CLASS_BINARY;
+	} else if (prefix(name, "glTexImage") || prefix(name, "glTexSubImage") || prefix(name, "glTextureSubImage")) {
+		desc->call_class = CLASS_TEX_IMAGE;
+	} else if (prefix(name, "glCompressedTex")) {
+		desc->call_class = CLASS_COMPRESSED_TEX_IMAGE;
+	} else if (prefix(name, "glClearBuffer") || prefix(name, "glClearNamedBuffer") || prefix(name, "glClearTex")) {
+		if (strchr(sig, 'p'))
+			desc->call_class = CLASS_CLEAR_DATA;
+	} else if (prefix(name, "glReadPixels") || prefix(name, "glReadnPixels")) {
+		desc->call_class = CLASS_READ_PIXELS;
+	} else if (index == CAPTURE_glGetBufferSubData || index == CAPTURE_glGetNamedBufferSubData) {
+		desc->call_class = CLASS_READ_BUFFER;
+	} else if (capture_is_gen(name, sig)) {
+		desc->call_class = CLASS_GEN;
+	}
+}
+
+static void put(const void *data, size_t size)
+{
+	fwrite(data, size, 1, g_file);
+}
+
+static void put_u8(uint8_t v)
+{
+	put(&v, sizeof(v));
+}
+
+static void put_u16(uint16_t v)
+{
+	put(&v, sizeof(v));
+}
+
+static void put_u32(uint32_t v)
+{
+	put(&v, sizeof(v));
+}
+
+static void put_u64(uint64_t v)
+{
+	put(&v, sizeof(v));
+}
+
+static void put_value(const void *p)
+{
+	put_u8(CAPTURE_POINTER_VALUE);
+	put_u64((uintptr_t)p);
+}
+
+static void put_data(const void *p, size_t size)
+{
+	if (!p) {
+		put_value(NULL);
+		return;
+	}
+	put_u8(CAPTURE_POINTER_DATA);
+	put_u32(size);
+	put(p, size);
+}
+
+static void put_output(size_t size)
+{
+	put_u8(CAPTURE_POINTER_OUTPUT);
+	put_u32(size);
+}
+
+static void put_buffer_write(GLuint buffer, uint64_t offset, uint32_t size, const void *data)
+{
+	put_u16(CAPTURE_OP_BUFFER_WRITE);
+	put_u32(buffer);
+	put_u64(offset);
+	put_u32(size);
+	put(data, size);
+}
+
+static GLuint bound_buffer(GLenum target)
+{
+	GLint buffer = 0;
+	GLenum binding = capture_buffer_binding(target);
+	if (binding)
+		next.d_glGetIntegerv(binding, &buffer);
+	return buffer;
+}
+
+static struct mapping *find_mapping(GLuint buffer)
+{
+	int i;
+	for (i = 0; i < MAX_MAPPINGS; i++) {
+		if (g_mappings[i].ptr && g_mappings[i].buffer == buffer)
+			return g_mappings + i;
+	}
+	return NULL;
+}
+
+//
+// Find the GLsizei argument nearest to argument 'j', looking backwards first.
+// Returns -1 if there is none.
+//
+static int nearest_count(const char *sig, int j)
+{
+	int k;
+	for (k = j - 1; k >= 0; k--) {
+		if (sig[k] == 'n')
+			return k;
+	}
+	for (k = j + 1; sig[k]; k++) {
+		if (sig[k] == 'n')
+			return k;
+	}
+	return -1;
+}
+
+static int preceding(const char *sig, int j, char code)
+{
+	int k;
+	for (k = j - 1; k >= 0; k--) {
+		if (sig[k] == code)
+			return k;
+	}
+	return -1;
+}
+
+//
+// Size of pixel data described by the GLsizei dimensions before argument
+// 'j' and the format and type arguments preceding it.
+//
+static size_t image_size(const union capture_arg *argv, const char *sig, int j, bool pack)
+{
+	size_t dims[3] = {1, 1, 1};
+	int num_dims = 0, k;
+	GLint alignment = 4, row_length = 0, image_height = 0;
+
+	for (k = 0; k < j && num_dims < 3; k++) {
+		if (sig[k] == 'n')
+			dims[num_dims++] = argv[k].i;
+	}
+	size_t pixel = glplatform_pixel_size(argv[j - 2].i, argv[j - 1].i);
+	next.d_glGetIntegerv(pack ? GL_PACK_ALIGNMENT : GL_UNPACK_ALIGNMENT, &alignment);
+	next.d_glGetIntegerv(pack ? GL_PACK_ROW_LENGTH : GL_UNPACK_ROW_LENGTH, &row_length);
+	if (!pack)
+		next.d_glGetIntegerv(GL_UNPACK_IMAGE_HEIGHT, &image_height);
+
+	size_t row = (row_length ? row_length : dims[0]) * pixel;
+	row = (row + alignment - 1) / alignment * alignment;
+	size_t image = row * (image_height ? image_height : dims[1]);
+	return image * (dims[2] - 1) + row * dims[1];
+}
+
+static void put_pointer(int index, const union capture_arg *argv, int j)
+{
+	const char *sig = g_sigs[index] + 1;
+	const struct call_desc *desc = g_desc + index;
+	const void *p = argv[j].p;
+	int k;
+
+	switch (sig[j]) {
+	case 'S':
+		put_data(p, p ? strlen((const char *)p) + 1 : 0);
+		return;
+	case 'C': {
+		const GLchar *const *strings = (const GLchar *const *)p;
+		const GLint *lengths = (sig[j + 1] == '4') ? (const GLint *)argv[j + 1].p : NULL;
+		k = nearest_count(sig, j);
+		uint32_t count = k >= 0 ? argv[k].i : 0;
+		put_u8(CAPTURE_POINTER_STRINGS);
+		put_u32(count);
+		for (k = 0; k < count; k++) {
+			uint32_t length = (lengths && lengths[k] >= 0) ? lengths[k] : strlen(strings[k]);
+			put_u32(length);
+			put(strings[k], length);
+		}
+		return;
+	}
+	case 'o':
+		if (desc->call_class == CLASS_READ_PIXELS) {
+			if (bound_buffer(GL_PIXEL_PACK_BUFFER))
+				put_value(p);
+			else if (sig[j - 1] == 'n')
+				put_output(argv[j - 1].i); //bufSize of glReadnPixels()
+			else
+				put_output(image_size(argv, sig, j, true));
+		} else if (desc->call_class == CLASS_READ_BUFFER) {
+			put_output(argv[preceding(sig, j, 'l')].l);
+		} else if (desc->call_class == CLASS_GEN) {
+			put_output(argv[preceding(sig, j, 'n')].i * sizeof(GLuint));
+		} else {
+			put_u8(CAPTURE_POINTER_SKIP);
+		}
+		return;
+	case 'p':
+		switch (desc->call_class) {
+		case CLASS_BUFFER_DATA:
+			put_data(p, argv[preceding(sig, j, 'l')].l);
+			return;
+		case CLASS_BINARY:
+			put_data(p, argv[j + 1].i);
+			return;
+		case CLASS_TEX_IMAGE:
+			if (bound_buffer(GL_PIXEL_UNPACK_BUFFER))
+				put_value(p);
+			else
+				put_data(p, image_size(argv, sig, j, false));
+			return;
+		case CLASS_COMPRESSED_TEX_IMAGE:
+			if (bound_buffer(GL_PIXEL_UNPACK_BUFFER))
+				put_value(p);
+			else
+				put_data(p, argv[preceding(sig, j, 'n')].i);
+			return;
+		case CLASS_CLEAR_DATA:
+			put_data(p, glplatform_pixel_size(argv[j - 2].i, argv[j - 1].i));
+			return;
+		default:
+			//Offsets into bound buffers, e.g. glVertexAttribPointer()
+			put_value(p);
+			return;
+		}
+	default: {
+		//Arrays of 1, 2, 4 or 8 byte elements
+		size_t count;
+		if (j > 0 && sig[j - 1] == 'C') {
+			//String lengths, the strings were recorded with explicit lengths
+			put_value(NULL);
+			return;
+		}
+		if (desc->call_class == CLASS_FIXED) {
+			count = desc->components;
+		} else {
+			k = nearest_count(sig, j);
+			count = k >= 0 ? (size_t)argv[k].i * desc->components : 4;
+		}
+		put_data(p, count * (sig[j] - '0'));
+		return;
+	}
+	}
+}
+
+//
+// Record data written through a mapping before the call that makes it
+// visible to GL.
+//
+static void capture_mapped_writes(int index, const union capture_arg *argv)
+{
+	struct mapping *m;
+	switch (index) {
+	case CAPTURE_glUnmapBuffer:
+	case CAPTURE_glUnmapNamedBuffer:
+		m = find_mapping(index == CAPTURE_glUnmapBuffer ? bound_buffer(argv[0].i) : argv[0].i);
+		if (m) {
+			if (m->write_on_unmap)
+				put_buffer_write(m->buffer, m->offset, m->length, m->ptr);
+			m->ptr = NULL;
+		}
+		break;
+	case CAPTURE_glFlushMappedBufferRange:
+	case CAPTURE_glFlushMappedNamedBufferRange:
+		m = find_mapping(index == CAPTURE_glFlushMappedBufferRange ? bound_buffer(argv[0].i) : argv[0].i);
+		if (m)
+			put_buffer_write(m->buffer, m->offset + argv[1].l, argv[2].l, m->ptr + argv[1].l);
+		break;
+	}
+}
+
+static void track_mapping(int index, const union capture_arg *argv, void *ptr)
+{
+	struct mapping *m;
+	GLint64 size = 0;
+	int i;
+	if (!ptr)
+		return;
+	for (i = 0; i < MAX_MAPPINGS && g_mappings[i].ptr; i++);
+	if (i == MAX_MAPPINGS)
+		return;
+	m = g_mappings + i;
+	m->ptr = (uint8_t *)ptr;
+	switch (index) {
+	case CAPTURE_glMapBuffer:
+		m->buffer = bound_buffer(argv[0].i);
+		next.d_glGetBufferParameteri64v(argv[0].i, GL_BUFFER_SIZE, &size);
+		m->offset = 0;
+		m->length = size;
+		m->write_on_unmap = argv[1].i != GL_READ_ONLY;
+		break;
+	case CAPTURE_glMapNamedBuffer:
+		m->buffer = argv[0].i;
+		if (next.d_glGetNamedBufferParameteri64v)
+			next.d_glGetNamedBufferParameteri64v(argv[0].i, GL_BUFFER_SIZE, &size);
+		m->offset = 0;
+		m->length = size;
+		m->write_on_unmap = argv[1].i != GL_READ_ONLY;
+		break;
+	default:
+		m->buffer = (index == CAPTURE_glMapBufferRange) ? bound_buffer(argv[0].i) : argv[0].i;
+		m->offset = argv[1].l;
+		m->length = argv[2].l;
+		m->write_on_unmap = (argv[3].i & GL_MAP_WRITE_BIT) &&
+			!(argv[3].i & (GL_MAP_PERSISTENT_BIT | GL_MAP_FLUSH_EXPLICIT_BIT));
+		break;
+	}
+}
+
+static void capture_call(int index, const union capture_arg *argv)
+{
+	const char *sig = g_sigs[index] + 1;
+	int j;
+
+	capture_mapped_writes(index, argv);
+	put_u16(index);
+	for (j = 0; sig[j]; j++) {
+		switch (sig[j]) {
+		case 'i':
+		case 'n':
+			put_u32(argv[j].i);
+			break;
+		case 'l':
+			put_u64(argv[j].l);
+			break;
+		case 'f':
+			put(&argv[j].f, sizeof(float));
+			break;
+		case 'd':
+			put(&argv[j].d, sizeof(double));
+			break;
+		case 's':
+			put_u64((uintptr_t)argv[j].s);
+			break;
+		case 'x':
+		case 'X':
+			break;
+		default:
+			put_pointer(index, argv, j);
+			break;
+		}
+	}
+}
+
+static void capture_return(int index, const union capture_arg *argv, const void *result, size_t size)
+{
+	union capture_arg ret;
+	memset(&ret, 0, sizeof(ret));
+	if (size)
+		memcpy(&ret, result, size);
+
+	switch (g_sigs[index][0]) {
+	case 'i':
+		put_u32(ret.i);
+		break;
+	case 'l':
+	case 's':
+		put_u64(ret.l);
+		break;
+	}
+
+	if (g_desc[index].call_class == CLASS_GEN) {
+		const char *sig = g_sigs[index] + 1;
+		int n = strchr(sig, 'n') - sig;
+		put(argv[n + 1].o, argv[n].i * sizeof(GLuint));
+	} else if (index == CAPTURE_glMapBuffer || index == CAPTURE_glMapBufferRange ||
+			index == CAPTURE_glMapNamedBuffer || index == CAPTURE_glMapNamedBufferRange) {
+		track_mapping(index, argv, ret.o);
+	}
+}
+
+#define STORE_i(v) (v)
+#define STORE_l(v) (v)
+#define STORE_f(v) (v)
+#define STORE_d(v) (v)
+#define STORE_s(v) (v)
+#define STORE_p(v) (v)
+#define STORE_o(v) (v)
+#define STORE_x(v) ((void *)(v))
+#define GLPLATFORM_GL_STORE(n, field, value) (argv[n].field = STORE_##field(value))
+
+#define GLPLATFORM_GL_SIGNATURE(ret, name, params, args, sig, store, load) \
+	static ret capture_##name params \
+	{ \
+		union capture_arg argv[CAPTURE_MAX_ARGS]; \
+		ret result; \
+		if (!t_capture) \
+			return next.d_##name args; \
+		argv[0].l = 0; \
+		store; \
+		capture_call(CAPTURE_##name, argv); \
+		result = next.d_##name args; \
+		capture_return(CAPTURE_##name, argv, &result, sizeof(result)); \
+		return result; \
+	}
+#define GLPLATFORM_GL_VOID_SIGNATURE(name, params, args, sig, store, load) \
+	static void capture_##name params \
+	{ \
+		union capture_arg argv[CAPTURE_MAX_ARGS]; \
+		if (!t_capture) { \
+			next.d_##name args; \
+			return; \
+		} \
+		argv[0].l = 0; \
+		store; \
+		capture_call(CAPTURE_##name, argv); \
+		next.d_##name args; \
+		capture_return(CAPTURE_##name, argv, NULL, 0); \
+	}
+#include "glcore_entry_points.h"
+
+bool glplatform_capture_begin(const char *path)
+{
+	struct capture_header header;
+	GLint viewport[4] = {0, 0, 0, 0};
+	int i;
+
+	if (g_installed || !glGetIntegerv)
+		return false;
+	g_file = fopen(path, "wb");
+	if (!g_file)
+		return false;
+
+	glGetIntegerv(GL_VIEWPORT, viewport);
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, CAPTURE_MAGIC, sizeof(header.magic));
+	header.version = CAPTURE_VERSION;
+	header.num_entry_points = CAPTURE_NUM_ENTRY_POINTS;
+	header.width = viewport[2];
+	header.height = viewport[3];
+	put(&header, sizeof(header));
+
+	for (i = 0; i < CAPTURE_NUM_ENTRY_POINTS; i++)
+		classify(i);
+	memset(g_mappings, 0, sizeof(g_mappings));
+
+#define GLPLATFORM_GL_FUNC(ret, name, params, args) \
+	if (name) { \
+		next.d_##name = name; \
+		name = capture_##name; \
+	}
+#define GLPLATFORM_GL_VOID_FUNC(name, params, args) \
+	if (name) { \
+		next.d_##name = name; \
+		name = capture_##name; \
+	}
+#include "glcore_entry_points.h"
+
+	g_installed = true;
+	t_capture = true;
+	return true;
+}
+
+bool glplatform_capture_end()
+{
+	if (!g_installed || !t_capture)
+		return false;
+
+	//Refuse if a layer enabled after the capture still wraps it
+#define GLPLATFORM_GL_FUNC(ret, name, params, args) \
+	if (next.d_##name && name != capture_##name) \
+		return false;
+#define GLPLATFORM_GL_VOID_FUNC(name, params, args) \
+	if (next.d_##name && name != capture_##name) \
+		return false;
+#include "glcore_entry_points.h"
+
+	t_capture = false;
+
+#define GLPLATFORM_GL_FUNC(ret, name, params, args) \
+	if (next.d_##name) { \
+		name = next.d_##name; \
+		next.d_##name = NULL; \
+	}
+#define GLPLATFORM_GL_VOID_FUNC(name, params, args) \
+	if (next.d_##name) { \
+		name = next.d_##name; \
+		next.d_##name = NULL; \
+	}
+#include "glcore_entry_points.h"
+
+	fclose(g_file);
+	g_file = NULL;
+	g_installed = false;
+	return true;
+}
+
+void glplatform_capture_end_frame()
+{
+	if (t_capture)
+		put_u16(CAPTURE_OP_FRAME);
+}
+
+void glplatform_capture_buffer_write(uint32_t buffer, size_t offset, size_t size, const void *data)
+{
+	if (t_capture)
+		put_buffer_write(buffer, offset, size, data);
+}
+
+#else
+
+bool glplatform_capture_begin(const char *path)
+{
+	return false;
+}
+
+bool glplatform_capture_end()
+{
+	return false;
+}
+
+void glplatform_capture_end_frame()
+{
+}
+
+void glplatform_capture_buffer_write(uint32_t buffer, size_t offset, size_t size, const void *data)
+{
+}
+
+#endif
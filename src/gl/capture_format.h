@@ -0,0 +1,117 @@
+#ifndef GLPLATFORM_CAPTURE_FORMAT_H
+#define GLPLATFORM_CAPTURE_FORMAT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+//
+// Layout of trace files written by glplatform_capture_begin() and read by
+// glreplay. Values are stored in the byte order of the capturing machine.
+//
+// The file starts with a struct capture_header followed by records, each
+// starting with a uint16_t op. Ops below CAPTURE_NUM_ENTRY_POINTS are calls to
+// the entry point with that index in glcore_entry_points.h. Their arguments
+// follow in order, encoded by signature code:
+//
+// i, n - uint32_t
+// l, d - 8 bytes
+// f - 4 bytes
+// s - uint64_t sync handle in the capturing process
+// x, X - nothing
+// other pointers - uint8_t enum capture_pointer_kind, then the data for it
+//
+// After the arguments come the return value, encoded by the return type's
+// code, and for glGen* and glCreate* calls the uint32_t names generated.
+//
+
+#define CAPTURE_MAGIC "GLPTRACE"
+#define CAPTURE_VERSION 1
+
+struct capture_header {
+	char magic[8];
+	uint32_t version;
+	uint32_t num_entry_points;
+	uint32_t width; //Viewport size when the capture started
+	uint32_t height;
+};
+
+enum capture_ops {
+#define GLPLATFORM_GL_FUNC(ret, name, params, args) \
+	CAPTURE_##name,
+#define GLPLATFORM_GL_VOID_FUNC(name, params, args) \
+	CAPTURE_##name,
+#include "glcore_entry_points.h"
+	CAPTURE_NUM_ENTRY_POINTS,
+
+	//uint32_t buffer, uint64_t offset, uint32_t size, data
+	CAPTURE_OP_BUFFER_WRITE = 0xfffe,
+
+	//End of a frame
+	CAPTURE_OP_FRAME = 0xffff
+};
+
+enum capture_pointer_kind {
+	//uint64_t pointer value, NULL or an offset into a bound buffer
+	CAPTURE_POINTER_VALUE,
+
+	//uint32_t size, data
+	CAPTURE_POINTER_DATA,
+
+	//uint32_t count, then for each string uint32_t length and characters
+	CAPTURE_POINTER_STRINGS,
+
+	//uint32_t size of client memory the call writes to
+	CAPTURE_POINTER_OUTPUT,
+
+	//Output of unknown size, the call is not replayed
+	CAPTURE_POINTER_SKIP
+};
+
+union capture_arg {
+	uint32_t i;
+	uint64_t l;
+	float f;
+	double d;
+	void *s;
+	const void *p;
+	void *o;
+	void *x;
+};
+
+#define CAPTURE_MAX_ARGS 16
+
+//
+// The helpers below use the GL enums, include glcore.h first.
+//
+
+//glGen*() and glCreate*() calls that return names through an array
+static inline bool capture_is_gen(const char *name, const char *sig)
+{
+	return (!strncmp(name, "glGen", 5) || !strncmp(name, "glCreate", 8)) &&
+		(!strcmp(sig, "vno") || !strcmp(sig, "vino"));
+}
+
+//Binding to query for the buffer bound to a buffer target
+static inline GLenum capture_buffer_binding(GLenum target)
+{
+	switch (target) {
+	case GL_ARRAY_BUFFER: return GL_ARRAY_BUFFER_BINDING;
+	case GL_ELEMENT_ARRAY_BUFFER: return GL_ELEMENT_ARRAY_BUFFER_BINDING;
+	case GL_COPY_READ_BUFFER: return GL_COPY_READ_BUFFER_BINDING;
+	case GL_COPY_WRITE_BUFFER: return GL_COPY_WRITE_BUFFER_BINDING;
+	case GL_PIXEL_PACK_BUFFER: return GL_PIXEL_PACK_BUFFER_BINDING;
+	case GL_PIXEL_UNPACK_BUFFER: return GL_PIXEL_UNPACK_BUFFER_BINDING;
+	case GL_TEXTURE_BUFFER: return GL_TEXTURE_BUFFER;
+	case GL_UNIFORM_BUFFER: return GL_UNIFORM_BUFFER_BINDING;
+	case GL_TRANSFORM_FEEDBACK_BUFFER: return GL_TRANSFORM_FEEDBACK_BUFFER_BINDING;
+	case GL_DRAW_INDIRECT_BUFFER: return GL_DRAW_INDIRECT_BUFFER_BINDING;
+	case GL_DISPATCH_INDIRECT_BUFFER: return GL_DISPATCH_INDIRECT_BUFFER_BINDING;
+	case GL_SHADER_STORAGE_BUFFER: return GL_SHADER_STORAGE_BUFFER_BINDING;
+	case GL_ATOMIC_COUNTER_BUFFER: return GL_ATOMIC_COUNTER_BUFFER_BINDING;
+	case GL_QUERY_BUFFER: return GL_QUERY_BUFFER_BINDING;
+	default: return 0;
+	}
+}
+
+#endif
@@ -0,0 +1,238 @@
+#include "glutil.h"
+#include "priv.h"
+
+#define GLPLATFORM_GL_VERSION 33
+#define GLPLATFORM_ENABLE_GL_KHR_debug
+#include "glcore.h"
+#define GLPLATFORM_GL_USE_DISPATCH
+#include "glcore_dispatch.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+
+//
+// Messages are passed from the driver's callback, which may run in any
+// thread when GL_DEBUG_OUTPUT_SYNCHRONOUS is disabled, to
+// glplatform_process_events() through a bounded multi-producer single-consumer
+// ring. Each slot carries a sequence number: a slot is free for the producer
+// that claimed position 'pos' when its sequence equals 'pos' and holds a
+// message for the consumer when it equals 'pos + 1'. Messages arriving while
+// the ring is full are dropped and counted.
+//
+#define RING_SIZE 256
+#define MAX_MESSAGE_LENGTH 240
+
+//
+// Number of distinct messages remembered for deduplication. Once the table is
+// full new messages are always delivered.
+//
+#define SEEN_SIZE 1024
+
+struct slot {
+	atomic_uint seq;
+	uint32_t source;
+	uint32_t type;
+	uint32_t id;
+	uint32_t severity;
+	char message[MAX_MESSAGE_LENGTH];
+};
+
+struct glplatform_debug {
+	//Counters of the frame in progress, updated by the driver's callback
+	atomic_uint_fast64_t messages;
+	atomic_uint_fast64_t performance;
+
+	//Counters of the last completed frame
+	struct glplatform_debug_stats last_frame;
+};
+
+static struct slot g_ring[RING_SIZE];
+static atomic_uint g_tail;
+static unsigned g_head;
+static atomic_bool g_ring_init;
+static atomic_uint_fast64_t g_dropped;
+
+static uint32_t g_seen[SEEN_SIZE];
+static int g_num_seen;
+
+static void (*g_callback)(const struct glplatform_debug_message *message, void *user_data);
+static void *g_user_data;
+
+static void ring_init()
+{
+	int i;
+	if (atomic_load(&g_ring_init))
+		return;
+	for (i = 0; i < RING_SIZE; i++)
+		atomic_init(&g_ring[i].seq, i);
+	atomic_init(&g_tail, 0);
+	g_head = 0;
+	atomic_store(&g_ring_init, true);
+}
+
+static void ring_push(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *message)
+{
+	unsigned pos = atomic_load_explicit(&g_tail, memory_order_relaxed);
+	struct slot *slot;
+
+	for (;;) {
+		slot = g_ring + (pos % RING_SIZE);
+		unsigned seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+		int diff = (int)(seq - pos);
+		if (diff == 0) {
+			if (atomic_compare_exchange_weak_explicit(&g_tail, &pos, pos + 1,
+						memory_order_relaxed, memory_order_relaxed))
+				break;
+		} else if (diff < 0) {
+			glplatform_count(&g_dropped);
+			return;
+		} else {
+			pos = atomic_load_explicit(&g_tail, memory_order_relaxed);
+		}
+	}
+
+	if (length < 0)
+		length = strlen(message);
+	if (length >= MAX_MESSAGE_LENGTH)
+		length = MAX_MESSAGE_LENGTH - 1;
+	slot->source = source;
+	slot->type = type;
+	slot->id = id;
+	slot->severity = severity;
+	memcpy(slot->message, message, length);
+	slot->message[length] = 0;
+	atomic_store_explicit(&slot->seq, pos + 1, memory_order_release);
+}
+
+static void on_debug_message(GLenum source, GLenum type, GLuint id, GLenum severity,
+		GLsizei length, const GLchar *message, const void *user_param)
+{
+	struct glplatform_debug *debug = (struct glplatform_debug *)user_param;
+	glplatform_count(&debug->messages);
+	if (type == GL_DEBUG_TYPE_PERFORMANCE)
+		glplatform_count(&debug->performance);
+	ring_push(source, type, id, severity, length, message);
+}
+
+static uint32_t message_hash(const struct slot *slot)
+{
+	uint32_t values[4] = {slot->source, slot->type, slot->id, slot->severity};
+	const uint8_t *bytes = (const uint8_t *)values;
+	uint32_t hash = 2166136261u;
+	size_t i;
+	for (i = 0; i < sizeof(values); i++)
+		hash = (hash ^ bytes[i]) * 16777619u;
+	for (i = 0; slot->message[i]; i++)
+		hash = (hash ^ (uint8_t)slot->message[i]) * 16777619u;
+	return hash ? hash : 1;
+}
+
+//
+// Returns true if the message was seen before, otherwise remembers it
+//
+static bool seen(uint32_t hash)
+{
+	int i = hash % SEEN_SIZE;
+	int probes;
+	for (probes = 0; probes < SEEN_SIZE && g_seen[i]; probes++) {
+		if (g_seen[i] == hash)
+			return true;
+		i = (i + 1) % SEEN_SIZE;
+	}
+	if (g_num_seen < SEEN_SIZE * 3 / 4) {
+		g_seen[i] = hash;
+		g_num_seen++;
+	}
+	return false;
+}
+
+static const char *type_name(uint32_t type)
+{
+	switch (type) {
+	case GL_DEBUG_TYPE_ERROR: return "error";
+	case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR: return "deprecated";
+	case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR: return "undefined behavior";
+	case GL_DEBUG_TYPE_PORTABILITY: return "portability";
+	case GL_DEBUG_TYPE_PERFORMANCE: return "performance";
+	case GL_DEBUG_TYPE_MARKER: return "marker";
+	default: return "other";
+	}
+}
+
+static void print_message(const struct glplatform_debug_message *message, void *user_data)
+{
+	fprintf(stderr, "OpenGL %s (%u): %s\n", type_name(message->type), message->id, message->message);
+}
+
+void glplatform_debug_process_messages()
+{
+	if (!atomic_load(&g_ring_init))
+		return;
+	for (;;) {
+		struct slot *slot = g_ring + (g_head % RING_SIZE);
+		unsigned seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+		if (seq != g_head + 1)
+			break;
+		if (!seen(message_hash(slot)) && g_callback) {
+			struct glplatform_debug_message message = {
+				.source = slot->source,
+				.type = slot->type,
+				.id = slot->id,
+				.severity = slot->severity,
+				.message = slot->message
+			};
+			g_callback(&message, g_user_data);
+		}
+		atomic_store_explicit(&slot->seq, g_head + RING_SIZE, memory_order_release);
+		g_head++;
+	}
+}
+
+bool glplatform_debug_enable(void (*callback)(const struct glplatform_debug_message *message, void *user_data),
+		void *user_data)
+{
+	struct glplatform_context *context = glplatform_get_context_priv();
+	if (!context || !GLPLATFORM_GL_KHR_debug || !GLPLATFORM_GL_HAS_ENTRY_POINT(glDebugMessageCallback))
+		return false;
+	if (!context->debug) {
+		context->debug = calloc(1, sizeof(struct glplatform_debug));
+		if (!context->debug)
+			return false;
+	}
+	ring_init();
+	g_callback = callback ? callback : print_message;
+	g_user_data = user_data;
+	glDebugMessageCallback(on_debug_message, context->debug);
+	glEnable(GL_DEBUG_OUTPUT);
+	glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+	return true;
+}
+
+void glplatform_debug_disable()
+{
+	struct glplatform_context *context = glplatform_get_context_priv();
+	if (!context || !context->debug || !GLPLATFORM_GL_HAS_ENTRY_POINT(glDebugMessageCallback))
+		return;
+	glDisable(GL_DEBUG_OUTPUT);
+	glDebugMessageCallback(NULL, NULL);
+}
+
+bool glplatform_debug_get_stats(struct glplatform_debug_stats *stats)
+{
+	struct glplatform_context *context = glplatform_get_context_priv();
+	if (!context)
+		return false;
+	if (context->debug)
+		*stats = context->debug->last_frame;
+	else
+		memset(stats, 0, sizeof(*stats));
+	return true;
+}
+
+void glplatform_debug_end_frame(struct glplatform_debug *debug)
+{
+	debug->last_frame.messages = atomic_exchange_explicit(&debug->messages, 0, memory_order_relaxed);
+	debug->last_frame.performance = atomic_exchange_explicit(&debug->performance, 0, memory_order_relaxed);
+	debug->last_frame.dropped = atomic_load_explicit(&g_dropped, memory_order_relaxed);
+}
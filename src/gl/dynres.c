@@ -0,0 +1,210 @@
+#include "glutil.h"
+#include "priv.h"
+
+#define GLPLATFORM_GL_VERSION 33
+#include "glcore.h"
+#define GLPLATFORM_GL_USE_DISPATCH
+#include "glcore_dispatch.h"
+
+#include <stdlib.h>
+#include <math.h>
+
+//
+// Timer queries are read back a few frames late so the CPU never waits
+// for their results.
+//
+#define QUERY_COUNT 4
+
+//
+// Scale factors are rounded to multiples of SCALE_STEP so small fluctuations
+// in GPU time don't reallocate the framebuffer every frame.
+//
+#define SCALE_STEP 0.05f
+
+//
+// Weight of the newest GPU time sample in the smoothed GPU time
+//
+#define GPU_TIME_SMOOTHING 0.2f
+
+//
+// The scale is raised when the smoothed GPU time is below this fraction of the target
+//
+#define HEADROOM 0.8f
+
+struct glplatform_dynres {
+	struct glplatform_win *win;
+	float target_gpu_ms;
+	float min_scale;
+	float max_scale;
+	float scale;
+	float gpu_ms;
+
+	GLuint framebuffer;
+	GLuint color_texture;
+	GLuint depth_renderbuffer;
+	int width;
+	int height;
+
+	GLuint queries[QUERY_COUNT];
+	bool query_pending[QUERY_COUNT];
+	bool query_active;
+	int query_index;
+};
+
+struct glplatform_dynres *glplatform_dynres_create(struct glplatform_win *win,
+		float target_gpu_ms, float min_scale, float max_scale)
+{
+	struct glplatform_dynres *dynres = (struct glplatform_dynres *)calloc(1, sizeof(struct glplatform_dynres));
+	if (!dynres)
+		return NULL;
+	if (min_scale > max_scale)
+		min_scale = max_scale;
+	dynres->win = win;
+	dynres->target_gpu_ms = target_gpu_ms;
+	dynres->min_scale = min_scale;
+	dynres->max_scale = max_scale;
+	dynres->scale = max_scale;
+	dynres->gpu_ms = 0;
+	glGenFramebuffers(1, &dynres->framebuffer);
+	glGenQueries(QUERY_COUNT, dynres->queries);
+	return dynres;
+}
+
+static void free_targets(struct glplatform_dynres *dynres)
+{
+	if (dynres->color_texture)
+		glDeleteTextures(1, &dynres->color_texture);
+	if (dynres->depth_renderbuffer)
+		glDeleteRenderbuffers(1, &dynres->depth_renderbuffer);
+	dynres->color_texture = 0;
+	dynres->depth_renderbuffer = 0;
+	dynres->width = 0;
+	dynres->height = 0;
+}
+
+void glplatform_dynres_destroy(struct glplatform_dynres *dynres)
+{
+	free_targets(dynres);
+	glDeleteFramebuffers(1, &dynres->framebuffer);
+	glDeleteQueries(QUERY_COUNT, dynres->queries);
+	free(dynres);
+}
+
+static void alloc_targets(struct glplatform_dynres *dynres, int width, int height)
+{
+	free_targets(dynres);
+
+	glGenTextures(1, &dynres->color_texture);
+	glBindTexture(GL_TEXTURE_2D, dynres->color_texture);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	glGenRenderbuffers(1, &dynres->depth_renderbuffer);
+	glBindRenderbuffer(GL_RENDERBUFFER, dynres->depth_renderbuffer);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+	glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+	glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, dynres->color_texture, 0);
+	glFramebufferRenderbuffer(GL_DRAW_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, dynres->depth_renderbuffer);
+	dynres->width = width;
+	dynres->height = height;
+}
+
+void glplatform_dynres_begin(struct glplatform_dynres *dynres)
+{
+	int width = (int)(dynres->win->width * dynres->scale + 0.5f);
+	int height = (int)(dynres->win->height * dynres->scale + 0.5f);
+	if (width < 1)
+		width = 1;
+	if (height < 1)
+		height = 1;
+
+	glBindFramebuffer(GL_DRAW_FRAMEBUFFER, dynres->framebuffer);
+	if (width != dynres->width || height != dynres->height)
+		alloc_targets(dynres, width, height);
+	glViewport(0, 0, width, height);
+
+	//Skip timing this frame if the query from QUERY_COUNT frames ago
+	//still hasn't completed
+	int i = dynres->query_index;
+	dynres->query_active = !dynres->query_pending[i];
+	if (dynres->query_active) {
+		glBeginQuery(GL_TIME_ELAPSED, dynres->queries[i]);
+		dynres->query_pending[i] = true;
+	}
+}
+
+//
+// Read back completed timer queries and adjust the scale factor.
+// Resolution is proportional to the square of the scale so the scale
+// is corrected by the square root of the budget ratio. The scale is only
+// adjusted when a new sample arrived, adjusting again on a sample that was
+// already acted on would overshoot.
+//
+static void update_scale(struct glplatform_dynres *dynres)
+{
+	bool sampled = false;
+	int i;
+	for (i = 0; i < QUERY_COUNT; i++) {
+		GLuint available = 0;
+		GLuint64 elapsed_ns;
+		if (!dynres->query_pending[i])
+			continue;
+		glGetQueryObjectuiv(dynres->queries[i], GL_QUERY_RESULT_AVAILABLE, &available);
+		if (!available)
+			continue;
+		glGetQueryObjectui64v(dynres->queries[i], GL_QUERY_RESULT, &elapsed_ns);
+		dynres->query_pending[i] = false;
+		sampled = true;
+		float ms = elapsed_ns / 1e6f;
+		if (dynres->gpu_ms == 0)
+			dynres->gpu_ms = ms;
+		else
+			dynres->gpu_ms += (ms - dynres->gpu_ms) * GPU_TIME_SMOOTHING;
+	}
+
+	if (!sampled || dynres->gpu_ms == 0)
+		return;
+
+	float scale = dynres->scale;
+	if (dynres->gpu_ms > dynres->target_gpu_ms)
+		scale *= sqrtf(dynres->target_gpu_ms / dynres->gpu_ms);
+	else if (dynres->gpu_ms < dynres->target_gpu_ms * HEADROOM)
+		scale += SCALE_STEP;
+	scale = floorf(scale / SCALE_STEP + 0.5f) * SCALE_STEP;
+	if (scale < dynres->min_scale)
+		scale = dynres->min_scale;
+	if (scale > dynres->max_scale)
+		scale = dynres->max_scale;
+	dynres->scale = scale;
+}
+
+void glplatform_dynres_end(struct glplatform_dynres *dynres)
+{
+	if (dynres->query_active)
+		glEndQuery(GL_TIME_ELAPSED);
+	dynres->query_active = false;
+	dynres->query_index = (dynres->query_index + 1) % QUERY_COUNT;
+
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, dynres->framebuffer);
+	glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+	glBlitFramebuffer(0, 0, dynres->width, dynres->height,
+		0, 0, dynres->win->width, dynres->win->height,
+		GL_COLOR_BUFFER_BIT, GL_LINEAR);
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+	glViewport(0, 0, dynres->win->width, dynres->win->height);
+
+	update_scale(dynres);
+}
+
+float glplatform_dynres_get_scale(struct glplatform_dynres *dynres)
+{
+	return dynres->scale;
+}
+
+float glplatform_dynres_get_gpu_ms(struct glplatform_dynres *dynres)
+{
+	return dynres->gpu_ms;
+}
@@ -0,0 +1,143 @@
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "glutil.h"
+#include "priv.h"
+
+#define GLPLATFORM_GL_VERSION 33
+#include "glcore.h"
+#define GLPLATFORM_GL_USE_DISPATCH
+#include "glcore_dispatch.h"
+
+#include <stdlib.h>
+#include <time.h>
+
+#define DEFAULT_FRAMES_IN_FLIGHT 2
+
+//
+// Fence wait timeout. Waits are retried until the fence signals.
+//
+#define FENCE_TIMEOUT_NS 100000000
+
+//
+// Fences of the last GLPLATFORM_MAX_FRAMES_IN_FLIGHT frames of a window
+// indexed by frame number modulo GLPLATFORM_MAX_FRAMES_IN_FLIGHT.
+//
+struct glplatform_frame_limiter {
+	GLsync fences[GLPLATFORM_MAX_FRAMES_IN_FLIGHT];
+	int max_in_flight;
+	struct glplatform_frame_stats stats;
+};
+
+static uint64_t now_ns()
+{
+#ifdef _WIN32
+	LARGE_INTEGER count, freq;
+	QueryPerformanceCounter(&count);
+	QueryPerformanceFrequency(&freq);
+	return (uint64_t)(count.QuadPart * (1e9 / freq.QuadPart));
+#else
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * UINT64_C(1000000000) + ts.tv_nsec;
+#endif
+}
+
+static struct glplatform_frame_limiter *get_limiter(struct glplatform_win *win)
+{
+	if (!win->frame_limiter) {
+		win->frame_limiter = calloc(1, sizeof(struct glplatform_frame_limiter));
+		if (win->frame_limiter)
+			win->frame_limiter->max_in_flight = DEFAULT_FRAMES_IN_FLIGHT;
+	}
+	return win->frame_limiter;
+}
+
+bool glplatform_frame_set_max_in_flight(struct glplatform_win *win, int frames)
+{
+	struct glplatform_frame_limiter *limiter = get_limiter(win);
+	if (!limiter)
+		return false;
+	if (frames < 1)
+		frames = 1;
+	if (frames > GLPLATFORM_MAX_FRAMES_IN_FLIGHT)
+		frames = GLPLATFORM_MAX_FRAMES_IN_FLIGHT;
+	limiter->max_in_flight = frames;
+	return true;
+}
+
+void glplatform_frame_begin(struct glplatform_win *win)
+{
+	struct glplatform_frame_limiter *limiter = get_limiter(win);
+	if (!limiter)
+		return;
+
+	//The fence of the frame max_in_flight frames ago must signal before
+	//another frame is started. Fences of older frames have signaled too
+	//so they are deleted without waiting.
+	uint64_t start = now_ns();
+	int i;
+	for (i = 0; i < GLPLATFORM_MAX_FRAMES_IN_FLIGHT; i++) {
+		int64_t frame = (int64_t)limiter->stats.frames - GLPLATFORM_MAX_FRAMES_IN_FLIGHT + i;
+		if (frame < 0)
+			continue;
+		if (frame + limiter->max_in_flight > (int64_t)limiter->stats.frames)
+			break;
+		int slot = frame % GLPLATFORM_MAX_FRAMES_IN_FLIGHT;
+		GLsync fence = limiter->fences[slot];
+		if (!fence)
+			continue;
+		GLenum status;
+		do {
+			status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, FENCE_TIMEOUT_NS);
+		} while (status == GL_TIMEOUT_EXPIRED);
+		glDeleteSync(fence);
+		limiter->fences[slot] = NULL;
+	}
+	limiter->stats.gpu_bound_ns = now_ns() - start;
+	limiter->stats.total_gpu_bound_ns += limiter->stats.gpu_bound_ns;
+}
+
+void glplatform_frame_end(struct glplatform_win *win)
+{
+	struct glplatform_frame_limiter *limiter = get_limiter(win);
+	if (!limiter)
+		return;
+
+	int slot = limiter->stats.frames % GLPLATFORM_MAX_FRAMES_IN_FLIGHT;
+	if (limiter->fences[slot])
+		glDeleteSync(limiter->fences[slot]);
+	limiter->fences[slot] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	limiter->stats.frames++;
+}
+
+void glplatform_frame_get_stats(struct glplatform_win *win, struct glplatform_frame_stats *stats)
+{
+	struct glplatform_frame_limiter *limiter = win->frame_limiter;
+	if (limiter) {
+		*stats = limiter->stats;
+	} else {
+		stats->frames = 0;
+		stats->gpu_bound_ns = 0;
+		stats->total_gpu_bound_ns = 0;
+	}
+}
+
+void glplatform_frame_limiter_free(struct glplatform_win *win)
+{
+	struct glplatform_frame_limiter *limiter = win->frame_limiter;
+	int i;
+	if (!limiter)
+		return;
+
+	//Fences can only be deleted with a context current
+	if (glplatform_get_context_priv()) {
+		for (i = 0; i < GLPLATFORM_MAX_FRAMES_IN_FLIGHT; i++) {
+			if (limiter->fences[i])
+				glDeleteSync(limiter->fences[i]);
+		}
+	}
+	free(limiter);
+	win->frame_limiter = NULL;
+}
@@ -0,0 +1,878 @@
+#ifndef GLUTIL_H
+#define GLUTIL_H
+
+#include "glplatform.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+//
+// OpenGL helpers built on top of the glplatform bindings. Unless noted
+// otherwise these functions must be called in a thread with a current
+// glplatform context after glplatform_glcore_init() has succeeded.
+//
+
+//
+// Redundant state filter
+//
+
+struct glplatform_state_filter_stats {
+	/* State calls that reached the filter */
+	uint64_t calls;
+
+	/* State calls that were dropped because they would not change driver state */
+	uint64_t elided;
+};
+
+/*
+ * glplatform_state_filter_enable()
+ *
+ * Install or remove the redundant state filter. When installed the bindings for
+ * glUseProgram(), glActiveTexture(), glBindTexture(), glBindBuffer(),
+ * glBindVertexArray(), glBindFramebuffer(), glEnable(), glDisable(), glBlendFunc()
+ * and glBlendFuncSeparate() are routed through a per-context shadow of the
+ * bound state and calls that would not change it are not forwarded to the driver.
+ * Calls that delete or bind objects behind the shadow's back (glDelete*(),
+ * glBindTextures(), glBindTextureUnit(), glEnablei(), ...) invalidate the affected
+ * shadow entries.
+ *
+ * The filter patches the function pointers set up by glplatform_glcore_init() so
+ * it must be installed after the bindings are initialized and will be lost if
+ * glplatform_glcore_init() is called again. State changed through
+ * glplatform_set_thread_state() or by code that does not use the glplatform bindings
+ * is not seen by the filter.
+ *
+ * The state filter, the profiler and the capture are layers that each wrap the
+ * function pointers current when they are enabled. A layer can only be removed
+ * while it is the most recently enabled one still installed, so layers must be
+ * disabled in the reverse order they were enabled in. Removing a layer out of
+ * order fails and leaves all layers installed.
+ *
+ * Returns false if the filter could not be installed, or could not be removed
+ * because another layer was enabled after it.
+ *
+ */
+bool glplatform_state_filter_enable(bool enable);
+
+/*
+ * glplatform_state_filter_get_stats()
+ *
+ * Retrieve the filter counters for the current context's last completed frame.
+ * A frame ends each time glplatform_swap_buffers() is called with the context
+ * current.
+ *
+ * Returns false if no glplatform context is current.
+ *
+ */
+bool glplatform_state_filter_get_stats(struct glplatform_state_filter_stats *stats);
+
+//
+// Debug output
+//
+// Routes KHR_debug messages of a context through a lock-free ring so the
+// driver's callback never blocks, and delivers them from
+// glplatform_process_events(). Identical messages are delivered once.
+// Messages of type GL_DEBUG_TYPE_PERFORMANCE, such as pipeline stalls or
+// shader recompiles, are counted per frame. Contexts created with
+// GLPLATFORM_CONTEXT_DEBUG report the most messages.
+//
+
+struct glplatform_debug_message {
+	/* GL_DEBUG_SOURCE_*, GL_DEBUG_TYPE_* and GL_DEBUG_SEVERITY_* values */
+	uint32_t source;
+	uint32_t type;
+	uint32_t id;
+	uint32_t severity;
+
+	/* Message text, truncated to 239 characters */
+	const char *message;
+};
+
+struct glplatform_debug_stats {
+	/* Messages reported by the context */
+	uint64_t messages;
+
+	/* Messages of type GL_DEBUG_TYPE_PERFORMANCE */
+	uint64_t performance;
+
+	/* Messages dropped by all contexts since startup because the ring was full */
+	uint64_t dropped;
+};
+
+/*
+ * glplatform_debug_enable()
+ *
+ * Enable asynchronous debug output for the current context. 'callback' is
+ * called from glplatform_process_events() with each new message, if NULL
+ * messages are printed to stderr. The callback is shared by all contexts,
+ * the last one set is used.
+ *
+ * Returns false if the context doesn't support KHR_debug.
+ *
+ */
+bool glplatform_debug_enable(void (*callback)(const struct glplatform_debug_message *message, void *user_data),
+		void *user_data);
+
+/*
+ * glplatform_debug_disable()
+ *
+ * Disable debug output for the current context.
+ *
+ */
+void glplatform_debug_disable();
+
+/*
+ * glplatform_debug_get_stats()
+ *
+ * Retrieve the debug message counters of the current context's last completed
+ * frame. Counters are zero if debug output was never enabled.
+ *
+ * Returns false if no glplatform context is current.
+ *
+ */
+bool glplatform_debug_get_stats(struct glplatform_debug_stats *stats);
+
+//
+// GPU timer
+//
+// Measures GPU time of named, nestable scopes with GL_TIMESTAMP queries. A
+// frame's queries are read back 3 frames later so reading them never waits on
+// the GPU, if they still aren't available the frame's results are dropped.
+// Timings are per context. gltext renders are timed as "gltext" scopes.
+//
+
+struct glplatform_gpu_scope_timing {
+	/* Name passed to glplatform_gpu_scope_begin() */
+	const char *name;
+
+	/* Nesting depth, 0 for top level scopes */
+	int depth;
+
+	/* Index of the enclosing scope or -1 */
+	int parent;
+
+	/* GPU time from the frame's first scope to the start of this scope */
+	uint64_t start_ns;
+
+	/* GPU time spent in the scope */
+	uint64_t duration_ns;
+};
+
+/*
+ * glplatform_gpu_timer_enable()
+ *
+ * Enable or disable GPU timing for the current context. Scopes are ignored
+ * while timing is disabled.
+ *
+ * Returns false if no glplatform context is current.
+ *
+ */
+bool glplatform_gpu_timer_enable(bool enable);
+
+/*
+ * glplatform_gpu_scope_begin()
+ *
+ * Begin a GPU timer scope. Scopes nest up to 16 deep and up to 256 are
+ * recorded per frame. 'name' is not copied and must stay valid, typically it
+ * is a string literal.
+ *
+ */
+void glplatform_gpu_scope_begin(const char *name);
+
+/*
+ * glplatform_gpu_scope_end()
+ *
+ * End the innermost scope. Scopes still open when the frame ends are ended
+ * automatically.
+ *
+ */
+void glplatform_gpu_scope_end();
+
+/*
+ * glplatform_gpu_timer_get_frame()
+ *
+ * Copy up to 'max_timings' scope timings of the most recent frame read back
+ * into 'timings', in the order the scopes began. Parents precede their
+ * children.
+ *
+ * Returns the number of timings copied.
+ *
+ */
+int glplatform_gpu_timer_get_frame(struct glplatform_gpu_scope_timing *timings, int max_timings);
+
+//
+// OpenGL call profiler
+//
+// Wraps every entry point of the bindings to count calls and measure the CPU
+// time spent in each function. Counters are kept per thread and per frame, a
+// thread's frame ends when it swaps a window or calls
+// glplatform_profile_end_frame(). Only available when glplatform is configured
+// with --enable-profile. When disabled the bindings are left untouched and
+// cost nothing.
+//
+
+/*
+ * glplatform_profile_enable()
+ *
+ * Install or remove the profiler. Like the state filter it wraps the current
+ * function pointers, so it must be enabled again after glplatform_glcore_init()
+ * and layers must be disabled in the reverse order they were enabled in (see
+ * glplatform_state_filter_enable()).
+ *
+ * Returns false if the profiler isn't built, or could not be removed because
+ * another layer was enabled after it.
+ *
+ */
+bool glplatform_profile_enable(bool enable);
+
+/*
+ * glplatform_profile_end_frame()
+ *
+ * End the calling thread's profiling frame. Called automatically when a window
+ * is swapped. May be called without a current context.
+ *
+ */
+void glplatform_profile_end_frame();
+
+/*
+ * glplatform_profile_dump()
+ *
+ * Write a report of the calling thread's last completed frame to 'out', with
+ * the call count and CPU time of each function called, most expensive first.
+ * May be called without a current context.
+ *
+ */
+void glplatform_profile_dump(FILE *out);
+
+//
+// OpenGL call capture
+//
+// Records every OpenGL call made by the capturing thread, with its arguments
+// and the client memory it reads, to a trace file that the glreplay tool can
+// re-execute to benchmark a workload offline. Objects are referred to by the
+// names GL generated while capturing and objects that already exist are not
+// recorded, so capture must begin before any OpenGL object is created.
+// glreplay stops with an error when the replay generates different names than
+// the capture. Only available when glplatform is configured with
+// --enable-capture.
+//
+
+/*
+ * glplatform_capture_begin()
+ *
+ * Start writing a trace to 'path'. Like the profiler it wraps the current
+ * function pointers and requires a current context. Frames are delimited by
+ * window swaps. Must be called before the context creates any objects, the
+ * trace holds no snapshot of existing ones.
+ *
+ * Returns false if the capture isn't built, a capture is already running or
+ * the file can't be created.
+ *
+ */
+bool glplatform_capture_begin(const char *path);
+
+/*
+ * glplatform_capture_end()
+ *
+ * Stop capturing, restore the wrapped function pointers and close the trace.
+ * Must be called from the thread that began the capture.
+ *
+ * Returns false if no capture is running on this thread, or if the capture
+ * could not be removed because another layer was enabled after it. In the
+ * latter case capturing continues.
+ *
+ */
+bool glplatform_capture_end();
+
+//
+// Streaming buffer
+//
+// A ring buffer for data written by the CPU once per draw, such as dynamic
+// vertices or uniforms. With ARB_buffer_storage (OpenGL 4.4) the ring is mapped
+// once with a persistent coherent mapping. Regions written during a frame are
+// protected by a fence inserted when the frame is swapped, and the writer only
+// waits when it catches up with a region the GPU may still be reading. Without
+// ARB_buffer_storage each allocation is mapped unsynchronized and the buffer is
+// orphaned when the ring wraps.
+//
+
+struct glplatform_stream_buffer;
+
+/*
+ * glplatform_stream_buffer_create()
+ *
+ * Create a streaming buffer of 'size' bytes for use in the current context.
+ *
+ * target - Binding point used to map the buffer when persistent mapping is
+ * 	not available, e.g. GL_ARRAY_BUFFER
+ *
+ * Returns NULL on failure.
+ *
+ */
+struct glplatform_stream_buffer *glplatform_stream_buffer_create(uint32_t target, size_t size);
+
+/*
+ * glplatform_stream_buffer_destroy()
+ *
+ * Delete the buffer. Must be called in the context it was created in.
+ *
+ */
+void glplatform_stream_buffer_destroy(struct glplatform_stream_buffer *stream);
+
+/*
+ * glplatform_stream_buffer_map()
+ *
+ * Allocate 'size' bytes aligned to 'alignment' bytes from the ring and return a
+ * pointer to write them through. 'offset' receives the allocation's offset in
+ * the buffer object. Only one allocation may be mapped at a time.
+ *
+ * Returns NULL if 'size' is larger than the buffer or mapping failed.
+ *
+ */
+void *glplatform_stream_buffer_map(struct glplatform_stream_buffer *stream, size_t size, size_t alignment, size_t *offset);
+
+/*
+ * glplatform_stream_buffer_unmap()
+ *
+ * Finish writing the mapped allocation. 'used' bytes from the start of the
+ * allocation are consumed from the ring, the rest is returned. The data may be
+ * used by draws issued after this call.
+ *
+ */
+void glplatform_stream_buffer_unmap(struct glplatform_stream_buffer *stream, size_t used);
+
+/*
+ * glplatform_stream_buffer_get_name()
+ *
+ * Returns the buffer object name to bind for draws.
+ *
+ */
+uint32_t glplatform_stream_buffer_get_name(struct glplatform_stream_buffer *stream);
+
+/*
+ * glplatform_stream_buffer_get_size()
+ *
+ * Returns the size of the ring in bytes.
+ *
+ */
+size_t glplatform_stream_buffer_get_size(struct glplatform_stream_buffer *stream);
+
+//
+// Texture upload queue
+//
+// Stages texture data through a streaming pixel unpack buffer and spreads
+// large uploads over several frames. Each time a window is swapped, queued
+// uploads are issued in sub-regions of whole layers or runs of rows until the
+// queue's per-frame byte budget is spent.
+//
+
+struct glplatform_upload_queue;
+
+/*
+ * glplatform_upload_queue_create()
+ *
+ * Create an upload queue for the current context.
+ *
+ * staging_size - Size of the pixel buffer data is staged through. A single
+ * 	row of an upload must fit.
+ *
+ * frame_budget - Bytes to upload per frame
+ *
+ * Returns NULL on failure.
+ *
+ */
+struct glplatform_upload_queue *glplatform_upload_queue_create(size_t staging_size, size_t frame_budget);
+
+/*
+ * glplatform_upload_queue_destroy()
+ *
+ * Destroy the queue. Pending uploads are dropped without calling their
+ * completion callbacks.
+ *
+ */
+void glplatform_upload_queue_destroy(struct glplatform_upload_queue *queue);
+
+/*
+ * glplatform_upload_texture()
+ *
+ * Queue an upload to a region of a texture. The texture's storage must already
+ * be allocated. 'target' is the texture's target or, for cube maps, the face.
+ * Rows in 'data' are tightly packed and 'data' must remain valid until 'done'
+ * is called. 'done' is called from the swap that issues the last sub-region,
+ * commands issued after it see the whole upload.
+ *
+ * Returns false if the format or type is not supported or a row does not fit
+ * in the staging buffer.
+ *
+ */
+bool glplatform_upload_texture(struct glplatform_upload_queue *queue,
+		uint32_t texture, uint32_t target, int level,
+		int x, int y, int z, int width, int height, int depth,
+		uint32_t format, uint32_t type, const void *data,
+		void (*done)(void *arg), void *arg);
+
+/*
+ * glplatform_upload_queue_cancel()
+ *
+ * Drop all pending uploads to 'texture' without calling their completion
+ * callbacks. Must be called before deleting a texture with queued uploads.
+ *
+ */
+void glplatform_upload_queue_cancel(struct glplatform_upload_queue *queue, uint32_t texture);
+
+/*
+ * glplatform_upload_queue_flush()
+ *
+ * Issue all pending uploads now, ignoring the budget.
+ *
+ */
+void glplatform_upload_queue_flush(struct glplatform_upload_queue *queue);
+
+/*
+ * glplatform_upload_queue_pending()
+ *
+ * Returns the number of uploads not yet completed.
+ *
+ */
+int glplatform_upload_queue_pending(struct glplatform_upload_queue *queue);
+
+//
+// Frames in flight limiter
+//
+
+#define GLPLATFORM_MAX_FRAMES_IN_FLIGHT 3
+
+struct glplatform_frame_stats {
+	/* Number of frames completed with glplatform_frame_end() */
+	uint64_t frames;
+
+	/* Time glplatform_frame_begin() waited for the GPU in the last frame, in nanoseconds */
+	uint64_t gpu_bound_ns;
+
+	/* Total GPU-bound time over all frames, in nanoseconds */
+	uint64_t total_gpu_bound_ns;
+};
+
+/*
+ * glplatform_frame_set_max_in_flight()
+ *
+ * Set how many frames may be queued for 'win' before glplatform_frame_begin()
+ * blocks. Clamped to the range 1 - GLPLATFORM_MAX_FRAMES_IN_FLIGHT. The default
+ * is 2. Lower values reduce input latency at the cost of CPU/GPU parallelism.
+ *
+ * Returns false if the limiter state could not be allocated.
+ *
+ */
+bool glplatform_frame_set_max_in_flight(struct glplatform_win *win, int frames);
+
+/*
+ * glplatform_frame_begin()
+ *
+ * Call before building a frame for 'win'. Waits until the GPU has finished the
+ * frame submitted the configured number of frames ago so the driver can't queue
+ * more frames than that, regardless of it's own queue depth. Time spent waiting
+ * is reported as GPU-bound time by glplatform_frame_get_stats().
+ *
+ */
+void glplatform_frame_begin(struct glplatform_win *win);
+
+/*
+ * glplatform_frame_end()
+ *
+ * Call after glplatform_swap_buffers() or glplatform_swap_buffers_multi() for
+ * 'win' with the same context current. Inserts the fence
+ * glplatform_frame_begin() waits on.
+ *
+ */
+void glplatform_frame_end(struct glplatform_win *win);
+
+/*
+ * glplatform_frame_get_stats()
+ *
+ * Retrieve frame limiter statistics for 'win'.
+ *
+ */
+void glplatform_frame_get_stats(struct glplatform_win *win, struct glplatform_frame_stats *stats);
+
+//
+// Dynamic resolution
+//
+// Renders a window's scene to an offscreen framebuffer whose size is the window
+// size times a scale factor. The scale is lowered when the GPU time of the scene,
+// measured with timer queries, exceeds the target and raised again when there is
+// headroom. glplatform_dynres_end() upscales the result to the window's default
+// framebuffer.
+//
+
+struct glplatform_dynres;
+
+/*
+ * glplatform_dynres_create()
+ *
+ * Create a dynamic resolution helper for 'win'. Must be called with a current
+ * OpenGL 3.3 or later context.
+ *
+ * target_gpu_ms - GPU time budget for the scene
+ *
+ * min_scale, max_scale - Range of the scale factor applied to each dimension
+ *
+ * Returns NULL on failure.
+ *
+ */
+struct glplatform_dynres *glplatform_dynres_create(struct glplatform_win *win,
+		float target_gpu_ms, float min_scale, float max_scale);
+
+/*
+ * glplatform_dynres_destroy()
+ *
+ * Delete the helper's framebuffer and queries. Must be called with the
+ * context the helper was used with current.
+ *
+ */
+void glplatform_dynres_destroy(struct glplatform_dynres *dynres);
+
+/*
+ * glplatform_dynres_begin()
+ *
+ * Bind the offscreen framebuffer, reallocating it if the window was resized
+ * or the scale changed, and set the viewport to it's size. Call before drawing
+ * the scene.
+ *
+ */
+void glplatform_dynres_begin(struct glplatform_dynres *dynres);
+
+/*
+ * glplatform_dynres_end()
+ *
+ * Upscale the offscreen framebuffer to the default framebuffer, leaving the
+ * default framebuffer bound with a viewport covering the window, and update the
+ * scale factor from completed timer queries. Call before drawing overlays that
+ * should be rendered at full resolution and before glplatform_swap_buffers().
+ *
+ */
+void glplatform_dynres_end(struct glplatform_dynres *dynres);
+
+/*
+ * glplatform_dynres_get_scale()
+ *
+ * Returns the scale factor used by the last glplatform_dynres_begin()
+ *
+ */
+float glplatform_dynres_get_scale(struct glplatform_dynres *dynres);
+
+/*
+ * glplatform_dynres_get_gpu_ms()
+ *
+ * Returns the smoothed GPU time of the scene in milliseconds
+ *
+ */
+float glplatform_dynres_get_gpu_ms(struct glplatform_dynres *dynres);
+
+//
+// Render target pool
+//
+// Hands out framebuffer/texture pairs for transient passes and recycles them
+// across frames instead of creating and deleting them. Free targets are evicted
+// least recently used first when the pool exceeds it's memory budget or when they
+// haven't been used for a while, and all targets are invalidated when the window
+// the pool belongs to changes size.
+//
+
+struct glplatform_render_target {
+	/* Framebuffer with 'texture' attached. Depth formats are attached as depth (and stencil) */
+	uint32_t framebuffer;
+	uint32_t texture;
+
+	int width;
+	int height;
+	uint32_t format;
+	int samples;
+
+	/* Private */
+	size_t size;
+	bool in_use;
+	bool win_sized;
+	uint64_t last_used;
+	uint32_t generation;
+	struct glplatform_render_target *next;
+};
+
+struct glplatform_rt_pool;
+
+/*
+ * glplatform_rt_pool_create()
+ *
+ * Create a render target pool for 'win' with a budget of 'budget_bytes' for
+ * it's free targets. Targets in use are not evicted and do not count towards
+ * the budget.
+ *
+ */
+struct glplatform_rt_pool *glplatform_rt_pool_create(struct glplatform_win *win, size_t budget_bytes);
+
+/*
+ * glplatform_rt_pool_destroy()
+ *
+ * Delete all of the pool's targets, including those still in use.
+ *
+ */
+void glplatform_rt_pool_destroy(struct glplatform_rt_pool *pool);
+
+/*
+ * glplatform_rt_acquire()
+ *
+ * Get a render target with the given size, internal format and sample count,
+ * reusing a free target when possible. A width or height of 0 means the
+ * window's width or height, such targets are evicted from the pool when the
+ * window is resized. Integer formats get nearest filtering. The target's
+ * contents are undefined.
+ *
+ * Returns NULL if the target could not be created.
+ *
+ */
+const struct glplatform_render_target *glplatform_rt_acquire(struct glplatform_rt_pool *pool,
+		int width, int height, uint32_t format, int samples);
+
+/*
+ * glplatform_rt_release()
+ *
+ * Return a target to the pool. The target may be handed out again by the
+ * next glplatform_rt_acquire() call so it should only be released once all
+ * passes reading it have been submitted.
+ *
+ */
+void glplatform_rt_release(struct glplatform_rt_pool *pool, const struct glplatform_render_target *target);
+
+/*
+ * glplatform_rt_pool_end_frame()
+ *
+ * Advance the pool's frame counter and evict targets that haven't been used
+ * for a number of frames.
+ *
+ */
+void glplatform_rt_pool_end_frame(struct glplatform_rt_pool *pool);
+
+//
+// Program cache
+//
+// Builds GLSL programs from source and keeps the linked binaries on disk,
+// obtained with glGetProgramBinary(). Binaries are keyed by a hash of the
+// shader sources and the GL_VENDOR, GL_RENDERER and GL_VERSION strings, so a
+// driver update or a different GPU misses the cache instead of loading an
+// incompatible binary. Binaries the driver rejects are rebuilt from source.
+// The cache is unused if the context doesn't support ARB_get_program_binary.
+//
+
+struct glplatform_shader_source {
+	/* Shader stage, e.g. GL_VERTEX_SHADER */
+	uint32_t type;
+
+	/* NUL terminated GLSL source */
+	const char *source;
+};
+
+struct glplatform_program_cache_stats {
+	/* Programs loaded from a cached binary */
+	uint64_t hits;
+
+	/* Lookups that found no usable binary */
+	uint64_t misses;
+
+	/* Binaries written to the cache */
+	uint64_t stores;
+};
+
+/*
+ * glplatform_program_cache_set_path()
+ *
+ * Set the directory cached binaries are kept in, it is created if needed.
+ * A NULL path disables the disk cache. By default binaries are kept in
+ * $XDG_CACHE_HOME/glplatform or ~/.cache/glplatform, and in
+ * %LOCALAPPDATA%\glplatform on Windows. May be called from any thread and
+ * while programs are being built, builds already running may still use the
+ * previous path. Previous path strings are not freed so it should be called
+ * rarely. May be called without a current context.
+ *
+ */
+void glplatform_program_cache_set_path(const char *path);
+
+/*
+ * glplatform_program_create()
+ *
+ * Build a program from 'count' shaders, loading it from the cache when
+ * possible. Attribute and fragment output locations must be set in the
+ * shaders since the program is linked before it is returned.
+ *
+ * info_log - If not NULL receives the compile or link log on failure
+ *
+ * info_log_size - Size of 'info_log' in bytes
+ *
+ * Returns the program name or 0 on failure.
+ *
+ */
+uint32_t glplatform_program_create(const struct glplatform_shader_source *shaders, int count,
+		char *info_log, size_t info_log_size);
+
+/*
+ * glplatform_program_cache_get_stats()
+ *
+ * Retrieve the cache counters accumulated by all threads since startup.
+ * May be called without a current context.
+ *
+ */
+void glplatform_program_cache_get_stats(struct glplatform_program_cache_stats *stats);
+
+//
+// Asynchronous program builder
+//
+// Builds many programs without waiting on each compile in turn. All compiles
+// and links are issued when programs are submitted and completion is checked
+// later, so the driver can work on them concurrently. Builds go through the
+// program cache like glplatform_program_create(). Depending on the driver the
+// builder works in one of three ways:
+//
+// - With KHR_parallel_shader_compile or ARB_parallel_shader_compile the driver
+//   compiles on its own threads and glplatform_program_builder_poll() only
+//   reports builds that have completed.
+//
+// - Otherwise, if a loader was given, programs are built on the loader's
+//   threads and completion is reported from glplatform_process_events().
+//   The loader's contexts must share objects with the current context.
+//
+// - Otherwise glplatform_program_builder_poll() waits for all submitted
+//   builds. Drivers that compile in the background still overlap the work.
+//
+
+struct glplatform_loader;
+struct glplatform_program_builder;
+
+/*
+ * glplatform_program_builder_create()
+ *
+ * Create a builder for the current context.
+ *
+ * loader - Loader to build on when the driver can't compile in parallel,
+ * 	may be NULL. Ignored on Windows.
+ *
+ */
+struct glplatform_program_builder *glplatform_program_builder_create(struct glplatform_loader *loader);
+
+/*
+ * glplatform_program_builder_destroy()
+ *
+ * Destroy a builder. Programs that haven't been reported yet are deleted
+ * without calling their callbacks.
+ *
+ */
+void glplatform_program_builder_destroy(struct glplatform_program_builder *builder);
+
+/*
+ * glplatform_program_builder_submit()
+ *
+ * Start building a program from up to 6 shaders. The sources are not
+ * referenced after the call returns. 'done' is called with the program name,
+ * or with 0 and the compile or link log if the build failed.
+ *
+ * Returns false if the build could not be started.
+ *
+ */
+bool glplatform_program_builder_submit(struct glplatform_program_builder *builder,
+		const struct glplatform_shader_source *shaders, int count,
+		void (*done)(uint32_t program, const char *info_log, void *user_data),
+		void *user_data);
+
+/*
+ * glplatform_program_builder_poll()
+ *
+ * Call the callbacks of builds that have completed.
+ *
+ * Returns the number of builds still pending.
+ *
+ */
+int glplatform_program_builder_poll(struct glplatform_program_builder *builder);
+
+#ifndef _WIN32
+//
+// Asynchronous resource loader
+//
+// The loader runs jobs on background threads, each with an offscreen context
+// sharing objects with the application's context. After a batch of jobs has run
+// the loader thread waits on a fence and then posts the jobs' completion
+// callbacks to glplatform's event loop, so when a completion callback runs the
+// objects the job created are ready for use by the application's context.
+// Completion callbacks are called from glplatform_process_events().
+//
+// Not available on Windows.
+//
+
+struct glplatform_loader;
+
+/*
+ * glplatform_loader_create()
+ *
+ * Start 'thread_count' loader threads. May be called without a current context.
+ *
+ * share - Context the loader threads' contexts share objects with
+ *
+ * attribs - Version and flags of the loader threads' contexts
+ *
+ * Returns NULL on failure.
+ *
+ */
+struct glplatform_loader *glplatform_loader_create(glplatform_gl_context_t share,
+		const struct glplatform_context_attribs *attribs,
+		int thread_count);
+
+/*
+ * glplatform_loader_destroy()
+ *
+ * Wait for all submitted jobs to finish, invoke any completion callbacks that
+ * have not been delivered yet and stop the loader threads.
+ *
+ */
+void glplatform_loader_destroy(struct glplatform_loader *loader);
+
+/*
+ * glplatform_loader_submit()
+ *
+ * Queue a job. 'job' is called on a loader thread with it's context current and
+ * 'done' is called from glplatform_process_events() once the commands issued by
+ * 'job' have completed. Either callback may be NULL.
+ *
+ * Returns false if the job could not be queued.
+ *
+ */
+bool glplatform_loader_submit(struct glplatform_loader *loader,
+		void (*job)(void *arg),
+		void (*done)(void *arg),
+		void *arg);
+
+/*
+ * glplatform_loader_upload_buffer()
+ *
+ * Create a buffer object with glBufferData(). 'data' must stay valid until
+ * 'done' is called with the new buffer's name, or 0 on failure.
+ *
+ */
+bool glplatform_loader_upload_buffer(struct glplatform_loader *loader,
+		uint32_t target, size_t size, const void *data, uint32_t usage,
+		void (*done)(uint32_t buffer, void *user_data),
+		void *user_data);
+
+/*
+ * glplatform_loader_upload_texture_2d()
+ *
+ * Create a 2D texture with glTexImage2D() and optionally generate mipmaps.
+ * 'pixels' must stay valid until 'done' is called with the new texture's
+ * name, or 0 on failure.
+ *
+ */
+bool glplatform_loader_upload_texture_2d(struct glplatform_loader *loader,
+		uint32_t internal_format, int width, int height,
+		uint32_t format, uint32_t type, const void *pixels, bool mipmaps,
+		void (*done)(uint32_t texture, void *user_data),
+		void *user_data);
+#endif
+
+#endif
@@ -0,0 +1,201 @@
+#include "glutil.h"
+#include "priv.h"
+
+#define GLPLATFORM_GL_VERSION 33
+#include "glcore.h"
+#define GLPLATFORM_GL_USE_DISPATCH
+#include "glcore_dispatch.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+//
+// Number of frames a frame's queries are left in flight before they are read
+// back. Each frame has its own slot of queries so a slot is only reused once
+// its results have been collected.
+//
+#define FRAME_DELAY 3
+#define NUM_SLOTS (FRAME_DELAY + 1)
+
+#define MAX_SCOPES 256
+#define MAX_DEPTH 16
+
+struct scope {
+	const char *name;
+	int depth;
+	int parent;
+	bool ended;
+};
+
+struct frame_slot {
+	GLuint queries[MAX_SCOPES * 2]; //Begin and end timestamp of each scope
+	int num_generated;
+	struct scope scopes[MAX_SCOPES];
+	int num_scopes;
+	GLuint last_query; //Timestamps complete in order, this one completes last
+};
+
+struct glplatform_gpu_timer {
+	bool enabled;
+	struct frame_slot slots[NUM_SLOTS];
+	int cur_slot;
+
+	//Open scopes of the current frame
+	int stack[MAX_DEPTH];
+	int depth;
+
+	//Scopes begun past MAX_DEPTH or MAX_SCOPES that are not recorded
+	int dropped_depth;
+
+	//Last frame read back
+	struct glplatform_gpu_scope_timing results[MAX_SCOPES];
+	int num_results;
+};
+
+static struct glplatform_gpu_timer *get_timer()
+{
+	struct glplatform_context *context = glplatform_get_context_priv();
+	return context ? context->gpu_timer : NULL;
+}
+
+static void ensure_queries(struct frame_slot *slot, int count)
+{
+	int n;
+	if (count <= slot->num_generated)
+		return;
+	//Generate in blocks to keep glGenQueries() out of most frames
+	n = count + 32;
+	if (n > MAX_SCOPES * 2)
+		n = MAX_SCOPES * 2;
+	glGenQueries(n - slot->num_generated, slot->queries + slot->num_generated);
+	slot->num_generated = n;
+}
+
+void glplatform_gpu_scope_begin(const char *name)
+{
+	struct glplatform_gpu_timer *timer = get_timer();
+	if (!timer || !timer->enabled)
+		return;
+	struct frame_slot *slot = timer->slots + timer->cur_slot;
+	if (timer->dropped_depth || timer->depth == MAX_DEPTH || slot->num_scopes == MAX_SCOPES) {
+		timer->dropped_depth++;
+		return;
+	}
+	int index = slot->num_scopes++;
+	struct scope *scope = slot->scopes + index;
+	ensure_queries(slot, slot->num_scopes * 2);
+	scope->name = name;
+	scope->depth = timer->depth;
+	scope->parent = timer->depth ? timer->stack[timer->depth - 1] : -1;
+	scope->ended = false;
+	timer->stack[timer->depth++] = index;
+	slot->last_query = slot->queries[index * 2];
+	glQueryCounter(slot->last_query, GL_TIMESTAMP);
+}
+
+void glplatform_gpu_scope_end()
+{
+	struct glplatform_gpu_timer *timer = get_timer();
+	if (!timer || !timer->enabled)
+		return;
+	if (timer->dropped_depth) {
+		timer->dropped_depth--;
+		return;
+	}
+	if (!timer->depth)
+		return;
+	struct frame_slot *slot = timer->slots + timer->cur_slot;
+	int index = timer->stack[--timer->depth];
+	slot->scopes[index].ended = true;
+	slot->last_query = slot->queries[index * 2 + 1];
+	glQueryCounter(slot->last_query, GL_TIMESTAMP);
+}
+
+//
+// Read back a slot's timestamps if they are all available. Results are
+// dropped rather than waited for if the GPU is further behind than
+// FRAME_DELAY frames.
+//
+static void read_slot(struct glplatform_gpu_timer *timer, struct frame_slot *slot)
+{
+	GLuint64 frame_start = 0;
+	GLint available = 0;
+	int i;
+
+	if (!slot->num_scopes)
+		return;
+	glGetQueryObjectiv(slot->last_query, GL_QUERY_RESULT_AVAILABLE, &available);
+	if (!available)
+		goto done;
+
+	for (i = 0; i < slot->num_scopes; i++) {
+		struct scope *scope = slot->scopes + i;
+		struct glplatform_gpu_scope_timing *result = timer->results + i;
+		GLuint64 begin = 0, end = 0;
+		glGetQueryObjectui64v(slot->queries[i * 2], GL_QUERY_RESULT, &begin);
+		if (scope->ended)
+			glGetQueryObjectui64v(slot->queries[i * 2 + 1], GL_QUERY_RESULT, &end);
+		if (!i)
+			frame_start = begin;
+		result->name = scope->name;
+		result->depth = scope->depth;
+		result->parent = scope->parent;
+		result->start_ns = begin - frame_start;
+		result->duration_ns = end > begin ? end - begin : 0;
+	}
+	timer->num_results = slot->num_scopes;
+done:
+	slot->num_scopes = 0;
+}
+
+void glplatform_gpu_timer_end_frame(struct glplatform_gpu_timer *timer)
+{
+	if (!timer->enabled)
+		return;
+	//Close scopes left open so the frame's slot is complete
+	timer->dropped_depth = 0;
+	while (timer->depth)
+		glplatform_gpu_scope_end();
+	timer->cur_slot = (timer->cur_slot + 1) % NUM_SLOTS;
+	read_slot(timer, timer->slots + timer->cur_slot);
+}
+
+bool glplatform_gpu_timer_enable(bool enable)
+{
+	struct glplatform_context *context = glplatform_get_context_priv();
+	struct glplatform_gpu_timer *timer;
+	int i;
+	if (!context)
+		return false;
+	if (!context->gpu_timer) {
+		if (!enable)
+			return true;
+		context->gpu_timer = calloc(1, sizeof(struct glplatform_gpu_timer));
+		if (!context->gpu_timer)
+			return false;
+	}
+	timer = context->gpu_timer;
+	if (!enable && timer->enabled) {
+		//Queries in flight are discarded
+		for (i = 0; i < NUM_SLOTS; i++) {
+			glDeleteQueries(timer->slots[i].num_generated, timer->slots[i].queries);
+			timer->slots[i].num_generated = 0;
+			timer->slots[i].num_scopes = 0;
+		}
+		timer->depth = 0;
+		timer->dropped_depth = 0;
+	}
+	timer->enabled = enable;
+	return true;
+}
+
+int glplatform_gpu_timer_get_frame(struct glplatform_gpu_scope_timing *timings, int max_timings)
+{
+	struct glplatform_gpu_timer *timer = get_timer();
+	int count;
+	if (!timer)
+		return 0;
+	count = timer->num_results < max_timings ? timer->num_results : max_timings;
+	memcpy(timings, timer->results, sizeof(struct glplatform_gpu_scope_timing) * count);
+	return count;
+}
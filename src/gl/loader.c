@@ -0,0 +1,404 @@
+#include "glutil.h"
+#include "priv.h"
+
+#define GLPLATFORM_GL_VERSION 33
+#include "glcore.h"
+#define GLPLATFORM_GL_USE_DISPATCH
+#include "glcore_dispatch.h"
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <errno.h>
+#include <sys/eventfd.h>
+
+//
+// Maximum number of jobs a loader thread runs before waiting on a fence
+//
+#define MAX_BATCH 16
+
+//
+// Fence wait timeout. Waits are retried until the fence signals, the timeout
+// only bounds how long a lost GPU keeps a thread blocked in the driver.
+//
+#define FENCE_TIMEOUT_NS 1000000000
+
+struct loader_job {
+	void (*job)(void *arg);
+	void (*done)(void *arg);
+	void *arg;
+	struct loader_job *next;
+};
+
+struct job_queue {
+	struct loader_job *head;
+	struct loader_job *tail;
+};
+
+struct glplatform_loader {
+	pthread_mutex_t mutex;
+	pthread_cond_t cond;
+	struct job_queue pending;
+	struct job_queue completed;
+	int running;
+	bool quit;
+	int event_fd;
+	int thread_count;
+	int context_count;
+	pthread_t *threads;
+	glplatform_gl_context_t *contexts;
+};
+
+static void queue_push(struct job_queue *queue, struct loader_job *job)
+{
+	job->next = NULL;
+	if (queue->tail)
+		queue->tail->next = job;
+	else
+		queue->head = job;
+	queue->tail = job;
+}
+
+static struct loader_job *queue_take(struct job_queue *queue)
+{
+	struct loader_job *jobs = queue->head;
+	queue->head = NULL;
+	queue->tail = NULL;
+	return jobs;
+}
+
+static void wait_for_commands()
+{
+	GLsync fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	if (!fence) {
+		glFinish();
+		return;
+	}
+	GLenum status;
+	do {
+		status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, FENCE_TIMEOUT_NS);
+	} while (status == GL_TIMEOUT_EXPIRED);
+	glDeleteSync(fence);
+}
+
+static void *loader_thread(void *arg)
+{
+	struct glplatform_loader *loader = (struct glplatform_loader *)arg;
+	int index;
+
+	pthread_mutex_lock(&loader->mutex);
+	index = loader->running++;
+	pthread_mutex_unlock(&loader->mutex);
+
+	glplatform_make_current(NULL, loader->contexts[index]);
+
+	pthread_mutex_lock(&loader->mutex);
+	while (true) {
+		struct loader_job *batch = NULL;
+		struct loader_job **batch_tail = &batch;
+		int count = 0;
+
+		while (!loader->pending.head && !loader->quit)
+			pthread_cond_wait(&loader->cond, &loader->mutex);
+		if (!loader->pending.head)
+			break;
+
+		//Take up to MAX_BATCH jobs so they share one fence wait
+		while (loader->pending.head && count < MAX_BATCH) {
+			struct loader_job *job = loader->pending.head;
+			loader->pending.head = job->next;
+			*batch_tail = job;
+			batch_tail = &job->next;
+			count++;
+		}
+		if (!loader->pending.head)
+			loader->pending.tail = NULL;
+		*batch_tail = NULL;
+		pthread_mutex_unlock(&loader->mutex);
+
+		struct loader_job *job;
+		for (job = batch; job; job = job->next) {
+			if (job->job)
+				job->job(job->arg);
+		}
+		wait_for_commands();
+
+		pthread_mutex_lock(&loader->mutex);
+		while (batch) {
+			job = batch;
+			batch = job->next;
+			queue_push(&loader->completed, job);
+		}
+		//EAGAIN means the counter is saturated, the main thread is woken anyway
+		uint64_t one = 1;
+		while (write(loader->event_fd, &one, sizeof(one)) < 0 && errno == EINTR);
+	}
+	pthread_mutex_unlock(&loader->mutex);
+
+	glplatform_make_current(NULL, 0);
+	return NULL;
+}
+
+static void run_completed(struct glplatform_loader *loader)
+{
+	pthread_mutex_lock(&loader->mutex);
+	struct loader_job *jobs = queue_take(&loader->completed);
+	pthread_mutex_unlock(&loader->mutex);
+
+	while (jobs) {
+		struct loader_job *job = jobs;
+		jobs = job->next;
+		if (job->done)
+			job->done(job->arg);
+		free(job);
+	}
+}
+
+static void on_loader_event(int fd, uint32_t events, intptr_t user_data)
+{
+	struct glplatform_loader *loader = (struct glplatform_loader *)user_data;
+	uint64_t count;
+	ssize_t rc;
+	do {
+		rc = read(fd, &count, sizeof(count));
+	} while (rc < 0 && errno == EINTR);
+	//EAGAIN means another wakeup already reset the counter
+	if (rc < 0 && errno != EAGAIN)
+		return;
+	run_completed(loader);
+}
+
+struct glplatform_loader *glplatform_loader_create(glplatform_gl_context_t share,
+		const struct glplatform_context_attribs *attribs,
+		int thread_count)
+{
+	int i;
+	struct glplatform_loader *loader = (struct glplatform_loader *)calloc(1, sizeof(struct glplatform_loader));
+	if (!loader)
+		goto error1;
+
+	if (thread_count < 1)
+		goto error2;
+	loader->threads = (pthread_t *)calloc(thread_count, sizeof(pthread_t));
+	loader->contexts = (glplatform_gl_context_t *)calloc(thread_count, sizeof(glplatform_gl_context_t));
+	if (!loader->threads || !loader->contexts)
+		goto error2;
+
+	//Contexts are created here since they must be created before they are
+	//current in any thread to be shared reliably.
+	for (i = 0; i < thread_count; i++) {
+		loader->contexts[i] = glplatform_create_offscreen_context(attribs, share);
+		if (!loader->contexts[i])
+			goto error3;
+	}
+	loader->context_count = thread_count;
+
+	loader->event_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	if (loader->event_fd == -1)
+		goto error3;
+
+	if (!glplatform_fd_bind_handler(loader->event_fd, on_loader_event, (intptr_t)loader))
+		goto error4;
+
+	pthread_mutex_init(&loader->mutex, NULL);
+	pthread_cond_init(&loader->cond, NULL);
+	for (i = 0; i < thread_count; i++) {
+		if (pthread_create(loader->threads + i, NULL, loader_thread, loader))
+			break;
+	}
+	loader->thread_count = i;
+	if (loader->thread_count == 0) {
+		pthread_cond_destroy(&loader->cond);
+		pthread_mutex_destroy(&loader->mutex);
+		glplatform_fd_unbind(loader->event_fd);
+		goto error4;
+	}
+	return loader;
+error4:
+	close(loader->event_fd);
+error3:
+	for (i = 0; i < thread_count; i++)
+		glplatform_destroy_context(loader->contexts[i]);
+error2:
+	free(loader->contexts);
+	free(loader->threads);
+	free(loader);
+error1:
+	return NULL;
+}
+
+void glplatform_loader_destroy(struct glplatform_loader *loader)
+{
+	int i;
+	pthread_mutex_lock(&loader->mutex);
+	loader->quit = true;
+	pthread_cond_broadcast(&loader->cond);
+	pthread_mutex_unlock(&loader->mutex);
+
+	for (i = 0; i < loader->thread_count; i++)
+		pthread_join(loader->threads[i], NULL);
+
+	for (i = 0; i < loader->context_count; i++)
+		glplatform_destroy_context(loader->contexts[i]);
+
+	glplatform_fd_unbind(loader->event_fd);
+	close(loader->event_fd);
+	run_completed(loader);
+
+	pthread_cond_destroy(&loader->cond);
+	pthread_mutex_destroy(&loader->mutex);
+	free(loader->contexts);
+	free(loader->threads);
+	free(loader);
+}
+
+bool glplatform_loader_submit(struct glplatform_loader *loader,
+		void (*job)(void *arg),
+		void (*done)(void *arg),
+		void *arg)
+{
+	struct loader_job *loader_job = (struct loader_job *)malloc(sizeof(struct loader_job));
+	if (!loader_job)
+		return false;
+	loader_job->job = job;
+	loader_job->done = done;
+	loader_job->arg = arg;
+
+	pthread_mutex_lock(&loader->mutex);
+	queue_push(&loader->pending, loader_job);
+	pthread_cond_signal(&loader->cond);
+	pthread_mutex_unlock(&loader->mutex);
+	return true;
+}
+
+//
+// Buffer and texture uploads
+//
+
+struct upload {
+	GLenum target;
+	GLenum internal_format;
+	GLenum format;
+	GLenum type;
+	GLenum usage;
+	GLsizeiptr size;
+	GLsizei width;
+	GLsizei height;
+	bool mipmaps;
+	const void *data;
+	GLuint name;
+	void (*done)(uint32_t name, void *user_data);
+	void *user_data;
+};
+
+static void upload_done(void *arg)
+{
+	struct upload *upload = (struct upload *)arg;
+	upload->done(upload->name, upload->user_data);
+	free(upload);
+}
+
+//
+// Discard errors left by earlier jobs so upload_failed() only sees the
+// upload's own
+//
+static void clear_errors()
+{
+	int i;
+	for (i = 0; i < 16 && glGetError() != GL_NO_ERROR; i++);
+}
+
+static bool upload_failed()
+{
+	bool failed = false;
+	int i;
+	//Bounded since a lost context may keep reporting an error
+	for (i = 0; i < 16 && glGetError() != GL_NO_ERROR; i++)
+		failed = true;
+	return failed;
+}
+
+static void upload_buffer(void *arg)
+{
+	struct upload *upload = (struct upload *)arg;
+	GLint64 size = 0;
+	clear_errors();
+	glGenBuffers(1, &upload->name);
+	glBindBuffer(upload->target, upload->name);
+	glBufferData(upload->target, upload->size, upload->data, upload->usage);
+	//Errors aren't reported by no-error contexts, check the allocation too
+	glGetBufferParameteri64v(upload->target, GL_BUFFER_SIZE, &size);
+	glBindBuffer(upload->target, 0);
+	if (upload_failed() || size != (GLint64)upload->size) {
+		glDeleteBuffers(1, &upload->name);
+		upload->name = 0;
+	}
+}
+
+bool glplatform_loader_upload_buffer(struct glplatform_loader *loader,
+		uint32_t target, size_t size, const void *data, uint32_t usage,
+		void (*done)(uint32_t buffer, void *user_data),
+		void *user_data)
+{
+	struct upload *upload = (struct upload *)calloc(1, sizeof(struct upload));
+	if (!upload)
+		return false;
+	upload->target = target;
+	upload->size = size;
+	upload->data = data;
+	upload->usage = usage;
+	upload->done = done;
+	upload->user_data = user_data;
+	if (!glplatform_loader_submit(loader, upload_buffer, upload_done, upload)) {
+		free(upload);
+		return false;
+	}
+	return true;
+}
+
+static void upload_texture_2d(void *arg)
+{
+	struct upload *upload = (struct upload *)arg;
+	GLint width = 0;
+	clear_errors();
+	glGenTextures(1, &upload->name);
+	glBindTexture(GL_TEXTURE_2D, upload->name);
+	glTexImage2D(GL_TEXTURE_2D, 0, upload->internal_format,
+		upload->width, upload->height, 0,
+		upload->format, upload->type, upload->data);
+	if (upload->mipmaps)
+		glGenerateMipmap(GL_TEXTURE_2D);
+	//Errors aren't reported by no-error contexts, check the allocation too
+	glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width);
+	glBindTexture(GL_TEXTURE_2D, 0);
+	if (upload_failed() || width != upload->width) {
+		glDeleteTextures(1, &upload->name);
+		upload->name = 0;
+	}
+}
+
+bool glplatform_loader_upload_texture_2d(struct glplatform_loader *loader,
+		uint32_t internal_format, int width, int height,
+		uint32_t format, uint32_t type, const void *pixels, bool mipmaps,
+		void (*done)(uint32_t texture, void *user_data),
+		void *user_data)
+{
+	struct upload *upload = (struct upload *)calloc(1, sizeof(struct upload));
+	if (!upload)
+		return false;
+	upload->internal_format = internal_format;
+	upload->width = width;
+	upload->height = height;
+	upload->format = format;
+	upload->type = type;
+	upload->data = pixels;
+	upload->mipmaps = mipmaps;
+	upload->done = done;
+	upload->user_data = user_data;
+	if (!glplatform_loader_submit(loader, upload_texture_2d, upload_done, upload)) {
+		free(upload);
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,230 @@
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "glutil.h"
+#include "priv.h"
+
+#ifdef GLPLATFORM_PROFILE
+
+#define GLPLATFORM_GL_VERSION 45
+#define GLPLATFORM_GL_ENABLE_ALL
+#include "glcore_entry_points.h"
+#include "glcore_dispatch.h"
+
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+enum profile_entry_points {
+#define GLPLATFORM_GL_FUNC(ret, name, params, args) \
+	PROFILE_##name,
+#define GLPLATFORM_GL_VOID_FUNC(name, params, args) \
+	PROFILE_##name,
+#include "glcore_entry_points.h"
+	NUM_PROFILE_ENTRY_POINTS
+};
+
+static const char *g_names[] = {
+#define GLPLATFORM_GL_FUNC(ret, name, params, args) \
+	#name,
+#define GLPLATFORM_GL_VOID_FUNC(name, params, args) \
+	#name,
+#include "glcore_entry_points.h"
+};
+
+struct profile_counters {
+	uint64_t calls;
+	uint64_t ns;
+};
+
+//
+// Counters of one thread. They are only written by their thread so no
+// synchronization is needed. Blocks are allocated the first time a thread
+// calls through the profiler and are kept until process exit.
+//
+struct profile_thread {
+	struct profile_counters frame[NUM_PROFILE_ENTRY_POINTS];
+	struct profile_counters last_frame[NUM_PROFILE_ENTRY_POINTS];
+	uint64_t frame_count;
+};
+
+static _Thread_local struct profile_thread *t_profile;
+
+//Entry points the profiler wrappers forward to
+static struct glplatform_gl_dispatch next;
+static bool g_installed;
+
+static inline uint64_t profile_now()
+{
+#ifdef _WIN32
+	static LARGE_INTEGER freq;
+	LARGE_INTEGER count;
+	if (!freq.QuadPart)
+		QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&count);
+	return (uint64_t)(count.QuadPart * (1e9 / freq.QuadPart));
+#else
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000ull + ts.tv_nsec;
+#endif
+}
+
+static struct profile_thread *get_profile()
+{
+	if (!t_profile)
+		t_profile = calloc(1, sizeof(struct profile_thread));
+	return t_profile;
+}
+
+static inline void record(int index, uint64_t start)
+{
+	uint64_t end = profile_now();
+	struct profile_thread *profile = get_profile();
+	if (profile) {
+		profile->frame[index].calls++;
+		profile->frame[index].ns += end - start;
+	}
+}
+
+#define GLPLATFORM_GL_FUNC(ret, name, params, args) \
+	static ret profile_##name params \
+	{ \
+		uint64_t start = profile_now(); \
+		ret result = next.d_##name args; \
+		record(PROFILE_##name, start); \
+		return result; \
+	}
+#define GLPLATFORM_GL_VOID_FUNC(name, params, args) \
+	static void profile_##name params \
+	{ \
+		uint64_t start = profile_now(); \
+		next.d_##name args; \
+		record(PROFILE_##name, start); \
+	}
+#include "glcore_entry_points.h"
+
+bool glplatform_profile_enable(bool enable)
+{
+	if (enable == g_installed)
+		return true;
+
+	if (enable) {
+#define GLPLATFORM_GL_FUNC(ret, name, params, args) \
+		if (name) { \
+			next.d_##name = name; \
+			name = profile_##name; \
+		}
+#define GLPLATFORM_GL_VOID_FUNC(name, params, args) \
+		if (name) { \
+			next.d_##name = name; \
+			name = profile_##name; \
+		}
+#include "glcore_entry_points.h"
+	} else {
+		//Refuse if a layer enabled after the profiler still wraps it
+#define GLPLATFORM_GL_FUNC(ret, name, params, args) \
+		if (next.d_##name && name != profile_##name) \
+			return false;
+#define GLPLATFORM_GL_VOID_FUNC(name, params, args) \
+		if (next.d_##name && name != profile_##name) \
+			return false;
+#include "glcore_entry_points.h"
+
+#define GLPLATFORM_GL_FUNC(ret, name, params, args) \
+		if (next.d_##name) { \
+			name = next.d_##name; \
+			next.d_##name = NULL; \
+		}
+#define GLPLATFORM_GL_VOID_FUNC(name, params, args) \
+		if (next.d_##name) { \
+			name = next.d_##name; \
+			next.d_##name = NULL; \
+		}
+#include "glcore_entry_points.h"
+	}
+	g_installed = enable;
+	return true;
+}
+
+void glplatform_profile_end_frame()
+{
+	struct profile_thread *profile = t_profile;
+	if (!profile)
+		return;
+	memcpy(profile->last_frame, profile->frame, sizeof(profile->frame));
+	memset(profile->frame, 0, sizeof(profile->frame));
+	profile->frame_count++;
+}
+
+struct report_entry {
+	int index;
+	uint64_t ns;
+};
+
+static int compare_time(const void *a, const void *b)
+{
+	uint64_t ta = ((const struct report_entry *)a)->ns;
+	uint64_t tb = ((const struct report_entry *)b)->ns;
+	return ta < tb ? 1 : (ta > tb ? -1 : 0);
+}
+
+void glplatform_profile_dump(FILE *out)
+{
+	struct profile_thread *profile = t_profile;
+	struct report_entry order[NUM_PROFILE_ENTRY_POINTS];
+	int count = 0, i;
+	uint64_t total_calls = 0, total_ns = 0;
+
+	if (!profile) {
+		fprintf(out, "glplatform profile: no calls recorded in this thread\n");
+		return;
+	}
+	for (i = 0; i < NUM_PROFILE_ENTRY_POINTS; i++) {
+		if (!profile->last_frame[i].calls)
+			continue;
+		order[count].index = i;
+		order[count].ns = profile->last_frame[i].ns;
+		count++;
+		total_calls += profile->last_frame[i].calls;
+		total_ns += profile->last_frame[i].ns;
+	}
+	qsort(order, count, sizeof(struct report_entry), compare_time);
+
+	fprintf(out, "glplatform profile: frame %llu, %llu calls, %.3f ms\n",
+		(unsigned long long)profile->frame_count,
+		(unsigned long long)total_calls,
+		total_ns * 1e-6);
+	fprintf(out, "%-40s %10s %12s %10s\n", "function", "calls", "total us", "avg ns");
+	for (i = 0; i < count; i++) {
+		const struct profile_counters *c = profile->last_frame + order[i].index;
+		fprintf(out, "%-40s %10llu %12.1f %10.1f\n",
+			g_names[order[i].index],
+			(unsigned long long)c->calls,
+			c->ns * 1e-3,
+			(double)c->ns / c->calls);
+	}
+}
+
+#else
+
+bool glplatform_profile_enable(bool enable)
+{
+	return !enable;
+}
+
+void glplatform_profile_end_frame()
+{
+}
+
+void glplatform_profile_dump(FILE *out)
+{
+	fprintf(out, "glplatform profile: not available, configure with --enable-profile\n");
+}
+
+#endif
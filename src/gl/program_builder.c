@@ -0,0 +1,314 @@
+#include "glutil.h"
+#include "priv.h"
+
+#define GLPLATFORM_GL_VERSION 33
+#define GLPLATFORM_ENABLE_GL_ARB_get_program_binary
+#include "glcore.h"
+#define GLPLATFORM_GL_USE_DISPATCH
+#include "glcore_dispatch.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+//
+// KHR_parallel_shader_compile and ARB_parallel_shader_compile aren't part of
+// the generated bindings. Both share these values and the only entry point
+// differs in its suffix.
+//
+#define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91B0
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+
+#define MAX_STAGES 6
+#define INFO_LOG_SIZE 4096
+
+enum build_modes {
+	//Compiles are queued and completion is polled with GL_COMPLETION_STATUS_KHR
+	MODE_PARALLEL,
+
+	//Programs are built on loader threads with shared contexts
+	MODE_LOADER,
+
+	//Compiles are queued and glplatform_program_builder_poll() waits for them
+	MODE_DEFERRED
+};
+
+struct build {
+	struct glplatform_program_builder *builder;
+	GLuint program;
+	GLuint shaders[MAX_STAGES];
+	int num_shaders;
+	uint64_t key;
+	void (*done)(uint32_t program, const char *info_log, void *user_data);
+	void *user_data;
+
+	//Copy of the sources and the build's log for MODE_LOADER
+	struct glplatform_shader_source *sources;
+	int count;
+	char *info_log;
+
+	struct build *next;
+};
+
+struct glplatform_program_builder {
+	enum build_modes mode;
+	struct glplatform_loader *loader;
+	struct build *pending;
+	int num_pending;
+	bool destroyed;
+};
+
+//Entry points use the platform's OpenGL calling convention, which
+//windows.h defines as APIENTRY
+#ifndef APIENTRY
+#define APIENTRY
+#endif
+
+typedef void (APIENTRY *max_shader_compiler_threads_t)(GLuint count);
+
+static void *get_proc_address(const char *name)
+{
+#ifdef _WIN32
+	return (void *)wglGetProcAddress(name);
+#else
+	return (void *)glXGetProcAddress((const GLubyte *)name);
+#endif
+}
+
+static bool has_extension(const char *name)
+{
+	GLint num_extensions = 0;
+	int i;
+	glGetIntegerv(GL_NUM_EXTENSIONS, &num_extensions);
+	for (i = 0; i < num_extensions; i++) {
+		const char *ext = (const char *)glGetStringi(GL_EXTENSIONS, i);
+		if (ext && !strcmp(ext, name))
+			return true;
+	}
+	return false;
+}
+
+//
+// Enable driver side parallel compilation. Returns false if the driver
+// doesn't support it.
+//
+static bool init_parallel_compile()
+{
+	max_shader_compiler_threads_t max_threads = NULL;
+	if (has_extension("GL_KHR_parallel_shader_compile"))
+		max_threads = (max_shader_compiler_threads_t)get_proc_address("glMaxShaderCompilerThreadsKHR");
+	else if (has_extension("GL_ARB_parallel_shader_compile"))
+		max_threads = (max_shader_compiler_threads_t)get_proc_address("glMaxShaderCompilerThreadsARB");
+	if (!max_threads)
+		return false;
+	//Let the driver pick the thread count
+	max_threads(0xffffffff);
+	return true;
+}
+
+struct glplatform_program_builder *glplatform_program_builder_create(struct glplatform_loader *loader)
+{
+	struct glplatform_program_builder *builder = calloc(1, sizeof(struct glplatform_program_builder));
+	if (!builder)
+		return NULL;
+	if (init_parallel_compile())
+		builder->mode = MODE_PARALLEL;
+#ifndef _WIN32
+	else if (loader)
+		builder->mode = MODE_LOADER;
+#endif
+	else
+		builder->mode = MODE_DEFERRED;
+	builder->loader = loader;
+	return builder;
+}
+
+static void free_build(struct build *build)
+{
+	free(build->sources);
+	free(build->info_log);
+	free(build);
+}
+
+//
+// Queue the compiles and link of a build without waiting for any of them
+//
+static void start_build(struct build *build, const struct glplatform_shader_source *shaders, int count)
+{
+	int i;
+	build->program = glCreateProgram();
+	for (i = 0; i < count; i++) {
+		GLuint shader = glCreateShader(shaders[i].type);
+		glShaderSource(shader, 1, &shaders[i].source, NULL);
+		glCompileShader(shader);
+		glAttachShader(build->program, shader);
+		build->shaders[build->num_shaders++] = shader;
+	}
+	if (build->key)
+		glProgramParameteri(build->program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+	glLinkProgram(build->program);
+}
+
+//
+// Collect the result of a build started with start_build(). Returns the
+// program or 0 with the failing compile or link log in 'info_log'.
+//
+static GLuint finish_build(struct build *build, char *info_log)
+{
+	GLuint program = build->program;
+	GLint success;
+	int i;
+
+	glGetProgramiv(program, GL_LINK_STATUS, &success);
+	if (!success) {
+		info_log[0] = 0;
+		for (i = 0; i < build->num_shaders; i++) {
+			glGetShaderiv(build->shaders[i], GL_COMPILE_STATUS, &success);
+			if (!success) {
+				glGetShaderInfoLog(build->shaders[i], INFO_LOG_SIZE, NULL, info_log);
+				break;
+			}
+		}
+		if (i == build->num_shaders)
+			glGetProgramInfoLog(program, INFO_LOG_SIZE, NULL, info_log);
+		glDeleteProgram(program);
+		program = 0;
+	} else {
+		glplatform_program_cache_store(build->key, program);
+	}
+	for (i = 0; i < build->num_shaders; i++) {
+		if (program)
+			glDetachShader(program, build->shaders[i]);
+		glDeleteShader(build->shaders[i]);
+	}
+	return program;
+}
+
+#ifndef _WIN32
+static void loader_build(void *arg)
+{
+	struct build *build = (struct build *)arg;
+	build->program = glplatform_program_create(build->sources, build->count, build->info_log, INFO_LOG_SIZE);
+}
+
+static void loader_build_done(void *arg)
+{
+	struct build *build = (struct build *)arg;
+	struct glplatform_program_builder *builder = build->builder;
+	builder->num_pending--;
+	if (builder->destroyed) {
+		glDeleteProgram(build->program);
+		if (!builder->num_pending)
+			free(builder);
+	} else {
+		build->done(build->program, build->program ? NULL : build->info_log, build->user_data);
+	}
+	free_build(build);
+}
+
+//
+// Copy the sources so the caller's strings can be freed before the build
+// runs
+//
+static bool copy_sources(struct build *build, const struct glplatform_shader_source *shaders, int count)
+{
+	size_t size = sizeof(struct glplatform_shader_source) * count;
+	int i;
+	for (i = 0; i < count; i++)
+		size += strlen(shaders[i].source) + 1;
+	build->sources = malloc(size);
+	build->info_log = malloc(INFO_LOG_SIZE);
+	if (!build->sources || !build->info_log)
+		return false;
+	char *p = (char *)(build->sources + count);
+	for (i = 0; i < count; i++) {
+		size_t length = strlen(shaders[i].source) + 1;
+		memcpy(p, shaders[i].source, length);
+		build->sources[i].type = shaders[i].type;
+		build->sources[i].source = p;
+		p += length;
+	}
+	build->info_log[0] = 0;
+	build->count = count;
+	return true;
+}
+#endif
+
+bool glplatform_program_builder_submit(struct glplatform_program_builder *builder,
+		const struct glplatform_shader_source *shaders, int count,
+		void (*done)(uint32_t program, const char *info_log, void *user_data),
+		void *user_data)
+{
+	if (count <= 0 || count > MAX_STAGES || !done)
+		return false;
+	struct build *build = calloc(1, sizeof(struct build));
+	if (!build)
+		return false;
+	build->builder = builder;
+	build->done = done;
+	build->user_data = user_data;
+
+#ifndef _WIN32
+	if (builder->mode == MODE_LOADER) {
+		if (!copy_sources(build, shaders, count) ||
+				!glplatform_loader_submit(builder->loader, loader_build, loader_build_done, build)) {
+			free_build(build);
+			return false;
+		}
+		builder->num_pending++;
+		return true;
+	}
+#endif
+	build->program = glplatform_program_cache_load(shaders, count, &build->key);
+	if (!build->program)
+		start_build(build, shaders, count);
+	build->next = builder->pending;
+	builder->pending = build;
+	builder->num_pending++;
+	return true;
+}
+
+int glplatform_program_builder_poll(struct glplatform_program_builder *builder)
+{
+	char info_log[INFO_LOG_SIZE];
+	struct build **prev = &builder->pending;
+
+	while (*prev) {
+		struct build *build = *prev;
+		GLuint program = build->program;
+		if (build->num_shaders) {
+			if (builder->mode == MODE_PARALLEL) {
+				GLint complete = GL_FALSE;
+				glGetProgramiv(build->program, GL_COMPLETION_STATUS_KHR, &complete);
+				if (!complete) {
+					prev = &build->next;
+					continue;
+				}
+			}
+			program = finish_build(build, info_log);
+		}
+		*prev = build->next;
+		builder->num_pending--;
+		build->done(program, program ? NULL : info_log, build->user_data);
+		free_build(build);
+	}
+	return builder->num_pending;
+}
+
+void glplatform_program_builder_destroy(struct glplatform_program_builder *builder)
+{
+	char info_log[INFO_LOG_SIZE];
+	if (!builder)
+		return;
+	while (builder->pending) {
+		struct build *build = builder->pending;
+		builder->pending = build->next;
+		builder->num_pending--;
+		glDeleteProgram(build->num_shaders ? finish_build(build, info_log) : build->program);
+		free_build(build);
+	}
+	//Builds running on loader threads free the builder when the last one is done
+	if (builder->num_pending)
+		builder->destroyed = true;
+	else
+		free(builder);
+}
@@ -0,0 +1,362 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "glutil.h"
+#include "priv.h"
+
+#define GLPLATFORM_GL_VERSION 33
+#define GLPLATFORM_ENABLE_GL_ARB_get_program_binary
+#include "glcore.h"
+#define GLPLATFORM_GL_USE_DISPATCH
+#include "glcore_dispatch.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdatomic.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <direct.h>
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+#define CACHE_MAGIC "GLPPROG"
+#define CACHE_VERSION 1
+
+#define FNV_OFFSET 14695981039346656037ull
+#define FNV_PRIME 1099511628211ull
+
+//
+// Cache files are named after the key's hash and start with this header,
+// followed by the program binary.
+//
+struct cache_header {
+	char magic[8];
+	uint32_t version;
+	uint32_t format;
+	uint64_t key;
+	uint64_t length;
+};
+
+enum path_states {
+	PATH_UNSET,
+	PATH_INITIALIZING,
+	PATH_SET
+};
+
+static _Atomic(char *) g_path;
+static atomic_int g_path_state;
+
+//Makes temporary file names unique between threads storing the same key
+static atomic_uint g_tmp_serial;
+
+static struct {
+	atomic_uint_fast64_t hits;
+	atomic_uint_fast64_t misses;
+	atomic_uint_fast64_t stores;
+} g_counters;
+
+static uint64_t fnv1a(uint64_t hash, const void *data, size_t size)
+{
+	const uint8_t *bytes = (const uint8_t *)data;
+	size_t i;
+	for (i = 0; i < size; i++)
+		hash = (hash ^ bytes[i]) * FNV_PRIME;
+	return hash;
+}
+
+static uint64_t hash_string(uint64_t hash, const char *str)
+{
+	//Include the terminator so adjacent strings can't run together
+	return str ? fnv1a(hash, str, strlen(str) + 1) : fnv1a(hash, "", 1);
+}
+
+static uint64_t program_key(const struct glplatform_shader_source *shaders, int count)
+{
+	uint64_t hash = FNV_OFFSET;
+	int i;
+	hash = hash_string(hash, (const char *)glGetString(GL_VENDOR));
+	hash = hash_string(hash, (const char *)glGetString(GL_RENDERER));
+	hash = hash_string(hash, (const char *)glGetString(GL_VERSION));
+	for (i = 0; i < count; i++) {
+		hash = fnv1a(hash, &shaders[i].type, sizeof(shaders[i].type));
+		hash = hash_string(hash, shaders[i].source);
+	}
+	//Zero means no key
+	return hash ? hash : 1;
+}
+
+static int make_dir(const char *path)
+{
+#ifdef _WIN32
+	return _mkdir(path);
+#else
+	return mkdir(path, 0755);
+#endif
+}
+
+//
+// Create 'path' and any missing parents
+//
+static void make_dirs(const char *path)
+{
+	char *p = strdup(path);
+	char *c;
+	if (!p)
+		return;
+	for (c = p + 1; *c; c++) {
+		if (*c == '/' || *c == '\\') {
+			char sep = *c;
+			*c = 0;
+			make_dir(p);
+			*c = sep;
+		}
+	}
+	make_dir(p);
+	free(p);
+}
+
+static char *default_path()
+{
+	const char *base;
+	const char *suffix;
+	char *path;
+#ifdef _WIN32
+	base = getenv("LOCALAPPDATA");
+	suffix = "\\glplatform";
+#else
+	base = getenv("XDG_CACHE_HOME");
+	suffix = "/glplatform";
+	if (!base || !base[0]) {
+		base = getenv("HOME");
+		suffix = "/.cache/glplatform";
+	}
+#endif
+	if (!base || !base[0])
+		return NULL;
+	path = malloc(strlen(base) + strlen(suffix) + 1);
+	if (!path)
+		return NULL;
+	strcpy(path, base);
+	strcat(path, suffix);
+	return path;
+}
+
+//
+// The default path is set up on first use, which may happen on several
+// loader threads at once.
+//
+static const char *cache_path()
+{
+	int expected = PATH_UNSET;
+	if (atomic_compare_exchange_strong(&g_path_state, &expected, PATH_INITIALIZING)) {
+		char *path = default_path();
+		if (path)
+			make_dirs(path);
+		atomic_store(&g_path, path);
+		atomic_store(&g_path_state, PATH_SET);
+	}
+	while (atomic_load(&g_path_state) != PATH_SET);
+	return atomic_load(&g_path);
+}
+
+//
+// Builds on loader threads may be using the current path, so it is replaced
+// atomically and the previous string is never freed. The path is expected to
+// change rarely.
+//
+void glplatform_program_cache_set_path(const char *path)
+{
+	char *new_path = path ? strdup(path) : NULL;
+	int expected = PATH_UNSET;
+	if (new_path)
+		make_dirs(new_path);
+	//Let a default path being set up finish first so it doesn't replace this one
+	if (!atomic_compare_exchange_strong(&g_path_state, &expected, PATH_INITIALIZING))
+		while (atomic_load(&g_path_state) != PATH_SET);
+	atomic_store(&g_path, new_path);
+	atomic_store(&g_path_state, PATH_SET);
+}
+
+static bool cache_supported()
+{
+	GLint num_formats = 0;
+	if (!GLPLATFORM_GL_ARB_get_program_binary || !cache_path())
+		return false;
+	glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &num_formats);
+	return num_formats > 0;
+}
+
+static void cache_file_name(char *name, size_t size, uint64_t key)
+{
+	snprintf(name, size, "%s/%016llx.bin", cache_path(), (unsigned long long)key);
+}
+
+static GLuint load_program(uint64_t key)
+{
+	char name[4096];
+	struct cache_header header;
+	GLuint program = 0;
+	void *binary;
+	GLint success;
+
+	cache_file_name(name, sizeof(name), key);
+	FILE *f = fopen(name, "rb");
+	if (!f)
+		return 0;
+	if (fread(&header, sizeof(header), 1, f) != 1 ||
+			memcmp(header.magic, CACHE_MAGIC, sizeof(header.magic)) ||
+			header.version != CACHE_VERSION ||
+			header.key != key ||
+			header.length == 0 || header.length > INT32_MAX)
+		goto error0;
+	binary = malloc(header.length);
+	if (!binary)
+		goto error0;
+	if (fread(binary, header.length, 1, f) != 1)
+		goto error1;
+
+	program = glCreateProgram();
+	glProgramBinary(program, header.format, binary, header.length);
+	glGetProgramiv(program, GL_LINK_STATUS, &success);
+	if (!success) {
+		//Rejected by the driver, the binary is replaced after rebuilding
+		glDeleteProgram(program);
+		program = 0;
+	}
+error1:
+	free(binary);
+error0:
+	fclose(f);
+	return program;
+}
+
+static void store_program(uint64_t key, GLuint program)
+{
+	char name[4096];
+	char tmp_name[4096 + 32];
+	struct cache_header header;
+	GLint length = 0;
+	GLenum format;
+	void *binary;
+	bool ok;
+
+	glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+	if (length <= 0)
+		return;
+	binary = malloc(length);
+	if (!binary)
+		return;
+	glGetProgramBinary(program, length, &length, &format, binary);
+
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, CACHE_MAGIC, sizeof(header.magic));
+	header.version = CACHE_VERSION;
+	header.format = format;
+	header.key = key;
+	header.length = length;
+
+	//Write to a temporary file first so readers never see a partial binary
+	cache_file_name(name, sizeof(name), key);
+	unsigned serial = atomic_fetch_add(&g_tmp_serial, 1);
+#ifdef _WIN32
+	snprintf(tmp_name, sizeof(tmp_name), "%s.%d.%u", name, _getpid(), serial);
+#else
+	snprintf(tmp_name, sizeof(tmp_name), "%s.%d.%u", name, (int)getpid(), serial);
+#endif
+	FILE *f = fopen(tmp_name, "wb");
+	if (!f)
+		goto error0;
+	ok = fwrite(&header, sizeof(header), 1, f) == 1 &&
+		fwrite(binary, length, 1, f) == 1;
+	ok = !fclose(f) && ok;
+#ifdef _WIN32
+	if (ok)
+		remove(name);
+#endif
+	if (ok && !rename(tmp_name, name))
+		glplatform_count(&g_counters.stores);
+	else
+		remove(tmp_name);
+error0:
+	free(binary);
+}
+
+static GLuint build_program(const struct glplatform_shader_source *shaders, int count,
+		char *info_log, size_t info_log_size, bool retrievable)
+{
+	GLuint program = glCreateProgram();
+	GLint success;
+	int i;
+
+	for (i = 0; i < count; i++) {
+		GLuint shader = glCreateShader(shaders[i].type);
+		glShaderSource(shader, 1, &shaders[i].source, NULL);
+		glCompileShader(shader);
+		glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+		if (!success) {
+			if (info_log && info_log_size)
+				glGetShaderInfoLog(shader, info_log_size, NULL, info_log);
+			glDeleteShader(shader);
+			goto error0;
+		}
+		glAttachShader(program, shader);
+		//Flagged for deletion, freed with the program
+		glDeleteShader(shader);
+	}
+	if (retrievable)
+		glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+	glLinkProgram(program);
+	glGetProgramiv(program, GL_LINK_STATUS, &success);
+	if (!success) {
+		if (info_log && info_log_size)
+			glGetProgramInfoLog(program, info_log_size, NULL, info_log);
+		goto error0;
+	}
+	return program;
+error0:
+	glDeleteProgram(program);
+	return 0;
+}
+
+uint32_t glplatform_program_cache_load(const struct glplatform_shader_source *shaders, int count, uint64_t *key)
+{
+	GLuint program;
+	*key = 0;
+	if (!cache_supported())
+		return 0;
+	*key = program_key(shaders, count);
+	program = load_program(*key);
+	if (program)
+		glplatform_count(&g_counters.hits);
+	else
+		glplatform_count(&g_counters.misses);
+	return program;
+}
+
+void glplatform_program_cache_store(uint64_t key, uint32_t program)
+{
+	if (key)
+		store_program(key, program);
+}
+
+uint32_t glplatform_program_create(const struct glplatform_shader_source *shaders, int count,
+		char *info_log, size_t info_log_size)
+{
+	uint64_t key;
+	GLuint program = glplatform_program_cache_load(shaders, count, &key);
+	if (program)
+		return program;
+	program = build_program(shaders, count, info_log, info_log_size, key != 0);
+	if (program)
+		glplatform_program_cache_store(key, program);
+	return program;
+}
+
+void glplatform_program_cache_get_stats(struct glplatform_program_cache_stats *stats)
+{
+	stats->hits = atomic_load_explicit(&g_counters.hits, memory_order_relaxed);
+	stats->misses = atomic_load_explicit(&g_counters.misses, memory_order_relaxed);
+	stats->stores = atomic_load_explicit(&g_counters.stores, memory_order_relaxed);
+}
@@ -0,0 +1,349 @@
+#include "glutil.h"
+#include "priv.h"
+
+#define GLPLATFORM_GL_VERSION 33
+#include "glcore.h"
+#define GLPLATFORM_GL_USE_DISPATCH
+#include "glcore_dispatch.h"
+
+#include <stdlib.h>
+
+//
+// Free targets unused for this many frames are evicted
+//
+#define MAX_IDLE_FRAMES 120
+
+struct glplatform_rt_pool {
+	struct glplatform_win *win;
+	size_t budget;
+	size_t free_size;
+	uint64_t frame;
+	uint32_t generation;
+	int win_width;
+	int win_height;
+	struct glplatform_render_target *targets;
+};
+
+static bool is_depth_format(GLenum format)
+{
+	switch (format) {
+	case GL_DEPTH_COMPONENT16:
+	case GL_DEPTH_COMPONENT24:
+	case GL_DEPTH_COMPONENT32:
+	case GL_DEPTH_COMPONENT32F:
+	case GL_DEPTH24_STENCIL8:
+	case GL_DEPTH32F_STENCIL8:
+		return true;
+	default:
+		return false;
+	}
+}
+
+//
+// Pixel type for the NULL data of an integer format, or 0 if 'format'
+// isn't an integer format
+//
+static GLenum integer_pixel_type(GLenum format)
+{
+	switch (format) {
+	case GL_R8I:
+	case GL_R16I:
+	case GL_R32I:
+	case GL_RG8I:
+	case GL_RG16I:
+	case GL_RG32I:
+	case GL_RGBA8I:
+	case GL_RGBA16I:
+	case GL_RGBA32I:
+		return GL_INT;
+	case GL_R8UI:
+	case GL_R16UI:
+	case GL_R32UI:
+	case GL_RG8UI:
+	case GL_RG16UI:
+	case GL_RG32UI:
+	case GL_RGB10_A2UI:
+	case GL_RGBA8UI:
+	case GL_RGBA16UI:
+	case GL_RGBA32UI:
+		return GL_UNSIGNED_INT;
+	default:
+		return 0;
+	}
+}
+
+static GLenum depth_attachment(GLenum format)
+{
+	if (format == GL_DEPTH24_STENCIL8 || format == GL_DEPTH32F_STENCIL8)
+		return GL_DEPTH_STENCIL_ATTACHMENT;
+	return GL_DEPTH_ATTACHMENT;
+}
+
+//
+// Approximate storage size of a pixel. Unknown formats are assumed
+// to be 4 bytes per pixel.
+//
+static int bytes_per_pixel(GLenum format)
+{
+	switch (format) {
+	case GL_R8:
+	case GL_R8I:
+	case GL_R8UI:
+		return 1;
+	case GL_RG8:
+	case GL_R16F:
+	case GL_R16I:
+	case GL_R16UI:
+	case GL_RG8I:
+	case GL_RG8UI:
+	case GL_DEPTH_COMPONENT16:
+		return 2;
+	case GL_RGBA16F:
+	case GL_RG32F:
+	case GL_RG32I:
+	case GL_RG32UI:
+	case GL_RGBA16I:
+	case GL_RGBA16UI:
+	case GL_DEPTH32F_STENCIL8:
+		return 8;
+	case GL_RGBA32F:
+	case GL_RGBA32I:
+	case GL_RGBA32UI:
+		return 16;
+	default:
+		return 4;
+	}
+}
+
+static void delete_target(struct glplatform_render_target *target)
+{
+	glDeleteFramebuffers(1, &target->framebuffer);
+	glDeleteTextures(1, &target->texture);
+	free(target);
+}
+
+//
+// Create a target. Targets may be acquired in the middle of a pass so the
+// application's texture and framebuffer bindings are restored.
+//
+static struct glplatform_render_target *create_target(int width, int height, GLenum format, int samples)
+{
+	GLint prev_texture, prev_draw_framebuffer, prev_read_framebuffer;
+	struct glplatform_render_target *target = calloc(1, sizeof(struct glplatform_render_target));
+	if (!target)
+		return NULL;
+	target->width = width;
+	target->height = height;
+	target->format = format;
+	target->samples = samples;
+	target->size = (size_t)width * height * bytes_per_pixel(format) * (samples > 1 ? samples : 1);
+
+	GLenum tex_target = samples > 1 ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D;
+	glGetIntegerv(samples > 1 ? GL_TEXTURE_BINDING_2D_MULTISAMPLE : GL_TEXTURE_BINDING_2D, &prev_texture);
+	glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &prev_draw_framebuffer);
+	glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &prev_read_framebuffer);
+	glGenTextures(1, &target->texture);
+	glBindTexture(tex_target, target->texture);
+	if (samples > 1) {
+		glTexImage2DMultisample(tex_target, samples, format, width, height, GL_TRUE);
+	} else {
+		//The format and type are only used to validate the NULL pixel data
+		GLenum pixel_format = GL_RGBA;
+		GLenum pixel_type = GL_FLOAT;
+		//Integer formats can't be filtered
+		GLenum filter = GL_LINEAR;
+		if (integer_pixel_type(format)) {
+			pixel_format = GL_RGBA_INTEGER;
+			pixel_type = integer_pixel_type(format);
+			filter = GL_NEAREST;
+		} else if (format == GL_DEPTH24_STENCIL8) {
+			pixel_format = GL_DEPTH_STENCIL;
+			pixel_type = GL_UNSIGNED_INT_24_8;
+		} else if (format == GL_DEPTH32F_STENCIL8) {
+			pixel_format = GL_DEPTH_STENCIL;
+			pixel_type = GL_FLOAT_32_UNSIGNED_INT_24_8_REV;
+		} else if (is_depth_format(format)) {
+			pixel_format = GL_DEPTH_COMPONENT;
+		}
+		glTexImage2D(tex_target, 0, format, width, height, 0, pixel_format, pixel_type, NULL);
+		glTexParameteri(tex_target, GL_TEXTURE_MIN_FILTER, filter);
+		glTexParameteri(tex_target, GL_TEXTURE_MAG_FILTER, filter);
+		glTexParameteri(tex_target, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(tex_target, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	}
+	glBindTexture(tex_target, prev_texture);
+
+	glGenFramebuffers(1, &target->framebuffer);
+	glBindFramebuffer(GL_FRAMEBUFFER, target->framebuffer);
+	glFramebufferTexture2D(GL_FRAMEBUFFER,
+		is_depth_format(format) ? depth_attachment(format) : GL_COLOR_ATTACHMENT0,
+		tex_target, target->texture, 0);
+	//Without a color attachment drivers before GL 4.1 also require no read buffer
+	if (is_depth_format(format)) {
+		glDrawBuffer(GL_NONE);
+		glReadBuffer(GL_NONE);
+	}
+	GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+	glBindFramebuffer(GL_DRAW_FRAMEBUFFER, prev_draw_framebuffer);
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, prev_read_framebuffer);
+
+	if (status != GL_FRAMEBUFFER_COMPLETE) {
+		delete_target(target);
+		return NULL;
+	}
+	return target;
+}
+
+//
+// Delete free targets that match 'pred', unlinking them from the pool
+//
+static void evict(struct glplatform_rt_pool *pool, bool (*pred)(struct glplatform_rt_pool *, struct glplatform_render_target *))
+{
+	struct glplatform_render_target **pos = &pool->targets;
+	while (*pos) {
+		struct glplatform_render_target *target = *pos;
+		if (!target->in_use && pred(pool, target)) {
+			*pos = target->next;
+			pool->free_size -= target->size;
+			delete_target(target);
+		} else {
+			pos = &target->next;
+		}
+	}
+}
+
+//
+// Window sized targets acquired before the last resize
+//
+static bool stale_target(struct glplatform_rt_pool *pool, struct glplatform_render_target *target)
+{
+	return target->win_sized && target->generation != pool->generation;
+}
+
+static bool idle_target(struct glplatform_rt_pool *pool, struct glplatform_render_target *target)
+{
+	return target->last_used + MAX_IDLE_FRAMES < pool->frame;
+}
+
+static void enforce_budget(struct glplatform_rt_pool *pool)
+{
+	while (pool->free_size > pool->budget) {
+		struct glplatform_render_target **pos;
+		struct glplatform_render_target **lru = NULL;
+		for (pos = &pool->targets; *pos; pos = &(*pos)->next) {
+			if (!(*pos)->in_use && (!lru || (*pos)->last_used < (*lru)->last_used))
+				lru = pos;
+		}
+		if (!lru)
+			break;
+		struct glplatform_render_target *target = *lru;
+		*lru = target->next;
+		pool->free_size -= target->size;
+		delete_target(target);
+	}
+}
+
+//
+// Targets sized for the previous window size are useless after a resize.
+// Targets with a fixed size are kept.
+//
+static void check_resize(struct glplatform_rt_pool *pool)
+{
+	if (pool->win->width != pool->win_width || pool->win->height != pool->win_height) {
+		pool->win_width = pool->win->width;
+		pool->win_height = pool->win->height;
+		pool->generation++;
+		evict(pool, stale_target);
+	}
+}
+
+struct glplatform_rt_pool *glplatform_rt_pool_create(struct glplatform_win *win, size_t budget_bytes)
+{
+	struct glplatform_rt_pool *pool = calloc(1, sizeof(struct glplatform_rt_pool));
+	if (!pool)
+		return NULL;
+	pool->win = win;
+	pool->budget = budget_bytes;
+	pool->win_width = win->width;
+	pool->win_height = win->height;
+	return pool;
+}
+
+void glplatform_rt_pool_destroy(struct glplatform_rt_pool *pool)
+{
+	while (pool->targets) {
+		struct glplatform_render_target *target = pool->targets;
+		pool->targets = target->next;
+		delete_target(target);
+	}
+	free(pool);
+}
+
+const struct glplatform_render_target *glplatform_rt_acquire(struct glplatform_rt_pool *pool,
+		int width, int height, uint32_t format, int samples)
+{
+	struct glplatform_render_target *target;
+	struct glplatform_render_target *best = NULL;
+	bool win_sized = width <= 0 || height <= 0;
+
+	check_resize(pool);
+	if (width <= 0)
+		width = pool->win->width;
+	if (height <= 0)
+		height = pool->win->height;
+	if (samples < 1)
+		samples = 1;
+
+	//Prefer the most recently used match, it is the most likely to be resident
+	for (target = pool->targets; target; target = target->next) {
+		if (target->in_use ||
+				target->width != width ||
+				target->height != height ||
+				target->format != format ||
+				target->samples != samples ||
+				target->win_sized != win_sized)
+			continue;
+		if (!best || target->last_used > best->last_used)
+			best = target;
+	}
+
+	if (best) {
+		pool->free_size -= best->size;
+	} else {
+		best = create_target(width, height, format, samples);
+		if (!best)
+			return NULL;
+		best->next = pool->targets;
+		pool->targets = best;
+	}
+	best->in_use = true;
+	best->win_sized = win_sized;
+	best->last_used = pool->frame;
+	best->generation = pool->generation;
+	return best;
+}
+
+void glplatform_rt_release(struct glplatform_rt_pool *pool, const struct glplatform_render_target *target_)
+{
+	struct glplatform_render_target *target = (struct glplatform_render_target *)target_;
+
+	//Handle a resize while the target is still in use so that evict() can't
+	//delete it before it has been returned
+	check_resize(pool);
+	target->in_use = false;
+	target->last_used = pool->frame;
+	pool->free_size += target->size;
+
+	//Window sized targets acquired before a resize are not reused. 'target'
+	//may be deleted by evict() and must not be used afterwards.
+	if (stale_target(pool, target))
+		evict(pool, stale_target);
+	enforce_budget(pool);
+}
+
+void glplatform_rt_pool_end_frame(struct glplatform_rt_pool *pool)
+{
+	pool->frame++;
+	check_resize(pool);
+	evict(pool, idle_target);
+}
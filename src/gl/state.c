@@ -0,0 +1,695 @@
+#include "glutil.h"
+#include "priv.h"
+
+#define GLPLATFORM_GL_VERSION 45
+#include "glcore.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_SHADOW_UNITS 32
+#define UNKNOWN_NAME ((GLuint)~0)
+
+enum texture_targets {
+	TEX_1D,
+	TEX_2D,
+	TEX_3D,
+	TEX_1D_ARRAY,
+	TEX_2D_ARRAY,
+	TEX_RECTANGLE,
+	TEX_CUBE_MAP,
+	TEX_CUBE_MAP_ARRAY,
+	TEX_BUFFER,
+	TEX_2D_MULTISAMPLE,
+	TEX_2D_MULTISAMPLE_ARRAY,
+	NUM_TEXTURE_TARGETS
+};
+
+enum buffer_targets {
+	BUF_ARRAY,
+	BUF_ELEMENT_ARRAY,
+	BUF_COPY_READ,
+	BUF_COPY_WRITE,
+	BUF_PIXEL_PACK,
+	BUF_PIXEL_UNPACK,
+	BUF_TEXTURE,
+	BUF_UNIFORM,
+	BUF_TRANSFORM_FEEDBACK,
+	BUF_DRAW_INDIRECT,
+	BUF_DISPATCH_INDIRECT,
+	BUF_SHADER_STORAGE,
+	BUF_ATOMIC_COUNTER,
+	BUF_QUERY,
+	NUM_BUFFER_TARGETS
+};
+
+enum capabilities {
+	CAP_BLEND,
+	CAP_CULL_FACE,
+	CAP_DEPTH_TEST,
+	CAP_STENCIL_TEST,
+	CAP_SCISSOR_TEST,
+	CAP_POLYGON_OFFSET_FILL,
+	CAP_MULTISAMPLE,
+	CAP_FRAMEBUFFER_SRGB,
+	CAP_PRIMITIVE_RESTART,
+	CAP_RASTERIZER_DISCARD,
+	CAP_PROGRAM_POINT_SIZE,
+	CAP_DEPTH_CLAMP,
+	CAP_SAMPLE_ALPHA_TO_COVERAGE,
+	CAP_TEXTURE_CUBE_MAP_SEAMLESS,
+	NUM_CAPABILITIES
+};
+
+//
+// Shadow of the driver state for one context. UNKNOWN_NAME and a
+// negative capability value mean the filter doesn't know the driver
+// state and must forward the next call.
+//
+struct glplatform_gl_state {
+	GLuint program;
+	GLuint vertex_array;
+	GLuint draw_framebuffer;
+	GLuint read_framebuffer;
+	int active_unit;
+	GLuint textures[MAX_SHADOW_UNITS][NUM_TEXTURE_TARGETS];
+	GLuint buffers[NUM_BUFFER_TARGETS];
+	int8_t caps[NUM_CAPABILITIES];
+	bool blend_func_valid;
+	GLenum blend_func[4];
+	struct glplatform_state_filter_stats frame;
+	struct glplatform_state_filter_stats last_frame;
+	unsigned generation;
+	unsigned shared_deletes;
+};
+
+static struct {
+	void (*glUseProgram)(GLuint);
+	void (*glActiveTexture)(GLenum);
+	void (*glBindTexture)(GLenum, GLuint);
+	void (*glBindTextures)(GLuint, GLsizei, const GLuint *);
+	void (*glBindTextureUnit)(GLuint, GLuint);
+	void (*glBindBuffer)(GLenum, GLuint);
+	void (*glBindBufferBase)(GLenum, GLuint, GLuint);
+	void (*glBindBufferRange)(GLenum, GLuint, GLuint, GLintptr, GLsizeiptr);
+	void (*glBindVertexArray)(GLuint);
+	void (*glBindFramebuffer)(GLenum, GLuint);
+	void (*glEnable)(GLenum);
+	void (*glDisable)(GLenum);
+	void (*glEnablei)(GLenum, GLuint);
+	void (*glDisablei)(GLenum, GLuint);
+	void (*glBlendFunc)(GLenum, GLenum);
+	void (*glBlendFuncSeparate)(GLenum, GLenum, GLenum, GLenum);
+	void (*glBlendFunci)(GLuint, GLenum, GLenum);
+	void (*glBlendFuncSeparatei)(GLuint, GLenum, GLenum, GLenum, GLenum);
+	void (*glDeleteProgram)(GLuint);
+	void (*glDeleteTextures)(GLsizei, const GLuint *);
+	void (*glDeleteBuffers)(GLsizei, const GLuint *);
+	void (*glDeleteVertexArrays)(GLsizei, const GLuint *);
+	void (*glDeleteFramebuffers)(GLsizei, const GLuint *);
+} next;
+
+static bool g_installed;
+
+//
+// Bumped each time the filter is installed. State bound while the filter
+// was removed bypassed the shadows, so a shadow from an older generation
+// is discarded on its next use.
+//
+static atomic_uint g_generation;
+
+//
+// Programs, textures and buffers are shared between contexts of a share
+// group, so a name deleted by one context may be reused for a new object
+// that another context's shadow still shows as bound. Deleting them bumps
+// this counter and the other contexts forget all shared object bindings on
+// their next filtered call. Applications pass names between contexts with
+// their own synchronization, which also orders the counter update.
+//
+static atomic_uint g_shared_deletes;
+
+static int texture_target_index(GLenum target)
+{
+	switch (target) {
+	case GL_TEXTURE_1D: return TEX_1D;
+	case GL_TEXTURE_2D: return TEX_2D;
+	case GL_TEXTURE_3D: return TEX_3D;
+	case GL_TEXTURE_1D_ARRAY: return TEX_1D_ARRAY;
+	case GL_TEXTURE_2D_ARRAY: return TEX_2D_ARRAY;
+	case GL_TEXTURE_RECTANGLE: return TEX_RECTANGLE;
+	case GL_TEXTURE_CUBE_MAP: return TEX_CUBE_MAP;
+	case GL_TEXTURE_CUBE_MAP_ARRAY: return TEX_CUBE_MAP_ARRAY;
+	case GL_TEXTURE_BUFFER: return TEX_BUFFER;
+	case GL_TEXTURE_2D_MULTISAMPLE: return TEX_2D_MULTISAMPLE;
+	case GL_TEXTURE_2D_MULTISAMPLE_ARRAY: return TEX_2D_MULTISAMPLE_ARRAY;
+	default: return -1;
+	}
+}
+
+static int buffer_target_index(GLenum target)
+{
+	switch (target) {
+	case GL_ARRAY_BUFFER: return BUF_ARRAY;
+	case GL_ELEMENT_ARRAY_BUFFER: return BUF_ELEMENT_ARRAY;
+	case GL_COPY_READ_BUFFER: return BUF_COPY_READ;
+	case GL_COPY_WRITE_BUFFER: return BUF_COPY_WRITE;
+	case GL_PIXEL_PACK_BUFFER: return BUF_PIXEL_PACK;
+	case GL_PIXEL_UNPACK_BUFFER: return BUF_PIXEL_UNPACK;
+	case GL_TEXTURE_BUFFER: return BUF_TEXTURE;
+	case GL_UNIFORM_BUFFER: return BUF_UNIFORM;
+	case GL_TRANSFORM_FEEDBACK_BUFFER: return BUF_TRANSFORM_FEEDBACK;
+	case GL_DRAW_INDIRECT_BUFFER: return BUF_DRAW_INDIRECT;
+	case GL_DISPATCH_INDIRECT_BUFFER: return BUF_DISPATCH_INDIRECT;
+	case GL_SHADER_STORAGE_BUFFER: return BUF_SHADER_STORAGE;
+	case GL_ATOMIC_COUNTER_BUFFER: return BUF_ATOMIC_COUNTER;
+	case GL_QUERY_BUFFER: return BUF_QUERY;
+	default: return -1;
+	}
+}
+
+static int capability_index(GLenum cap)
+{
+	switch (cap) {
+	case GL_BLEND: return CAP_BLEND;
+	case GL_CULL_FACE: return CAP_CULL_FACE;
+	case GL_DEPTH_TEST: return CAP_DEPTH_TEST;
+	case GL_STENCIL_TEST: return CAP_STENCIL_TEST;
+	case GL_SCISSOR_TEST: return CAP_SCISSOR_TEST;
+	case GL_POLYGON_OFFSET_FILL: return CAP_POLYGON_OFFSET_FILL;
+	case GL_MULTISAMPLE: return CAP_MULTISAMPLE;
+	case GL_FRAMEBUFFER_SRGB: return CAP_FRAMEBUFFER_SRGB;
+	case GL_PRIMITIVE_RESTART: return CAP_PRIMITIVE_RESTART;
+	case GL_RASTERIZER_DISCARD: return CAP_RASTERIZER_DISCARD;
+	case GL_PROGRAM_POINT_SIZE: return CAP_PROGRAM_POINT_SIZE;
+	case GL_DEPTH_CLAMP: return CAP_DEPTH_CLAMP;
+	case GL_SAMPLE_ALPHA_TO_COVERAGE: return CAP_SAMPLE_ALPHA_TO_COVERAGE;
+	case GL_TEXTURE_CUBE_MAP_SEAMLESS: return CAP_TEXTURE_CUBE_MAP_SEAMLESS;
+	default: return -1;
+	}
+}
+
+static void invalidate_state(struct glplatform_gl_state *state)
+{
+	state->program = UNKNOWN_NAME;
+	state->vertex_array = UNKNOWN_NAME;
+	state->draw_framebuffer = UNKNOWN_NAME;
+	state->read_framebuffer = UNKNOWN_NAME;
+	state->active_unit = -1;
+	memset(state->textures, 0xff, sizeof(state->textures));
+	memset(state->buffers, 0xff, sizeof(state->buffers));
+	memset(state->caps, -1, sizeof(state->caps));
+	state->blend_func_valid = false;
+}
+
+static void forget_shared_objects(struct glplatform_gl_state *state)
+{
+	state->program = UNKNOWN_NAME;
+	memset(state->textures, 0xff, sizeof(state->textures));
+	memset(state->buffers, 0xff, sizeof(state->buffers));
+}
+
+static struct glplatform_gl_state *get_state()
+{
+	struct glplatform_context *context = glplatform_get_context_priv();
+	if (!context)
+		return NULL;
+	if (!context->gl_state) {
+		struct glplatform_gl_state *state = calloc(1, sizeof(struct glplatform_gl_state));
+		if (!state)
+			return NULL;
+		invalidate_state(state);
+		state->generation = atomic_load_explicit(&g_generation, memory_order_relaxed);
+		state->shared_deletes = atomic_load_explicit(&g_shared_deletes, memory_order_relaxed);
+		context->gl_state = state;
+	}
+	unsigned generation = atomic_load_explicit(&g_generation, memory_order_relaxed);
+	if (context->gl_state->generation != generation) {
+		invalidate_state(context->gl_state);
+		context->gl_state->generation = generation;
+	}
+	unsigned shared_deletes = atomic_load_explicit(&g_shared_deletes, memory_order_relaxed);
+	if (context->gl_state->shared_deletes != shared_deletes) {
+		forget_shared_objects(context->gl_state);
+		context->gl_state->shared_deletes = shared_deletes;
+	}
+	return context->gl_state;
+}
+
+//
+// Returns true if the call should be dropped. 'cur' is updated to
+// the new value when the call is forwarded.
+//
+static inline bool filter_name(struct glplatform_gl_state *state, GLuint *cur, GLuint name)
+{
+	state->frame.calls++;
+	if (*cur == name) {
+		state->frame.elided++;
+		return true;
+	}
+	*cur = name;
+	return false;
+}
+
+static void filter_glUseProgram(GLuint program)
+{
+	struct glplatform_gl_state *state = get_state();
+	if (state && filter_name(state, &state->program, program))
+		return;
+	next.glUseProgram(program);
+}
+
+static void filter_glActiveTexture(GLenum texture)
+{
+	struct glplatform_gl_state *state = get_state();
+	if (state) {
+		int unit = texture - GL_TEXTURE0;
+		state->frame.calls++;
+		if (unit == state->active_unit) {
+			state->frame.elided++;
+			return;
+		}
+		state->active_unit = unit;
+	}
+	next.glActiveTexture(texture);
+}
+
+static void filter_glBindTexture(GLenum target, GLuint texture)
+{
+	struct glplatform_gl_state *state = get_state();
+	int index = texture_target_index(target);
+	if (state && index >= 0 && state->active_unit >= 0 && state->active_unit < MAX_SHADOW_UNITS) {
+		if (filter_name(state, &state->textures[state->active_unit][index], texture))
+			return;
+	}
+	next.glBindTexture(target, texture);
+}
+
+static void invalidate_units(struct glplatform_gl_state *state, GLuint first, GLsizei count)
+{
+	for (GLuint unit = first; unit < first + count && unit < MAX_SHADOW_UNITS; unit++)
+		memset(state->textures[unit], 0xff, sizeof(state->textures[unit]));
+}
+
+static void filter_glBindTextures(GLuint first, GLsizei count, const GLuint *textures)
+{
+	struct glplatform_gl_state *state = get_state();
+	if (state)
+		invalidate_units(state, first, count);
+	next.glBindTextures(first, count, textures);
+}
+
+static void filter_glBindTextureUnit(GLuint unit, GLuint texture)
+{
+	struct glplatform_gl_state *state = get_state();
+	if (state)
+		invalidate_units(state, unit, 1);
+	next.glBindTextureUnit(unit, texture);
+}
+
+static void filter_glBindBuffer(GLenum target, GLuint buffer)
+{
+	struct glplatform_gl_state *state = get_state();
+	int index = buffer_target_index(target);
+	if (state && index >= 0) {
+		if (filter_name(state, &state->buffers[index], buffer))
+			return;
+	}
+	next.glBindBuffer(target, buffer);
+}
+
+//
+// Indexed binds also update the generic binding point
+//
+static void filter_glBindBufferBase(GLenum target, GLuint index, GLuint buffer)
+{
+	struct glplatform_gl_state *state = get_state();
+	int target_index = buffer_target_index(target);
+	if (state && target_index >= 0)
+		state->buffers[target_index] = buffer;
+	next.glBindBufferBase(target, index, buffer);
+}
+
+static void filter_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+	struct glplatform_gl_state *state = get_state();
+	int target_index = buffer_target_index(target);
+	if (state && target_index >= 0)
+		state->buffers[target_index] = buffer;
+	next.glBindBufferRange(target, index, buffer, offset, size);
+}
+
+static void filter_glBindVertexArray(GLuint array)
+{
+	struct glplatform_gl_state *state = get_state();
+	if (state) {
+		if (filter_name(state, &state->vertex_array, array))
+			return;
+		//The element array binding is part of the VAO
+		state->buffers[BUF_ELEMENT_ARRAY] = UNKNOWN_NAME;
+	}
+	next.glBindVertexArray(array);
+}
+
+static void filter_glBindFramebuffer(GLenum target, GLuint framebuffer)
+{
+	struct glplatform_gl_state *state = get_state();
+	if (state) {
+		switch (target) {
+		case GL_FRAMEBUFFER:
+			state->frame.calls++;
+			if (state->draw_framebuffer == framebuffer &&
+					state->read_framebuffer == framebuffer) {
+				state->frame.elided++;
+				return;
+			}
+			state->draw_framebuffer = framebuffer;
+			state->read_framebuffer = framebuffer;
+			break;
+		case GL_DRAW_FRAMEBUFFER:
+			if (filter_name(state, &state->draw_framebuffer, framebuffer))
+				return;
+			break;
+		case GL_READ_FRAMEBUFFER:
+			if (filter_name(state, &state->read_framebuffer, framebuffer))
+				return;
+			break;
+		}
+	}
+	next.glBindFramebuffer(target, framebuffer);
+}
+
+static bool filter_cap(GLenum cap, int8_t value)
+{
+	struct glplatform_gl_state *state = get_state();
+	int index = capability_index(cap);
+	if (!state || index < 0)
+		return false;
+	state->frame.calls++;
+	if (state->caps[index] == value) {
+		state->frame.elided++;
+		return true;
+	}
+	state->caps[index] = value;
+	return false;
+}
+
+static void filter_glEnable(GLenum cap)
+{
+	if (!filter_cap(cap, 1))
+		next.glEnable(cap);
+}
+
+static void filter_glDisable(GLenum cap)
+{
+	if (!filter_cap(cap, 0))
+		next.glDisable(cap);
+}
+
+static void invalidate_cap(GLenum cap)
+{
+	struct glplatform_gl_state *state = get_state();
+	int index = capability_index(cap);
+	if (state && index >= 0)
+		state->caps[index] = -1;
+}
+
+static void filter_glEnablei(GLenum cap, GLuint index)
+{
+	invalidate_cap(cap);
+	next.glEnablei(cap, index);
+}
+
+static void filter_glDisablei(GLenum cap, GLuint index)
+{
+	invalidate_cap(cap);
+	next.glDisablei(cap, index);
+}
+
+static bool filter_blend_func(GLenum src_rgb, GLenum dst_rgb, GLenum src_alpha, GLenum dst_alpha)
+{
+	struct glplatform_gl_state *state = get_state();
+	if (!state)
+		return false;
+	state->frame.calls++;
+	if (state->blend_func_valid &&
+			state->blend_func[0] == src_rgb &&
+			state->blend_func[1] == dst_rgb &&
+			state->blend_func[2] == src_alpha &&
+			state->blend_func[3] == dst_alpha) {
+		state->frame.elided++;
+		return true;
+	}
+	state->blend_func_valid = true;
+	state->blend_func[0] = src_rgb;
+	state->blend_func[1] = dst_rgb;
+	state->blend_func[2] = src_alpha;
+	state->blend_func[3] = dst_alpha;
+	return false;
+}
+
+static void filter_glBlendFunc(GLenum sfactor, GLenum dfactor)
+{
+	if (!filter_blend_func(sfactor, dfactor, sfactor, dfactor))
+		next.glBlendFunc(sfactor, dfactor);
+}
+
+static void filter_glBlendFuncSeparate(GLenum src_rgb, GLenum dst_rgb, GLenum src_alpha, GLenum dst_alpha)
+{
+	if (!filter_blend_func(src_rgb, dst_rgb, src_alpha, dst_alpha))
+		next.glBlendFuncSeparate(src_rgb, dst_rgb, src_alpha, dst_alpha);
+}
+
+static void invalidate_blend_func()
+{
+	struct glplatform_gl_state *state = get_state();
+	if (state)
+		state->blend_func_valid = false;
+}
+
+static void filter_glBlendFunci(GLuint buf, GLenum src, GLenum dst)
+{
+	invalidate_blend_func();
+	next.glBlendFunci(buf, src, dst);
+}
+
+static void filter_glBlendFuncSeparatei(GLuint buf, GLenum src_rgb, GLenum dst_rgb, GLenum src_alpha, GLenum dst_alpha)
+{
+	invalidate_blend_func();
+	next.glBlendFuncSeparatei(buf, src_rgb, dst_rgb, src_alpha, dst_alpha);
+}
+
+//
+// Deleting a bound object reverts the binding to zero and a later
+// glGen*() may hand out the same name again so any shadowed binding
+// of a deleted name must be forgotten.
+//
+static void forget_name(GLuint *bindings, int count, GLuint name)
+{
+	for (int i = 0; i < count; i++) {
+		if (bindings[i] == name)
+			bindings[i] = UNKNOWN_NAME;
+	}
+}
+
+//
+// Tell other contexts that shared object names were deleted. The deleting
+// context has already forgotten the exact names, so it keeps its shadow
+// unless other deletes happened in between.
+//
+static void shared_objects_deleted(struct glplatform_gl_state *state)
+{
+	unsigned prev = atomic_fetch_add_explicit(&g_shared_deletes, 1, memory_order_relaxed);
+	if (state && state->shared_deletes == prev)
+		state->shared_deletes = prev + 1;
+}
+
+static void filter_glDeleteProgram(GLuint program)
+{
+	struct glplatform_gl_state *state = get_state();
+	if (state && program)
+		forget_name(&state->program, 1, program);
+	next.glDeleteProgram(program);
+	if (program)
+		shared_objects_deleted(state);
+}
+
+static void filter_glDeleteTextures(GLsizei n, const GLuint *textures)
+{
+	struct glplatform_gl_state *state = get_state();
+	if (state) {
+		for (int i = 0; i < n; i++) {
+			if (textures[i])
+				forget_name(&state->textures[0][0], MAX_SHADOW_UNITS * NUM_TEXTURE_TARGETS, textures[i]);
+		}
+	}
+	next.glDeleteTextures(n, textures);
+	if (n > 0)
+		shared_objects_deleted(state);
+}
+
+static void filter_glDeleteBuffers(GLsizei n, const GLuint *buffers)
+{
+	struct glplatform_gl_state *state = get_state();
+	if (state) {
+		for (int i = 0; i < n; i++) {
+			if (buffers[i])
+				forget_name(state->buffers, NUM_BUFFER_TARGETS, buffers[i]);
+		}
+	}
+	next.glDeleteBuffers(n, buffers);
+	if (n > 0)
+		shared_objects_deleted(state);
+}
+
+static void filter_glDeleteVertexArrays(GLsizei n, const GLuint *arrays)
+{
+	struct glplatform_gl_state *state = get_state();
+	if (state) {
+		for (int i = 0; i < n; i++) {
+			if (arrays[i] && arrays[i] == state->vertex_array) {
+				state->vertex_array = UNKNOWN_NAME;
+				state->buffers[BUF_ELEMENT_ARRAY] = UNKNOWN_NAME;
+			}
+		}
+	}
+	next.glDeleteVertexArrays(n, arrays);
+}
+
+static void filter_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers)
+{
+	struct glplatform_gl_state *state = get_state();
+	if (state) {
+		for (int i = 0; i < n; i++) {
+			if (framebuffers[i]) {
+				forget_name(&state->draw_framebuffer, 1, framebuffers[i]);
+				forget_name(&state->read_framebuffer, 1, framebuffers[i]);
+			}
+		}
+	}
+	next.glDeleteFramebuffers(n, framebuffers);
+}
+
+//
+// Swap in the filter for one entry point. Entry points the driver
+// doesn't provide are left alone.
+//
+#define INSTALL(name) \
+	if (name) { \
+		next.name = name; \
+		name = filter_##name; \
+	}
+
+#define REMOVE(name) \
+	if (next.name) { \
+		name = next.name; \
+		next.name = NULL; \
+	}
+
+//
+// Another layer installed after the filter has wrapped this entry point
+//
+#define COVERED(name) (next.name && name != filter_##name)
+
+bool glplatform_state_filter_enable(bool enable)
+{
+	if (enable == g_installed)
+		return true;
+
+	if (enable) {
+		if (!glUseProgram || !glActiveTexture || !glBindTexture || !glBindBuffer)
+			return false;
+		atomic_fetch_add_explicit(&g_generation, 1, memory_order_relaxed);
+		INSTALL(glUseProgram);
+		INSTALL(glActiveTexture);
+		INSTALL(glBindTexture);
+		INSTALL(glBindTextures);
+		INSTALL(glBindTextureUnit);
+		INSTALL(glBindBuffer);
+		INSTALL(glBindBufferBase);
+		INSTALL(glBindBufferRange);
+		INSTALL(glBindVertexArray);
+		INSTALL(glBindFramebuffer);
+		INSTALL(glEnable);
+		INSTALL(glDisable);
+		INSTALL(glEnablei);
+		INSTALL(glDisablei);
+		INSTALL(glBlendFunc);
+		INSTALL(glBlendFuncSeparate);
+		INSTALL(glBlendFunci);
+		INSTALL(glBlendFuncSeparatei);
+		INSTALL(glDeleteProgram);
+		INSTALL(glDeleteTextures);
+		INSTALL(glDeleteBuffers);
+		INSTALL(glDeleteVertexArrays);
+		INSTALL(glDeleteFramebuffers);
+	} else {
+		if (COVERED(glUseProgram) ||
+				COVERED(glActiveTexture) ||
+				COVERED(glBindTexture) ||
+				COVERED(glBindTextures) ||
+				COVERED(glBindTextureUnit) ||
+				COVERED(glBindBuffer) ||
+				COVERED(glBindBufferBase) ||
+				COVERED(glBindBufferRange) ||
+				COVERED(glBindVertexArray) ||
+				COVERED(glBindFramebuffer) ||
+				COVERED(glEnable) ||
+				COVERED(glDisable) ||
+				COVERED(glEnablei) ||
+				COVERED(glDisablei) ||
+				COVERED(glBlendFunc) ||
+				COVERED(glBlendFuncSeparate) ||
+				COVERED(glBlendFunci) ||
+				COVERED(glBlendFuncSeparatei) ||
+				COVERED(glDeleteProgram) ||
+				COVERED(glDeleteTextures) ||
+				COVERED(glDeleteBuffers) ||
+				COVERED(glDeleteVertexArrays) ||
+				COVERED(glDeleteFramebuffers))
+			return false;
+		REMOVE(glUseProgram);
+		REMOVE(glActiveTexture);
+		REMOVE(glBindTexture);
+		REMOVE(glBindTextures);
+		REMOVE(glBindTextureUnit);
+		REMOVE(glBindBuffer);
+		REMOVE(glBindBufferBase);
+		REMOVE(glBindBufferRange);
+		REMOVE(glBindVertexArray);
+		REMOVE(glBindFramebuffer);
+		REMOVE(glEnable);
+		REMOVE(glDisable);
+		REMOVE(glEnablei);
+		REMOVE(glDisablei);
+		REMOVE(glBlendFunc);
+		REMOVE(glBlendFuncSeparate);
+		REMOVE(glBlendFunci);
+		REMOVE(glBlendFuncSeparatei);
+		REMOVE(glDeleteProgram);
+		REMOVE(glDeleteTextures);
+		REMOVE(glDeleteBuffers);
+		REMOVE(glDeleteVertexArrays);
+		REMOVE(glDeleteFramebuffers);
+	}
+	g_installed = enable;
+	return true;
+}
+
+bool glplatform_state_filter_get_stats(struct glplatform_state_filter_stats *stats)
+{
+	struct glplatform_gl_state *state = get_state();
+	if (!state)
+		return false;
+	*stats = state->last_frame;
+	return true;
+}
+
+void glplatform_state_filter_end_frame()
+{
+	struct glplatform_context *context = glplatform_get_context_priv();
+	if (!context || !context->gl_state)
+		return;
+	context->gl_state->last_frame = context->gl_state->frame;
+	context->gl_state->frame.calls = 0;
+	context->gl_state->frame.elided = 0;
+}
@@ -0,0 +1,248 @@
+#include "glutil.h"
+#include "priv.h"
+
+#define GLPLATFORM_GL_VERSION 33
+#define GLPLATFORM_ENABLE_GL_ARB_buffer_storage
+#include "glcore.h"
+#define GLPLATFORM_GL_USE_DISPATCH
+#include "glcore_dispatch.h"
+
+#include <stdlib.h>
+
+//
+// Maximum number of fenced regions per buffer. When all are in use the
+// oldest one is waited on before a new one is added.
+//
+#define MAX_FENCES 16
+
+//
+// Fence wait timeout. Waits are retried until the fence signals.
+//
+#define FENCE_TIMEOUT_NS 100000000
+
+//
+// Positions are byte counts since the buffer was created. The ring
+// offset of position 'p' is 'p % size'.
+//
+struct stream_fence {
+	GLsync sync;
+	uint64_t start;
+	uint64_t end;
+};
+
+struct glplatform_stream_buffer {
+	GLenum target;
+	GLuint buffer;
+	size_t size;
+	bool persistent;
+	uint8_t *base;
+
+	uint64_t head;
+	uint64_t map_pos;
+	size_t map_size;
+	void *mapped;
+
+	//Start of the region written since the last fence
+	uint64_t unfenced;
+	struct stream_fence fences[MAX_FENCES];
+	int fence_first;
+	int fence_count;
+
+	struct glplatform_context *context;
+	struct glplatform_stream_buffer *next;
+};
+
+static bool has_buffer_storage()
+{
+	GLint maj = 0, min = 0;
+	if (GLPLATFORM_GL_ARB_buffer_storage)
+		return true;
+	if (!GLPLATFORM_GL_HAS_ENTRY_POINT(glBufferStorage))
+		return false;
+	glGetIntegerv(GL_MAJOR_VERSION, &maj);
+	glGetIntegerv(GL_MINOR_VERSION, &min);
+	return maj * 10 + min >= 44;
+}
+
+struct glplatform_stream_buffer *glplatform_stream_buffer_create(uint32_t target, size_t size)
+{
+	struct glplatform_context *context = glplatform_get_context_priv();
+	if (!context)
+		return NULL;
+
+	struct glplatform_stream_buffer *stream = calloc(1, sizeof(struct glplatform_stream_buffer));
+	if (!stream)
+		return NULL;
+	stream->target = target;
+	stream->size = size;
+	stream->persistent = has_buffer_storage();
+
+	glGenBuffers(1, &stream->buffer);
+	glBindBuffer(target, stream->buffer);
+	if (stream->persistent) {
+		const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		glBufferStorage(target, size, NULL, flags);
+		stream->base = (uint8_t *)glMapBufferRange(target, 0, size, flags);
+		if (!stream->base) {
+			//Fall back to orphaning with a fresh buffer object
+			glDeleteBuffers(1, &stream->buffer);
+			glGenBuffers(1, &stream->buffer);
+			glBindBuffer(target, stream->buffer);
+			stream->persistent = false;
+		}
+	}
+	if (!stream->persistent)
+		glBufferData(target, size, NULL, GL_STREAM_DRAW);
+
+	stream->context = context;
+	stream->next = context->stream_buffers;
+	context->stream_buffers = stream;
+	return stream;
+}
+
+void glplatform_stream_buffer_destroy(struct glplatform_stream_buffer *stream)
+{
+	struct glplatform_stream_buffer **pos = &stream->context->stream_buffers;
+	int i;
+	while (*pos != stream)
+		pos = &(*pos)->next;
+	*pos = stream->next;
+
+	for (i = 0; i < stream->fence_count; i++)
+		glDeleteSync(stream->fences[(stream->fence_first + i) % MAX_FENCES].sync);
+	//Deleting the buffer also unmaps it
+	glDeleteBuffers(1, &stream->buffer);
+	free(stream);
+}
+
+void glplatform_stream_buffers_release(struct glplatform_context *context, bool current)
+{
+	while (context->stream_buffers) {
+		struct glplatform_stream_buffer *stream = context->stream_buffers;
+		if (current) {
+			glplatform_stream_buffer_destroy(stream);
+		} else {
+			context->stream_buffers = stream->next;
+			free(stream);
+		}
+	}
+}
+
+static void add_fence(struct glplatform_stream_buffer *stream)
+{
+	if (stream->unfenced == stream->head)
+		return;
+	if (stream->fence_count == MAX_FENCES) {
+		struct stream_fence *oldest = stream->fences + stream->fence_first;
+		GLenum status;
+		do {
+			status = glClientWaitSync(oldest->sync, GL_SYNC_FLUSH_COMMANDS_BIT, FENCE_TIMEOUT_NS);
+		} while (status == GL_TIMEOUT_EXPIRED);
+		glDeleteSync(oldest->sync);
+		stream->fence_first = (stream->fence_first + 1) % MAX_FENCES;
+		stream->fence_count--;
+	}
+	struct stream_fence *fence = stream->fences + (stream->fence_first + stream->fence_count) % MAX_FENCES;
+	fence->sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	fence->start = stream->unfenced;
+	fence->end = stream->head;
+	stream->fence_count++;
+	stream->unfenced = stream->head;
+}
+
+//
+// Wait until the GPU is done with all data written before position 'pos'
+//
+static void wait_until(struct glplatform_stream_buffer *stream, uint64_t pos)
+{
+	if (stream->unfenced < pos)
+		add_fence(stream);
+	while (stream->fence_count) {
+		struct stream_fence *oldest = stream->fences + stream->fence_first;
+		if (oldest->start >= pos)
+			break;
+		GLenum status;
+		do {
+			status = glClientWaitSync(oldest->sync, GL_SYNC_FLUSH_COMMANDS_BIT, FENCE_TIMEOUT_NS);
+		} while (status == GL_TIMEOUT_EXPIRED);
+		glDeleteSync(oldest->sync);
+		stream->fence_first = (stream->fence_first + 1) % MAX_FENCES;
+		stream->fence_count--;
+	}
+}
+
+void *glplatform_stream_buffer_map(struct glplatform_stream_buffer *stream, size_t size, size_t alignment, size_t *offset)
+{
+	if (size > stream->size || size == 0)
+		return NULL;
+
+	uint64_t pos = stream->head;
+	size_t ring_offset = pos % stream->size;
+	if (alignment > 1 && ring_offset % alignment) {
+		pos += alignment - ring_offset % alignment;
+		ring_offset = pos % stream->size;
+	}
+	bool wrapped = false;
+	if (ring_offset + size > stream->size || (ring_offset == 0 && pos != 0)) {
+		pos += (stream->size - ring_offset) % stream->size;
+		ring_offset = 0;
+		wrapped = true;
+	}
+
+	void *ptr;
+	if (stream->persistent) {
+		if (pos + size > stream->size)
+			wait_until(stream, pos + size - stream->size);
+		ptr = stream->base + ring_offset;
+	} else {
+		glBindBuffer(stream->target, stream->buffer);
+		if (wrapped)
+			glBufferData(stream->target, stream->size, NULL, GL_STREAM_DRAW);
+		ptr = glMapBufferRange(stream->target, ring_offset, size,
+			GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+		if (!ptr)
+			return NULL;
+	}
+	stream->map_pos = pos;
+	stream->map_size = size;
+	stream->mapped = ptr;
+	*offset = ring_offset;
+	return ptr;
+}
+
+void glplatform_stream_buffer_unmap(struct glplatform_stream_buffer *stream, size_t used)
+{
+	if (!stream->mapped)
+		return;
+	if (!stream->persistent) {
+		glBindBuffer(stream->target, stream->buffer);
+		glUnmapBuffer(stream->target);
+	}
+	if (used > stream->map_size)
+		used = stream->map_size;
+	glplatform_count_add(&glplatform_counters.stream_bytes, used);
+	//Persistent writes never pass through GL, record them for the capture
+	if (stream->persistent && used)
+		glplatform_capture_buffer_write(stream->buffer, stream->map_pos % stream->size, used, stream->mapped);
+	stream->head = stream->map_pos + used;
+	stream->mapped = NULL;
+}
+
+uint32_t glplatform_stream_buffer_get_name(struct glplatform_stream_buffer *stream)
+{
+	return stream->buffer;
+}
+
+size_t glplatform_stream_buffer_get_size(struct glplatform_stream_buffer *stream)
+{
+	return stream->size;
+}
+
+void glplatform_stream_end_frame(struct glplatform_stream_buffer *list)
+{
+	struct glplatform_stream_buffer *stream;
+	for (stream = list; stream; stream = stream->next) {
+		if (stream->persistent)
+			add_fence(stream);
+	}
+}
@@ -0,0 +1,370 @@
+#include "glutil.h"
+#include "priv.h"
+
+#define GLPLATFORM_GL_VERSION 33
+#include "glcore.h"
+#define GLPLATFORM_GL_USE_DISPATCH
+#include "glcore_dispatch.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+//
+// A queued texture upload. Uploads are split into runs of rows within
+// a layer, or runs of whole layers when the budget allows, so that no
+// frame copies more than the queue's budget.
+//
+struct upload_job {
+	GLuint texture;
+	GLenum target;
+	GLint level;
+	int x, y, z;
+	int width, height, depth;
+	GLenum format;
+	GLenum type;
+	const uint8_t *data;
+	size_t row_size;
+
+	//Next row and layer to upload
+	int row;
+	int layer;
+
+	void (*done)(void *arg);
+	void *arg;
+	struct upload_job *next;
+};
+
+struct glplatform_upload_queue {
+	struct glplatform_stream_buffer *staging;
+	size_t frame_budget;
+	struct upload_job *head;
+	struct upload_job *tail;
+	struct glplatform_context *context;
+	struct glplatform_upload_queue *next;
+};
+
+size_t glplatform_pixel_size(uint32_t format, uint32_t type)
+{
+	int components;
+	switch (format) {
+	case GL_RED:
+	case GL_RED_INTEGER:
+	case GL_DEPTH_COMPONENT:
+	case GL_STENCIL_INDEX:
+		components = 1;
+		break;
+	case GL_RG:
+	case GL_RG_INTEGER:
+	case GL_DEPTH_STENCIL:
+		components = 2;
+		break;
+	case GL_RGB:
+	case GL_BGR:
+	case GL_RGB_INTEGER:
+	case GL_BGR_INTEGER:
+		components = 3;
+		break;
+	case GL_RGBA:
+	case GL_BGRA:
+	case GL_RGBA_INTEGER:
+	case GL_BGRA_INTEGER:
+		components = 4;
+		break;
+	default:
+		return 0;
+	}
+	switch (type) {
+	case GL_UNSIGNED_BYTE:
+	case GL_BYTE:
+		return components;
+	case GL_UNSIGNED_SHORT:
+	case GL_SHORT:
+	case GL_HALF_FLOAT:
+		return components * 2;
+	case GL_UNSIGNED_INT:
+	case GL_INT:
+	case GL_FLOAT:
+		return components * 4;
+	case GL_UNSIGNED_SHORT_5_6_5:
+	case GL_UNSIGNED_SHORT_4_4_4_4:
+	case GL_UNSIGNED_SHORT_5_5_5_1:
+		return 2;
+	case GL_UNSIGNED_INT_8_8_8_8:
+	case GL_UNSIGNED_INT_8_8_8_8_REV:
+	case GL_UNSIGNED_INT_2_10_10_10_REV:
+	case GL_UNSIGNED_INT_24_8:
+	case GL_UNSIGNED_INT_10F_11F_11F_REV:
+	case GL_UNSIGNED_INT_5_9_9_9_REV:
+		return 4;
+	default:
+		return 0;
+	}
+}
+
+struct glplatform_upload_queue *glplatform_upload_queue_create(size_t staging_size, size_t frame_budget)
+{
+	struct glplatform_context *context = glplatform_get_context_priv();
+	if (!context)
+		return NULL;
+	struct glplatform_upload_queue *queue = calloc(1, sizeof(struct glplatform_upload_queue));
+	if (!queue)
+		goto error0;
+	queue->staging = glplatform_stream_buffer_create(GL_PIXEL_UNPACK_BUFFER, staging_size);
+	if (!queue->staging)
+		goto error1;
+	queue->frame_budget = frame_budget;
+	queue->context = context;
+	queue->next = context->upload_queues;
+	context->upload_queues = queue;
+	return queue;
+error1:
+	free(queue);
+error0:
+	return NULL;
+}
+
+void glplatform_upload_queue_destroy(struct glplatform_upload_queue *queue)
+{
+	struct glplatform_upload_queue **pos = &queue->context->upload_queues;
+	while (*pos != queue)
+		pos = &(*pos)->next;
+	*pos = queue->next;
+
+	while (queue->head) {
+		struct upload_job *job = queue->head;
+		queue->head = job->next;
+		free(job);
+	}
+	glplatform_stream_buffer_destroy(queue->staging);
+	free(queue);
+}
+
+void glplatform_upload_queues_release(struct glplatform_context *context, bool current)
+{
+	while (context->upload_queues) {
+		struct glplatform_upload_queue *queue = context->upload_queues;
+		if (current) {
+			glplatform_upload_queue_destroy(queue);
+			continue;
+		}
+		//The staging buffer is freed with the context's stream buffers
+		context->upload_queues = queue->next;
+		while (queue->head) {
+			struct upload_job *job = queue->head;
+			queue->head = job->next;
+			free(job);
+		}
+		free(queue);
+	}
+}
+
+bool glplatform_upload_texture(struct glplatform_upload_queue *queue,
+		uint32_t texture, uint32_t target, int level,
+		int x, int y, int z, int width, int height, int depth,
+		uint32_t format, uint32_t type, const void *data,
+		void (*done)(void *arg), void *arg)
+{
+	size_t size = glplatform_pixel_size(format, type);
+	if (!size || width <= 0 || height <= 0 || depth <= 0)
+		return false;
+	if (size * width > glplatform_stream_buffer_get_size(queue->staging))
+		return false;
+
+	struct upload_job *job = calloc(1, sizeof(struct upload_job));
+	if (!job)
+		return false;
+	job->texture = texture;
+	job->target = target;
+	job->level = level;
+	job->x = x;
+	job->y = y;
+	job->z = z;
+	job->width = width;
+	job->height = height;
+	job->depth = depth;
+	job->format = format;
+	job->type = type;
+	job->data = (const uint8_t *)data;
+	job->row_size = size * width;
+	job->done = done;
+	job->arg = arg;
+	if (queue->tail)
+		queue->tail->next = job;
+	else
+		queue->head = job;
+	queue->tail = job;
+	return true;
+}
+
+void glplatform_upload_queue_cancel(struct glplatform_upload_queue *queue, uint32_t texture)
+{
+	struct upload_job **pos = &queue->head;
+	queue->tail = NULL;
+	while (*pos) {
+		struct upload_job *job = *pos;
+		if (job->texture == texture) {
+			*pos = job->next;
+			free(job);
+		} else {
+			queue->tail = job;
+			pos = &job->next;
+		}
+	}
+}
+
+int glplatform_upload_queue_pending(struct glplatform_upload_queue *queue)
+{
+	int count = 0;
+	struct upload_job *job;
+	for (job = queue->head; job; job = job->next)
+		count++;
+	return count;
+}
+
+//
+// Copy the next run of the job's rows into the staging buffer and issue the
+// sub-image upload. Returns the number of bytes uploaded or 0 on failure.
+//
+static size_t upload_run(struct glplatform_upload_queue *queue, struct upload_job *job, size_t budget)
+{
+	size_t limit = glplatform_stream_buffer_get_size(queue->staging);
+	size_t layer_size = job->row_size * job->height;
+	int rows, layers;
+	if (budget > limit)
+		budget = limit;
+
+	if (job->row == 0 && layer_size <= budget) {
+		layers = budget / layer_size;
+		if (layers > job->depth - job->layer)
+			layers = job->depth - job->layer;
+		rows = job->height;
+	} else {
+		layers = 1;
+		rows = budget / job->row_size;
+		if (rows < 1)
+			rows = 1;
+		if (rows > job->height - job->row)
+			rows = job->height - job->row;
+	}
+
+	size_t size = job->row_size * rows * layers;
+	size_t offset;
+	void *dst = glplatform_stream_buffer_map(queue->staging, size, 16, &offset);
+	if (!dst)
+		return 0;
+	memcpy(dst, job->data + layer_size * job->layer + job->row_size * job->row, size);
+	glplatform_stream_buffer_unmap(queue->staging, size);
+
+	GLenum bind_target = job->target;
+	if (job->target >= GL_TEXTURE_CUBE_MAP_POSITIVE_X && job->target <= GL_TEXTURE_CUBE_MAP_NEGATIVE_Z)
+		bind_target = GL_TEXTURE_CUBE_MAP;
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, glplatform_stream_buffer_get_name(queue->staging));
+	glBindTexture(bind_target, job->texture);
+	if (job->target == GL_TEXTURE_3D || job->target == GL_TEXTURE_2D_ARRAY) {
+		glTexSubImage3D(job->target, job->level,
+			job->x, job->y + job->row, job->z + job->layer,
+			job->width, rows, layers,
+			job->format, job->type, (void *)offset);
+	} else {
+		glTexSubImage2D(job->target, job->level,
+			job->x, job->y + job->row,
+			job->width, rows,
+			job->format, job->type, (void *)offset);
+	}
+
+	job->row += rows;
+	if (job->row == job->height) {
+		job->row = 0;
+		job->layer += layers;
+	}
+	return size;
+}
+
+//
+// Texture targets upload_run() may bind and their binding queries
+//
+static const GLenum g_bind_targets[][2] = {
+	{GL_TEXTURE_1D_ARRAY, GL_TEXTURE_BINDING_1D_ARRAY},
+	{GL_TEXTURE_2D, GL_TEXTURE_BINDING_2D},
+	{GL_TEXTURE_RECTANGLE, GL_TEXTURE_BINDING_RECTANGLE},
+	{GL_TEXTURE_CUBE_MAP, GL_TEXTURE_BINDING_CUBE_MAP},
+	{GL_TEXTURE_3D, GL_TEXTURE_BINDING_3D},
+	{GL_TEXTURE_2D_ARRAY, GL_TEXTURE_BINDING_2D_ARRAY}
+};
+
+#define NUM_BIND_TARGETS (sizeof(g_bind_targets) / sizeof(g_bind_targets[0]))
+
+//
+// Pixel store state that affects uploads and the value upload_run() expects
+//
+static const GLint g_unpack_state[][2] = {
+	{GL_UNPACK_SWAP_BYTES, GL_FALSE},
+	{GL_UNPACK_ALIGNMENT, 1},
+	{GL_UNPACK_ROW_LENGTH, 0},
+	{GL_UNPACK_IMAGE_HEIGHT, 0},
+	{GL_UNPACK_SKIP_ROWS, 0},
+	{GL_UNPACK_SKIP_PIXELS, 0},
+	{GL_UNPACK_SKIP_IMAGES, 0}
+};
+
+#define NUM_UNPACK_STATE (sizeof(g_unpack_state) / sizeof(g_unpack_state[0]))
+
+//
+// Upload up to 'budget' bytes from the front of the queue. At least one run
+// is uploaded per call so large rows still make progress. This runs when
+// windows are swapped, so the application's texture and unpack buffer
+// bindings are restored like the pixel store state.
+//
+static void process_queue(struct glplatform_upload_queue *queue, size_t budget)
+{
+	GLint unpack_state[NUM_UNPACK_STATE];
+	GLint unpack_buffer;
+	GLint textures[NUM_BIND_TARGETS];
+	int i;
+	if (!queue->head)
+		return;
+
+	glGetIntegerv(GL_PIXEL_UNPACK_BUFFER_BINDING, &unpack_buffer);
+	for (i = 0; i < NUM_BIND_TARGETS; i++)
+		glGetIntegerv(g_bind_targets[i][1], &textures[i]);
+	for (i = 0; i < NUM_UNPACK_STATE; i++) {
+		glGetIntegerv(g_unpack_state[i][0], &unpack_state[i]);
+		glPixelStorei(g_unpack_state[i][0], g_unpack_state[i][1]);
+	}
+
+	size_t used = 0;
+	while (queue->head && (used == 0 || used < budget)) {
+		struct upload_job *job = queue->head;
+		size_t size = upload_run(queue, job, budget - used);
+		if (!size)
+			break;
+		used += size;
+		if (job->layer == job->depth) {
+			queue->head = job->next;
+			if (!queue->head)
+				queue->tail = NULL;
+			if (job->done)
+				job->done(job->arg);
+			free(job);
+		}
+	}
+
+	for (i = 0; i < NUM_UNPACK_STATE; i++)
+		glPixelStorei(g_unpack_state[i][0], unpack_state[i]);
+	for (i = 0; i < NUM_BIND_TARGETS; i++)
+		glBindTexture(g_bind_targets[i][0], textures[i]);
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, unpack_buffer);
+}
+
+void glplatform_upload_queue_flush(struct glplatform_upload_queue *queue)
+{
+	while (queue->head)
+		process_queue(queue, SIZE_MAX);
+}
+
+void glplatform_upload_end_frame(struct glplatform_upload_queue *list)
+{
+	struct glplatform_upload_queue *queue;
+	for (queue = list; queue; queue = queue->next)
+		process_queue(queue, queue->frame_budget);
+}
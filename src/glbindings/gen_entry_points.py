@@ -0,0 +1,231 @@
+#!/usr/bin/env python3
+#
+# Generate from the glbindify generated glcore.c:
+#
+# glcore_entry_points.h - X-macro list of the entry points and extensions
+# glcore_dispatch_defines.h - Redirects each entry point to its dispatch wrapper
+#
+# usage: gen_entry_points.py [glcore.c] [output directory]
+#
+
+import os
+import re
+import sys
+
+LOAD_RE = re.compile(r'^\t(\w+) = \((.*) \(\*\)\((.*)\) \) LoadProcAddress\("(\w+)"\);$')
+ENABLE_RE = re.compile(r'^#define (GLPLATFORM_ENABLE_GL_\w+)$')
+EXTENSION_RE = re.compile(r'\{"(GL_\w+)", &GLPLATFORM_(GL_\w+)\}')
+
+def split_params(params):
+	params = params.strip()
+	if params in ('', 'void'):
+		return []
+	ret = []
+	depth = 0
+	cur = ''
+	for c in params:
+		if c == ',' and depth == 0:
+			ret.append(cur.strip())
+			cur = ''
+			continue
+		if c == '(':
+			depth += 1
+		elif c == ')':
+			depth -= 1
+		cur += c
+	ret.append(cur.strip())
+	return ret
+
+SCALAR_CODES = {
+	'GLenum': 'i', 'GLboolean': 'i', 'GLbitfield': 'i', 'GLbyte': 'i', 'GLshort': 'i',
+	'GLint': 'i', 'GLubyte': 'i', 'GLushort': 'i', 'GLuint': 'i', 'GLfixed': 'i',
+	'GLclampx': 'i', 'GLhalf': 'i',
+	'GLsizei': 'n',
+	'GLint64': 'l', 'GLuint64': 'l', 'GLintptr': 'l', 'GLsizeiptr': 'l',
+	'GLint64EXT': 'l', 'GLuint64EXT': 'l',
+	'GLfloat': 'f', 'GLclampf': 'f',
+	'GLdouble': 'd', 'GLclampd': 'd',
+	'GLsync': 's',
+	'GLDEBUGPROC': 'x', 'GLDEBUGPROCARB': 'x', 'GLDEBUGPROCKHR': 'x',
+	'struct _cl_context *': 'x', 'struct _cl_event *': 'x',
+}
+
+ELEMENT_SIZES = {
+	'GLbyte': 1, 'GLubyte': 1, 'GLboolean': 1,
+	'GLshort': 2, 'GLushort': 2,
+	'GLint': 4, 'GLuint': 4, 'GLenum': 4, 'GLfloat': 4, 'GLsizei': 4,
+	'GLdouble': 8, 'GLint64': 8, 'GLuint64': 8, 'GLuint64EXT': 8, 'GLintptr': 8, 'GLsizeiptr': 8,
+}
+
+RETURN_CODES = {
+	'void': 'v', 'GLboolean': 'i', 'GLuint': 'i', 'GLenum': 'i', 'GLint': 'i',
+	'GLuint64': 'l', 'GLsync': 's', 'void *': 'p', 'const GLubyte *': 'p',
+}
+
+# Union field each code is stored in
+CODE_FIELDS = {
+	'i': 'i', 'n': 'i', 'l': 'l', 'f': 'f', 'd': 'd', 's': 's',
+	'x': 'x', 'X': 'x', 'o': 'o',
+}
+
+def param_code(param):
+	if param in SCALAR_CODES:
+		return SCALAR_CODES[param]
+	if param == 'const GLchar *const*':
+		return 'C'
+	if param == 'const GLchar *':
+		return 'S'
+	if param == 'const void *const*':
+		return 'X'
+	if param == 'const void *':
+		return 'p'
+	m = re.match(r'^const (\w+) \*$', param)
+	if m and m.group(1) in ELEMENT_SIZES:
+		return str(ELEMENT_SIZES[m.group(1)])
+	if param.endswith('*') and not param.startswith('const'):
+		return 'o'
+	sys.exit('no signature code for parameter type "%s"' % param)
+
+def declare(params):
+	names = ['a%d' % i for i in range(len(params))]
+	decl = '(%s)' % (', '.join(p + ' ' + n for p, n in zip(params, names)) if params else 'void')
+	return decl, '(%s)' % ', '.join(names)
+
+def main():
+	src_dir = os.path.dirname(os.path.abspath(__file__))
+	in_path = sys.argv[1] if len(sys.argv) > 1 else os.path.join(src_dir, 'glcore.c')
+	out_dir = sys.argv[2] if len(sys.argv) > 2 else src_dir
+
+	funcs = []
+	extensions = set()
+	enables = []
+	with open(in_path) as f:
+		for line in f:
+			m = LOAD_RE.match(line.rstrip('\n'))
+			if m:
+				name, ret, params, proc_name = m.groups()
+				if name != proc_name:
+					sys.exit('unexpected binding for %s' % proc_name)
+				funcs.append((name, ret.strip(), split_params(params)))
+				continue
+			m = ENABLE_RE.match(line.rstrip('\n'))
+			if m:
+				enables.append(m.group(1))
+				continue
+			for ext in EXTENSION_RE.finditer(line):
+				if ext.group(1) != ext.group(2):
+					sys.exit('unexpected extension flag for %s' % ext.group(1))
+				extensions.add(ext.group(1))
+
+	if not funcs:
+		sys.exit('no entry points found in %s' % in_path)
+
+	out = []
+	out.append('/* Generated by gen_entry_points.py from glcore.c, do not edit */')
+	out.append('')
+	out.append('/*')
+	out.append(' * X-macro list of the OpenGL entry points and extensions bound by glcore.c.')
+	out.append(' * Define any of the following before including this file:')
+	out.append(' *')
+	out.append(' * GLPLATFORM_GL_FUNC(ret, name, params, args) - Entry point returning a value')
+	out.append(' * GLPLATFORM_GL_VOID_FUNC(name, params, args) - Entry point returning void')
+	out.append(' * GLPLATFORM_GL_EXTENSION(name) - Extension, in strcmp() order')
+	out.append(' *')
+	out.append(' * \'params\' is the parenthesized parameter list with parameters named a0, a1, ...')
+	out.append(' * and \'args\' the parenthesized argument list passing them on.')
+	out.append(' *')
+	out.append(' * GLPLATFORM_GL_SIGNATURE(ret, name, params, args, sig, store, load) - Entry point')
+	out.append(' * 	returning a value, with its signature')
+	out.append(' * GLPLATFORM_GL_VOID_SIGNATURE(name, params, args, sig, store, load) - Entry point')
+	out.append(' * 	returning void, with its signature')
+	out.append(' *')
+	out.append(' * \'sig\' is a string with a code for the return type followed by one per')
+	out.append(' * parameter:')
+	out.append(' *')
+	out.append(' * v - void return')
+	out.append(' * i - 32-bit integer, enum or boolean')
+	out.append(' * n - GLsizei')
+	out.append(' * l - 64-bit integer, GLintptr or GLsizeiptr')
+	out.append(' * f, d - GLfloat, GLdouble')
+	out.append(' * s - GLsync')
+	out.append(' * p - const void * or, as return type, any pointer')
+	out.append(' * 1, 2, 4, 8 - Pointer to const elements of that size')
+	out.append(' * S - const GLchar * string')
+	out.append(' * C - const GLchar *const * string array')
+	out.append(' * o - Non-const pointer the entry point writes through')
+	out.append(' * x - Callback or opaque handle')
+	out.append(' * X - const void *const * array of pointers')
+	out.append(' *')
+	out.append(' * \'store\' is an expression calling GLPLATFORM_GL_STORE(index, field, value) for each')
+	out.append(' * parameter and \'load\' an argument list made of GLPLATFORM_GL_LOAD(index, field)')
+	out.append(' * cast to the parameter types. \'field\' is i, l, f, d, s, p, o or x.')
+	out.append(' *')
+	out.append(' * If GLPLATFORM_GL_ENABLE_ALL is defined the file instead enables every extension')
+	out.append(' * section of glcore.h, include it that way before glcore.h to declare all of the')
+	out.append(' * listed entry points.')
+	out.append(' */')
+	out.append('')
+	out.append('#ifdef GLPLATFORM_GL_ENABLE_ALL')
+	out.append('#undef GLPLATFORM_GL_ENABLE_ALL')
+	for enable in enables:
+		out.append('#undef %s' % enable)
+		out.append('#define %s' % enable)
+	out.append('#else')
+	out.append('')
+	for macro, params in (('GLPLATFORM_GL_FUNC', '(ret, name, params, args)'),
+			('GLPLATFORM_GL_VOID_FUNC', '(name, params, args)'),
+			('GLPLATFORM_GL_EXTENSION', '(name)'),
+			('GLPLATFORM_GL_SIGNATURE', '(ret, name, params, args, sig, store, load)'),
+			('GLPLATFORM_GL_VOID_SIGNATURE', '(name, params, args, sig, store, load)')):
+		out.append('#ifndef %s' % macro)
+		out.append('#define %s%s' % (macro, params))
+		out.append('#endif')
+	out.append('')
+	for name, ret, params in funcs:
+		decl, args = declare(params)
+		if ret == 'void':
+			out.append('GLPLATFORM_GL_VOID_FUNC(%s, %s, %s)' % (name, decl, args))
+		else:
+			out.append('GLPLATFORM_GL_FUNC(%s, %s, %s, %s)' % (ret, name, decl, args))
+	out.append('')
+	for ext in sorted(extensions):
+		out.append('GLPLATFORM_GL_EXTENSION(%s)' % ext)
+	out.append('')
+	for name, ret, params in funcs:
+		if ret not in RETURN_CODES:
+			sys.exit('no signature code for return type "%s"' % ret)
+		codes = [param_code(p) for p in params]
+		fields = [CODE_FIELDS.get(c, 'p') for c in codes]
+		store = '(%s)' % ', '.join('GLPLATFORM_GL_STORE(%d, %s, a%d)' % (i, f, i) for i, f in enumerate(fields)) if params else '((void)0)'
+		load = '(%s)' % ', '.join('(%s)GLPLATFORM_GL_LOAD(%d, %s)' % (p, i, f) for i, (p, f) in enumerate(zip(params, fields)))
+		decl, args = declare(params)
+		sig = RETURN_CODES[ret] + ''.join(codes)
+		if ret == 'void':
+			out.append('GLPLATFORM_GL_VOID_SIGNATURE(%s, %s, %s, "%s", %s, %s)' % (name, decl, args, sig, store, load))
+		else:
+			out.append('GLPLATFORM_GL_SIGNATURE(%s, %s, %s, %s, "%s", %s, %s)' % (ret, name, decl, args, sig, store, load))
+	out.append('')
+	out.append('#undef GLPLATFORM_GL_FUNC')
+	out.append('#undef GLPLATFORM_GL_VOID_FUNC')
+	out.append('#undef GLPLATFORM_GL_EXTENSION')
+	out.append('#undef GLPLATFORM_GL_SIGNATURE')
+	out.append('#undef GLPLATFORM_GL_VOID_SIGNATURE')
+	out.append('#endif')
+
+	with open(os.path.join(out_dir, 'glcore_entry_points.h'), 'w') as f:
+		f.write('\n'.join(out) + '\n')
+
+	out = []
+	out.append('/* Generated by gen_entry_points.py from glcore.c, do not edit */')
+	out.append('')
+	out.append('/* Included by glcore_dispatch.h when GLPLATFORM_GL_USE_DISPATCH is defined */')
+	out.append('')
+	for name, ret, params in funcs:
+		out.append('#undef %s' % name)
+		out.append('#define %s glplatform_dispatch_%s' % (name, name))
+
+	with open(os.path.join(out_dir, 'glcore_dispatch_defines.h'), 'w') as f:
+		f.write('\n'.join(out) + '\n')
+
+if __name__ == '__main__':
+	main()
@@ -0,0 +1,42 @@
+#define GLPLATFORM_GL_VERSION 45
+#define GLPLATFORM_GL_ENABLE_ALL
+#include "glcore_entry_points.h"
+#include "glcore_dispatch.h"
+#include "glplatform.h"
+#include "priv.h"
+
+#include <stdlib.h>
+
+_Thread_local struct glplatform_gl_dispatch *glplatform_gl_dispatch;
+
+#ifdef _WIN32
+struct glplatform_gl_dispatch *glplatform_get_gl_dispatch()
+{
+	return glplatform_gl_dispatch;
+}
+#endif
+
+bool glplatform_glcore_init_context(int maj, int min)
+{
+	struct glplatform_context *context = glplatform_get_context_priv();
+	if (!context)
+		return false;
+	if (!glplatform_glcore_init(maj, min))
+		return false;
+	if (!context->dispatch) {
+		context->dispatch = malloc(sizeof(struct glplatform_gl_dispatch));
+		if (!context->dispatch)
+			return false;
+	}
+
+	//Snapshot the entry points just resolved for this context
+	struct glplatform_gl_dispatch *dispatch = context->dispatch;
+#define GLPLATFORM_GL_FUNC(ret, name, params, args) \
+	dispatch->d_##name = name;
+#define GLPLATFORM_GL_VOID_FUNC(name, params, args) \
+	dispatch->d_##name = name;
+#include "glcore_entry_points.h"
+
+	glplatform_gl_dispatch = dispatch;
+	return true;
+}
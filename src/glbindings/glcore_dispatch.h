@@ -0,0 +1,102 @@
+#ifndef GLPLATFORM_GLCORE_DISPATCH_H
+#define GLPLATFORM_GLCORE_DISPATCH_H
+
+#include "glcore.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Per-context OpenGL dispatch tables
+ *
+ * The bindings in glcore.h call through process wide function pointers, so
+ * all contexts share the entry points of the context glplatform_glcore_init()
+ * last ran in. Contexts initialized with glplatform_glcore_init_context()
+ * instead get their own table of entry points, and glplatform_make_current()
+ * makes the table of the current context reachable through a thread local
+ * pointer.
+ *
+ * The glplatform_dispatch_<name>() inline wrappers call the entry point in the
+ * current thread's table, or the process wide pointer if the current context
+ * has no table. Define GLPLATFORM_GL_USE_DISPATCH before including this file
+ * to route the regular gl<name>() calls through the wrappers as well.
+ * glplatform's own OpenGL code (text rendering, streaming, uploads, render
+ * targets, frame statistics and so on) is built that way.
+ *
+ * The state filter, profiler and capture layers wrap the process wide
+ * pointers only. Calls made through a context's own table, including
+ * glplatform's internal calls on that context, bypass them, so do not enable
+ * the layers while contexts from different drivers are in use.
+ *
+ */
+
+struct glplatform_gl_dispatch {
+#define GLPLATFORM_GL_FUNC(ret, name, params, args) \
+	ret (*d_##name) params;
+#define GLPLATFORM_GL_VOID_FUNC(name, params, args) \
+	void (*d_##name) params;
+#include "glcore_entry_points.h"
+};
+
+#ifdef _WIN32
+struct glplatform_gl_dispatch *glplatform_get_gl_dispatch();
+#define GLPLATFORM_GL_DISPATCH glplatform_get_gl_dispatch()
+#else
+extern _Thread_local struct glplatform_gl_dispatch *glplatform_gl_dispatch;
+#define GLPLATFORM_GL_DISPATCH glplatform_gl_dispatch
+#endif
+
+/*
+ * glplatform_glcore_init_context()
+ *
+ * Bind the OpenGL entry points of the current context into a dispatch table
+ * owned by the context and make it current in this thread. The process wide
+ * function pointers and extension flags are also updated, as by
+ * glplatform_glcore_init(). The extension flags remain process wide.
+ *
+ * Returns false if the context's version is lower than maj.min or required
+ * entry points are missing.
+ *
+ */
+bool glplatform_glcore_init_context(int maj, int min);
+
+#define GLPLATFORM_GL_FUNC(ret, name, params, args) \
+	extern ret (*_glplatform_##name) params; \
+	static inline ret glplatform_dispatch_##name params \
+	{ \
+		struct glplatform_gl_dispatch *dispatch = GLPLATFORM_GL_DISPATCH; \
+		return dispatch ? dispatch->d_##name args : _glplatform_##name args; \
+	}
+#define GLPLATFORM_GL_VOID_FUNC(name, params, args) \
+	extern void (*_glplatform_##name) params; \
+	static inline void glplatform_dispatch_##name params \
+	{ \
+		struct glplatform_gl_dispatch *dispatch = GLPLATFORM_GL_DISPATCH; \
+		if (dispatch) \
+			dispatch->d_##name args; \
+		else \
+			_glplatform_##name args; \
+	}
+#include "glcore_entry_points.h"
+
+/*
+ * GLPLATFORM_GL_HAS_ENTRY_POINT()
+ *
+ * True if the entry point 'name' was resolved for the current context. With
+ * GLPLATFORM_GL_USE_DISPATCH defined gl<name> is a function, so use this
+ * instead of testing the pointer.
+ *
+ */
+#define GLPLATFORM_GL_HAS_ENTRY_POINT(name) \
+	(GLPLATFORM_GL_DISPATCH ? GLPLATFORM_GL_DISPATCH->d_##name != NULL : _glplatform_##name != NULL)
+
+#ifdef GLPLATFORM_GL_USE_DISPATCH
+#include "glcore_dispatch_defines.h"
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,1436 @@
+/* Generated by gen_entry_points.py from glcore.c, do not edit */
+
+/* Included by glcore_dispatch.h when GLPLATFORM_GL_USE_DISPATCH is defined */
+
+#undef glActiveShaderProgram
+#define glActiveShaderProgram glplatform_dispatch_glActiveShaderProgram
+#undef glActiveTexture
+#define glActiveTexture glplatform_dispatch_glActiveTexture
+#undef glAttachShader
+#define glAttachShader glplatform_dispatch_glAttachShader
+#undef glBeginConditionalRender
+#define glBeginConditionalRender glplatform_dispatch_glBeginConditionalRender
+#undef glBeginQuery
+#define glBeginQuery glplatform_dispatch_glBeginQuery
+#undef glBeginQueryIndexed
+#define glBeginQueryIndexed glplatform_dispatch_glBeginQueryIndexed
+#undef glBeginTransformFeedback
+#define glBeginTransformFeedback glplatform_dispatch_glBeginTransformFeedback
+#undef glBindAttribLocation
+#define glBindAttribLocation glplatform_dispatch_glBindAttribLocation
+#undef glBindBuffer
+#define glBindBuffer glplatform_dispatch_glBindBuffer
+#undef glBindBufferBase
+#define glBindBufferBase glplatform_dispatch_glBindBufferBase
+#undef glBindBufferRange
+#define glBindBufferRange glplatform_dispatch_glBindBufferRange
+#undef glBindBuffersBase
+#define glBindBuffersBase glplatform_dispatch_glBindBuffersBase
+#undef glBindBuffersRange
+#define glBindBuffersRange glplatform_dispatch_glBindBuffersRange
+#undef glBindFragDataLocation
+#define glBindFragDataLocation glplatform_dispatch_glBindFragDataLocation
+#undef glBindFragDataLocationIndexed
+#define glBindFragDataLocationIndexed glplatform_dispatch_glBindFragDataLocationIndexed
+#undef glBindFramebuffer
+#define glBindFramebuffer glplatform_dispatch_glBindFramebuffer
+#undef glBindImageTexture
+#define glBindImageTexture glplatform_dispatch_glBindImageTexture
+#undef glBindImageTextures
+#define glBindImageTextures glplatform_dispatch_glBindImageTextures
+#undef glBindProgramPipeline
+#define glBindProgramPipeline glplatform_dispatch_glBindProgramPipeline
+#undef glBindRenderbuffer
+#define glBindRenderbuffer glplatform_dispatch_glBindRenderbuffer
+#undef glBindSampler
+#define glBindSampler glplatform_dispatch_glBindSampler
+#undef glBindSamplers
+#define glBindSamplers glplatform_dispatch_glBindSamplers
+#undef glBindTexture
+#define glBindTexture glplatform_dispatch_glBindTexture
+#undef glBindTextureUnit
+#define glBindTextureUnit glplatform_dispatch_glBindTextureUnit
+#undef glBindTextures
+#define glBindTextures glplatform_dispatch_glBindTextures
+#undef glBindTransformFeedback
+#define glBindTransformFeedback glplatform_dispatch_glBindTransformFeedback
+#undef glBindVertexArray
+#define glBindVertexArray glplatform_dispatch_glBindVertexArray
+#undef glBindVertexBuffer
+#define glBindVertexBuffer glplatform_dispatch_glBindVertexBuffer
+#undef glBindVertexBuffers
+#define glBindVertexBuffers glplatform_dispatch_glBindVertexBuffers
+#undef glBlendColor
+#define glBlendColor glplatform_dispatch_glBlendColor
+#undef glBlendEquation
+#define glBlendEquation glplatform_dispatch_glBlendEquation
+#undef glBlendEquationSeparate
+#define glBlendEquationSeparate glplatform_dispatch_glBlendEquationSeparate
+#undef glBlendEquationSeparatei
+#define glBlendEquationSeparatei glplatform_dispatch_glBlendEquationSeparatei
+#undef glBlendEquationSeparateiARB
+#define glBlendEquationSeparateiARB glplatform_dispatch_glBlendEquationSeparateiARB
+#undef glBlendEquationi
+#define glBlendEquationi glplatform_dispatch_glBlendEquationi
+#undef glBlendEquationiARB
+#define glBlendEquationiARB glplatform_dispatch_glBlendEquationiARB
+#undef glBlendFunc
+#define glBlendFunc glplatform_dispatch_glBlendFunc
+#undef glBlendFuncSeparate
+#define glBlendFuncSeparate glplatform_dispatch_glBlendFuncSeparate
+#undef glBlendFuncSeparatei
+#define glBlendFuncSeparatei glplatform_dispatch_glBlendFuncSeparatei
+#undef glBlendFuncSeparateiARB
+#define glBlendFuncSeparateiARB glplatform_dispatch_glBlendFuncSeparateiARB
+#undef glBlendFunci
+#define glBlendFunci glplatform_dispatch_glBlendFunci
+#undef glBlendFunciARB
+#define glBlendFunciARB glplatform_dispatch_glBlendFunciARB
+#undef glBlitFramebuffer
+#define glBlitFramebuffer glplatform_dispatch_glBlitFramebuffer
+#undef glBlitNamedFramebuffer
+#define glBlitNamedFramebuffer glplatform_dispatch_glBlitNamedFramebuffer
+#undef glBufferData
+#define glBufferData glplatform_dispatch_glBufferData
+#undef glBufferPageCommitmentARB
+#define glBufferPageCommitmentARB glplatform_dispatch_glBufferPageCommitmentARB
+#undef glBufferStorage
+#define glBufferStorage glplatform_dispatch_glBufferStorage
+#undef glBufferSubData
+#define glBufferSubData glplatform_dispatch_glBufferSubData
+#undef glCheckFramebufferStatus
+#define glCheckFramebufferStatus glplatform_dispatch_glCheckFramebufferStatus
+#undef glCheckNamedFramebufferStatus
+#define glCheckNamedFramebufferStatus glplatform_dispatch_glCheckNamedFramebufferStatus
+#undef glClampColor
+#define glClampColor glplatform_dispatch_glClampColor
+#undef glClear
+#define glClear glplatform_dispatch_glClear
+#undef glClearBufferData
+#define glClearBufferData glplatform_dispatch_glClearBufferData
+#undef glClearBufferSubData
+#define glClearBufferSubData glplatform_dispatch_glClearBufferSubData
+#undef glClearBufferfi
+#define glClearBufferfi glplatform_dispatch_glClearBufferfi
+#undef glClearBufferfv
+#define glClearBufferfv glplatform_dispatch_glClearBufferfv
+#undef glClearBufferiv
+#define glClearBufferiv glplatform_dispatch_glClearBufferiv
+#undef glClearBufferuiv
+#define glClearBufferuiv glplatform_dispatch_glClearBufferuiv
+#undef glClearColor
+#define glClearColor glplatform_dispatch_glClearColor
+#undef glClearDepth
+#define glClearDepth glplatform_dispatch_glClearDepth
+#undef glClearDepthf
+#define glClearDepthf glplatform_dispatch_glClearDepthf
+#undef glClearNamedBufferData
+#define glClearNamedBufferData glplatform_dispatch_glClearNamedBufferData
+#undef glClearNamedBufferSubData
+#define glClearNamedBufferSubData glplatform_dispatch_glClearNamedBufferSubData
+#undef glClearNamedFramebufferfi
+#define glClearNamedFramebufferfi glplatform_dispatch_glClearNamedFramebufferfi
+#undef glClearNamedFramebufferfv
+#define glClearNamedFramebufferfv glplatform_dispatch_glClearNamedFramebufferfv
+#undef glClearNamedFramebufferiv
+#define glClearNamedFramebufferiv glplatform_dispatch_glClearNamedFramebufferiv
+#undef glClearNamedFramebufferuiv
+#define glClearNamedFramebufferuiv glplatform_dispatch_glClearNamedFramebufferuiv
+#undef glClearStencil
+#define glClearStencil glplatform_dispatch_glClearStencil
+#undef glClearTexImage
+#define glClearTexImage glplatform_dispatch_glClearTexImage
+#undef glClearTexSubImage
+#define glClearTexSubImage glplatform_dispatch_glClearTexSubImage
+#undef glClientWaitSync
+#define glClientWaitSync glplatform_dispatch_glClientWaitSync
+#undef glClipControl
+#define glClipControl glplatform_dispatch_glClipControl
+#undef glColorMask
+#define glColorMask glplatform_dispatch_glColorMask
+#undef glColorMaski
+#define glColorMaski glplatform_dispatch_glColorMaski
+#undef glCompileShader
+#define glCompileShader glplatform_dispatch_glCompileShader
+#undef glCompileShaderIncludeARB
+#define glCompileShaderIncludeARB glplatform_dispatch_glCompileShaderIncludeARB
+#undef glCompressedTexImage1D
+#define glCompressedTexImage1D glplatform_dispatch_glCompressedTexImage1D
+#undef glCompressedTexImage2D
+#define glCompressedTexImage2D glplatform_dispatch_glCompressedTexImage2D
+#undef glCompressedTexImage3D
+#define glCompressedTexImage3D glplatform_dispatch_glCompressedTexImage3D
+#undef glCompressedTexSubImage1D
+#define glCompressedTexSubImage1D glplatform_dispatch_glCompressedTexSubImage1D
+#undef glCompressedTexSubImage2D
+#define glCompressedTexSubImage2D glplatform_dispatch_glCompressedTexSubImage2D
+#undef glCompressedTexSubImage3D
+#define glCompressedTexSubImage3D glplatform_dispatch_glCompressedTexSubImage3D
+#undef glCompressedTextureSubImage1D
+#define glCompressedTextureSubImage1D glplatform_dispatch_glCompressedTextureSubImage1D
+#undef glCompressedTextureSubImage2D
+#define glCompressedTextureSubImage2D glplatform_dispatch_glCompressedTextureSubImage2D
+#undef glCompressedTextureSubImage3D
+#define glCompressedTextureSubImage3D glplatform_dispatch_glCompressedTextureSubImage3D
+#undef glCopyBufferSubData
+#define glCopyBufferSubData glplatform_dispatch_glCopyBufferSubData
+#undef glCopyImageSubData
+#define glCopyImageSubData glplatform_dispatch_glCopyImageSubData
+#undef glCopyNamedBufferSubData
+#define glCopyNamedBufferSubData glplatform_dispatch_glCopyNamedBufferSubData
+#undef glCopyTexImage1D
+#define glCopyTexImage1D glplatform_dispatch_glCopyTexImage1D
+#undef glCopyTexImage2D
+#define glCopyTexImage2D glplatform_dispatch_glCopyTexImage2D
+#undef glCopyTexSubImage1D
+#define glCopyTexSubImage1D glplatform_dispatch_glCopyTexSubImage1D
+#undef glCopyTexSubImage2D
+#define glCopyTexSubImage2D glplatform_dispatch_glCopyTexSubImage2D
+#undef glCopyTexSubImage3D
+#define glCopyTexSubImage3D glplatform_dispatch_glCopyTexSubImage3D
+#undef glCopyTextureSubImage1D
+#define glCopyTextureSubImage1D glplatform_dispatch_glCopyTextureSubImage1D
+#undef glCopyTextureSubImage2D
+#define glCopyTextureSubImage2D glplatform_dispatch_glCopyTextureSubImage2D
+#undef glCopyTextureSubImage3D
+#define glCopyTextureSubImage3D glplatform_dispatch_glCopyTextureSubImage3D
+#undef glCreateBuffers
+#define glCreateBuffers glplatform_dispatch_glCreateBuffers
+#undef glCreateFramebuffers
+#define glCreateFramebuffers glplatform_dispatch_glCreateFramebuffers
+#undef glCreateProgram
+#define glCreateProgram glplatform_dispatch_glCreateProgram
+#undef glCreateProgramPipelines
+#define glCreateProgramPipelines glplatform_dispatch_glCreateProgramPipelines
+#undef glCreateQueries
+#define glCreateQueries glplatform_dispatch_glCreateQueries
+#undef glCreateRenderbuffers
+#define glCreateRenderbuffers glplatform_dispatch_glCreateRenderbuffers
+#undef glCreateSamplers
+#define glCreateSamplers glplatform_dispatch_glCreateSamplers
+#undef glCreateShader
+#define glCreateShader glplatform_dispatch_glCreateShader
+#undef glCreateShaderProgramv
+#define glCreateShaderProgramv glplatform_dispatch_glCreateShaderProgramv
+#undef glCreateSyncFromCLeventARB
+#define glCreateSyncFromCLeventARB glplatform_dispatch_glCreateSyncFromCLeventARB
+#undef glCreateTextures
+#define glCreateTextures glplatform_dispatch_glCreateTextures
+#undef glCreateTransformFeedbacks
+#define glCreateTransformFeedbacks glplatform_dispatch_glCreateTransformFeedbacks
+#undef glCreateVertexArrays
+#define glCreateVertexArrays glplatform_dispatch_glCreateVertexArrays
+#undef glCullFace
+#define glCullFace glplatform_dispatch_glCullFace
+#undef glDebugMessageCallback
+#define glDebugMessageCallback glplatform_dispatch_glDebugMessageCallback
+#undef glDebugMessageCallbackARB
+#define glDebugMessageCallbackARB glplatform_dispatch_glDebugMessageCallbackARB
+#undef glDebugMessageCallbackKHR
+#define glDebugMessageCallbackKHR glplatform_dispatch_glDebugMessageCallbackKHR
+#undef glDebugMessageControl
+#define glDebugMessageControl glplatform_dispatch_glDebugMessageControl
+#undef glDebugMessageControlARB
+#define glDebugMessageControlARB glplatform_dispatch_glDebugMessageControlARB
+#undef glDebugMessageControlKHR
+#define glDebugMessageControlKHR glplatform_dispatch_glDebugMessageControlKHR
+#undef glDebugMessageInsert
+#define glDebugMessageInsert glplatform_dispatch_glDebugMessageInsert
+#undef glDebugMessageInsertARB
+#define glDebugMessageInsertARB glplatform_dispatch_glDebugMessageInsertARB
+#undef glDebugMessageInsertKHR
+#define glDebugMessageInsertKHR glplatform_dispatch_glDebugMessageInsertKHR
+#undef glDeleteBuffers
+#define glDeleteBuffers glplatform_dispatch_glDeleteBuffers
+#undef glDeleteFramebuffers
+#define glDeleteFramebuffers glplatform_dispatch_glDeleteFramebuffers
+#undef glDeleteNamedStringARB
+#define glDeleteNamedStringARB glplatform_dispatch_glDeleteNamedStringARB
+#undef glDeleteProgram
+#define glDeleteProgram glplatform_dispatch_glDeleteProgram
+#undef glDeleteProgramPipelines
+#define glDeleteProgramPipelines glplatform_dispatch_glDeleteProgramPipelines
+#undef glDeleteQueries
+#define glDeleteQueries glplatform_dispatch_glDeleteQueries
+#undef glDeleteRenderbuffers
+#define glDeleteRenderbuffers glplatform_dispatch_glDeleteRenderbuffers
+#undef glDeleteSamplers
+#define glDeleteSamplers glplatform_dispatch_glDeleteSamplers
+#undef glDeleteShader
+#define glDeleteShader glplatform_dispatch_glDeleteShader
+#undef glDeleteSync
+#define glDeleteSync glplatform_dispatch_glDeleteSync
+#undef glDeleteTextures
+#define glDeleteTextures glplatform_dispatch_glDeleteTextures
+#undef glDeleteTransformFeedbacks
+#define glDeleteTransformFeedbacks glplatform_dispatch_glDeleteTransformFeedbacks
+#undef glDeleteVertexArrays
+#define glDeleteVertexArrays glplatform_dispatch_glDeleteVertexArrays
+#undef glDepthFunc
+#define glDepthFunc glplatform_dispatch_glDepthFunc
+#undef glDepthMask
+#define glDepthMask glplatform_dispatch_glDepthMask
+#undef glDepthRange
+#define glDepthRange glplatform_dispatch_glDepthRange
+#undef glDepthRangeArrayv
+#define glDepthRangeArrayv glplatform_dispatch_glDepthRangeArrayv
+#undef glDepthRangeIndexed
+#define glDepthRangeIndexed glplatform_dispatch_glDepthRangeIndexed
+#undef glDepthRangef
+#define glDepthRangef glplatform_dispatch_glDepthRangef
+#undef glDetachShader
+#define glDetachShader glplatform_dispatch_glDetachShader
+#undef glDisable
+#define glDisable glplatform_dispatch_glDisable
+#undef glDisableVertexArrayAttrib
+#define glDisableVertexArrayAttrib glplatform_dispatch_glDisableVertexArrayAttrib
+#undef glDisableVertexAttribArray
+#define glDisableVertexAttribArray glplatform_dispatch_glDisableVertexAttribArray
+#undef glDisablei
+#define glDisablei glplatform_dispatch_glDisablei
+#undef glDispatchCompute
+#define glDispatchCompute glplatform_dispatch_glDispatchCompute
+#undef glDispatchComputeGroupSizeARB
+#define glDispatchComputeGroupSizeARB glplatform_dispatch_glDispatchComputeGroupSizeARB
+#undef glDispatchComputeIndirect
+#define glDispatchComputeIndirect glplatform_dispatch_glDispatchComputeIndirect
+#undef glDrawArrays
+#define glDrawArrays glplatform_dispatch_glDrawArrays
+#undef glDrawArraysIndirect
+#define glDrawArraysIndirect glplatform_dispatch_glDrawArraysIndirect
+#undef glDrawArraysInstanced
+#define glDrawArraysInstanced glplatform_dispatch_glDrawArraysInstanced
+#undef glDrawArraysInstancedBaseInstance
+#define glDrawArraysInstancedBaseInstance glplatform_dispatch_glDrawArraysInstancedBaseInstance
+#undef glDrawBuffer
+#define glDrawBuffer glplatform_dispatch_glDrawBuffer
+#undef glDrawBuffers
+#define glDrawBuffers glplatform_dispatch_glDrawBuffers
+#undef glDrawElements
+#define glDrawElements glplatform_dispatch_glDrawElements
+#undef glDrawElementsBaseVertex
+#define glDrawElementsBaseVertex glplatform_dispatch_glDrawElementsBaseVertex
+#undef glDrawElementsIndirect
+#define glDrawElementsIndirect glplatform_dispatch_glDrawElementsIndirect
+#undef glDrawElementsInstanced
+#define glDrawElementsInstanced glplatform_dispatch_glDrawElementsInstanced
+#undef glDrawElementsInstancedBaseInstance
+#define glDrawElementsInstancedBaseInstance glplatform_dispatch_glDrawElementsInstancedBaseInstance
+#undef glDrawElementsInstancedBaseVertex
+#define glDrawElementsInstancedBaseVertex glplatform_dispatch_glDrawElementsInstancedBaseVertex
+#undef glDrawElementsInstancedBaseVertexBaseInstance
+#define glDrawElementsInstancedBaseVertexBaseInstance glplatform_dispatch_glDrawElementsInstancedBaseVertexBaseInstance
+#undef glDrawRangeElements
+#define glDrawRangeElements glplatform_dispatch_glDrawRangeElements
+#undef glDrawRangeElementsBaseVertex
+#define glDrawRangeElementsBaseVertex glplatform_dispatch_glDrawRangeElementsBaseVertex
+#undef glDrawTransformFeedback
+#define glDrawTransformFeedback glplatform_dispatch_glDrawTransformFeedback
+#undef glDrawTransformFeedbackInstanced
+#define glDrawTransformFeedbackInstanced glplatform_dispatch_glDrawTransformFeedbackInstanced
+#undef glDrawTransformFeedbackStream
+#define glDrawTransformFeedbackStream glplatform_dispatch_glDrawTransformFeedbackStream
+#undef glDrawTransformFeedbackStreamInstanced
+#define glDrawTransformFeedbackStreamInstanced glplatform_dispatch_glDrawTransformFeedbackStreamInstanced
+#undef glEnable
+#define glEnable glplatform_dispatch_glEnable
+#undef glEnableVertexArrayAttrib
+#define glEnableVertexArrayAttrib glplatform_dispatch_glEnableVertexArrayAttrib
+#undef glEnableVertexAttribArray
+#define glEnableVertexAttribArray glplatform_dispatch_glEnableVertexAttribArray
+#undef glEnablei
+#define glEnablei glplatform_dispatch_glEnablei
+#undef glEndConditionalRender
+#define glEndConditionalRender glplatform_dispatch_glEndConditionalRender
+#undef glEndQuery
+#define glEndQuery glplatform_dispatch_glEndQuery
+#undef glEndQueryIndexed
+#define glEndQueryIndexed glplatform_dispatch_glEndQueryIndexed
+#undef glEndTransformFeedback
+#define glEndTransformFeedback glplatform_dispatch_glEndTransformFeedback
+#undef glFenceSync
+#define glFenceSync glplatform_dispatch_glFenceSync
+#undef glFinish
+#define glFinish glplatform_dispatch_glFinish
+#undef glFlush
+#define glFlush glplatform_dispatch_glFlush
+#undef glFlushMappedBufferRange
+#define glFlushMappedBufferRange glplatform_dispatch_glFlushMappedBufferRange
+#undef glFlushMappedNamedBufferRange
+#define glFlushMappedNamedBufferRange glplatform_dispatch_glFlushMappedNamedBufferRange
+#undef glFramebufferParameteri
+#define glFramebufferParameteri glplatform_dispatch_glFramebufferParameteri
+#undef glFramebufferRenderbuffer
+#define glFramebufferRenderbuffer glplatform_dispatch_glFramebufferRenderbuffer
+#undef glFramebufferTexture
+#define glFramebufferTexture glplatform_dispatch_glFramebufferTexture
+#undef glFramebufferTexture1D
+#define glFramebufferTexture1D glplatform_dispatch_glFramebufferTexture1D
+#undef glFramebufferTexture2D
+#define glFramebufferTexture2D glplatform_dispatch_glFramebufferTexture2D
+#undef glFramebufferTexture3D
+#define glFramebufferTexture3D glplatform_dispatch_glFramebufferTexture3D
+#undef glFramebufferTextureLayer
+#define glFramebufferTextureLayer glplatform_dispatch_glFramebufferTextureLayer
+#undef glFrontFace
+#define glFrontFace glplatform_dispatch_glFrontFace
+#undef glGenBuffers
+#define glGenBuffers glplatform_dispatch_glGenBuffers
+#undef glGenFramebuffers
+#define glGenFramebuffers glplatform_dispatch_glGenFramebuffers
+#undef glGenProgramPipelines
+#define glGenProgramPipelines glplatform_dispatch_glGenProgramPipelines
+#undef glGenQueries
+#define glGenQueries glplatform_dispatch_glGenQueries
+#undef glGenRenderbuffers
+#define glGenRenderbuffers glplatform_dispatch_glGenRenderbuffers
+#undef glGenSamplers
+#define glGenSamplers glplatform_dispatch_glGenSamplers
+#undef glGenTextures
+#define glGenTextures glplatform_dispatch_glGenTextures
+#undef glGenTransformFeedbacks
+#define glGenTransformFeedbacks glplatform_dispatch_glGenTransformFeedbacks
+#undef glGenVertexArrays
+#define glGenVertexArrays glplatform_dispatch_glGenVertexArrays
+#undef glGenerateMipmap
+#define glGenerateMipmap glplatform_dispatch_glGenerateMipmap
+#undef glGenerateTextureMipmap
+#define glGenerateTextureMipmap glplatform_dispatch_glGenerateTextureMipmap
+#undef glGetActiveAtomicCounterBufferiv
+#define glGetActiveAtomicCounterBufferiv glplatform_dispatch_glGetActiveAtomicCounterBufferiv
+#undef glGetActiveAttrib
+#define glGetActiveAttrib glplatform_dispatch_glGetActiveAttrib
+#undef glGetActiveSubroutineName
+#define glGetActiveSubroutineName glplatform_dispatch_glGetActiveSubroutineName
+#undef glGetActiveSubroutineUniformName
+#define glGetActiveSubroutineUniformName glplatform_dispatch_glGetActiveSubroutineUniformName
+#undef glGetActiveSubroutineUniformiv
+#define glGetActiveSubroutineUniformiv glplatform_dispatch_glGetActiveSubroutineUniformiv
+#undef glGetActiveUniform
+#define glGetActiveUniform glplatform_dispatch_glGetActiveUniform
+#undef glGetActiveUniformBlockName
+#define glGetActiveUniformBlockName glplatform_dispatch_glGetActiveUniformBlockName
+#undef glGetActiveUniformBlockiv
+#define glGetActiveUniformBlockiv glplatform_dispatch_glGetActiveUniformBlockiv
+#undef glGetActiveUniformName
+#define glGetActiveUniformName glplatform_dispatch_glGetActiveUniformName
+#undef glGetActiveUniformsiv
+#define glGetActiveUniformsiv glplatform_dispatch_glGetActiveUniformsiv
+#undef glGetAttachedShaders
+#define glGetAttachedShaders glplatform_dispatch_glGetAttachedShaders
+#undef glGetAttribLocation
+#define glGetAttribLocation glplatform_dispatch_glGetAttribLocation
+#undef glGetBooleani_v
+#define glGetBooleani_v glplatform_dispatch_glGetBooleani_v
+#undef glGetBooleanv
+#define glGetBooleanv glplatform_dispatch_glGetBooleanv
+#undef glGetBufferParameteri64v
+#define glGetBufferParameteri64v glplatform_dispatch_glGetBufferParameteri64v
+#undef glGetBufferParameteriv
+#define glGetBufferParameteriv glplatform_dispatch_glGetBufferParameteriv
+#undef glGetBufferPointerv
+#define glGetBufferPointerv glplatform_dispatch_glGetBufferPointerv
+#undef glGetBufferSubData
+#define glGetBufferSubData glplatform_dispatch_glGetBufferSubData
+#undef glGetCompressedTexImage
+#define glGetCompressedTexImage glplatform_dispatch_glGetCompressedTexImage
+#undef glGetCompressedTextureImage
+#define glGetCompressedTextureImage glplatform_dispatch_glGetCompressedTextureImage
+#undef glGetCompressedTextureSubImage
+#define glGetCompressedTextureSubImage glplatform_dispatch_glGetCompressedTextureSubImage
+#undef glGetDebugMessageLog
+#define glGetDebugMessageLog glplatform_dispatch_glGetDebugMessageLog
+#undef glGetDebugMessageLogARB
+#define glGetDebugMessageLogARB glplatform_dispatch_glGetDebugMessageLogARB
+#undef glGetDebugMessageLogKHR
+#define glGetDebugMessageLogKHR glplatform_dispatch_glGetDebugMessageLogKHR
+#undef glGetDoublei_v
+#define glGetDoublei_v glplatform_dispatch_glGetDoublei_v
+#undef glGetDoublev
+#define glGetDoublev glplatform_dispatch_glGetDoublev
+#undef glGetError
+#define glGetError glplatform_dispatch_glGetError
+#undef glGetFloati_v
+#define glGetFloati_v glplatform_dispatch_glGetFloati_v
+#undef glGetFloatv
+#define glGetFloatv glplatform_dispatch_glGetFloatv
+#undef glGetFragDataIndex
+#define glGetFragDataIndex glplatform_dispatch_glGetFragDataIndex
+#undef glGetFragDataLocation
+#define glGetFragDataLocation glplatform_dispatch_glGetFragDataLocation
+#undef glGetFramebufferAttachmentParameteriv
+#define glGetFramebufferAttachmentParameteriv glplatform_dispatch_glGetFramebufferAttachmentParameteriv
+#undef glGetFramebufferParameteriv
+#define glGetFramebufferParameteriv glplatform_dispatch_glGetFramebufferParameteriv
+#undef glGetGraphicsResetStatus
+#define glGetGraphicsResetStatus glplatform_dispatch_glGetGraphicsResetStatus
+#undef glGetGraphicsResetStatusARB
+#define glGetGraphicsResetStatusARB glplatform_dispatch_glGetGraphicsResetStatusARB
+#undef glGetGraphicsResetStatusKHR
+#define glGetGraphicsResetStatusKHR glplatform_dispatch_glGetGraphicsResetStatusKHR
+#undef glGetImageHandleARB
+#define glGetImageHandleARB glplatform_dispatch_glGetImageHandleARB
+#undef glGetInteger64i_v
+#define glGetInteger64i_v glplatform_dispatch_glGetInteger64i_v
+#undef glGetInteger64v
+#define glGetInteger64v glplatform_dispatch_glGetInteger64v
+#undef glGetIntegeri_v
+#define glGetIntegeri_v glplatform_dispatch_glGetIntegeri_v
+#undef glGetIntegerv
+#define glGetIntegerv glplatform_dispatch_glGetIntegerv
+#undef glGetInternalformati64v
+#define glGetInternalformati64v glplatform_dispatch_glGetInternalformati64v
+#undef glGetInternalformativ
+#define glGetInternalformativ glplatform_dispatch_glGetInternalformativ
+#undef glGetMultisamplefv
+#define glGetMultisamplefv glplatform_dispatch_glGetMultisamplefv
+#undef glGetNamedBufferParameteri64v
+#define glGetNamedBufferParameteri64v glplatform_dispatch_glGetNamedBufferParameteri64v
+#undef glGetNamedBufferParameteriv
+#define glGetNamedBufferParameteriv glplatform_dispatch_glGetNamedBufferParameteriv
+#undef glGetNamedBufferPointerv
+#define glGetNamedBufferPointerv glplatform_dispatch_glGetNamedBufferPointerv
+#undef glGetNamedBufferSubData
+#define glGetNamedBufferSubData glplatform_dispatch_glGetNamedBufferSubData
+#undef glGetNamedFramebufferAttachmentParameteriv
+#define glGetNamedFramebufferAttachmentParameteriv glplatform_dispatch_glGetNamedFramebufferAttachmentParameteriv
+#undef glGetNamedFramebufferParameteriv
+#define glGetNamedFramebufferParameteriv glplatform_dispatch_glGetNamedFramebufferParameteriv
+#undef glGetNamedRenderbufferParameteriv
+#define glGetNamedRenderbufferParameteriv glplatform_dispatch_glGetNamedRenderbufferParameteriv
+#undef glGetNamedStringARB
+#define glGetNamedStringARB glplatform_dispatch_glGetNamedStringARB
+#undef glGetNamedStringivARB
+#define glGetNamedStringivARB glplatform_dispatch_glGetNamedStringivARB
+#undef glGetObjectLabel
+#define glGetObjectLabel glplatform_dispatch_glGetObjectLabel
+#undef glGetObjectLabelKHR
+#define glGetObjectLabelKHR glplatform_dispatch_glGetObjectLabelKHR
+#undef glGetObjectPtrLabel
+#define glGetObjectPtrLabel glplatform_dispatch_glGetObjectPtrLabel
+#undef glGetObjectPtrLabelKHR
+#define glGetObjectPtrLabelKHR glplatform_dispatch_glGetObjectPtrLabelKHR
+#undef glGetPointerv
+#define glGetPointerv glplatform_dispatch_glGetPointerv
+#undef glGetPointervKHR
+#define glGetPointervKHR glplatform_dispatch_glGetPointervKHR
+#undef glGetProgramBinary
+#define glGetProgramBinary glplatform_dispatch_glGetProgramBinary
+#undef glGetProgramInfoLog
+#define glGetProgramInfoLog glplatform_dispatch_glGetProgramInfoLog
+#undef glGetProgramInterfaceiv
+#define glGetProgramInterfaceiv glplatform_dispatch_glGetProgramInterfaceiv
+#undef glGetProgramPipelineInfoLog
+#define glGetProgramPipelineInfoLog glplatform_dispatch_glGetProgramPipelineInfoLog
+#undef glGetProgramPipelineiv
+#define glGetProgramPipelineiv glplatform_dispatch_glGetProgramPipelineiv
+#undef glGetProgramResourceIndex
+#define glGetProgramResourceIndex glplatform_dispatch_glGetProgramResourceIndex
+#undef glGetProgramResourceLocation
+#define glGetProgramResourceLocation glplatform_dispatch_glGetProgramResourceLocation
+#undef glGetProgramResourceLocationIndex
+#define glGetProgramResourceLocationIndex glplatform_dispatch_glGetProgramResourceLocationIndex
+#undef glGetProgramResourceName
+#define glGetProgramResourceName glplatform_dispatch_glGetProgramResourceName
+#undef glGetProgramResourceiv
+#define glGetProgramResourceiv glplatform_dispatch_glGetProgramResourceiv
+#undef glGetProgramStageiv
+#define glGetProgramStageiv glplatform_dispatch_glGetProgramStageiv
+#undef glGetProgramiv
+#define glGetProgramiv glplatform_dispatch_glGetProgramiv
+#undef glGetQueryBufferObjecti64v
+#define glGetQueryBufferObjecti64v glplatform_dispatch_glGetQueryBufferObjecti64v
+#undef glGetQueryBufferObjectiv
+#define glGetQueryBufferObjectiv glplatform_dispatch_glGetQueryBufferObjectiv
+#undef glGetQueryBufferObjectui64v
+#define glGetQueryBufferObjectui64v glplatform_dispatch_glGetQueryBufferObjectui64v
+#undef glGetQueryBufferObjectuiv
+#define glGetQueryBufferObjectuiv glplatform_dispatch_glGetQueryBufferObjectuiv
+#undef glGetQueryIndexediv
+#define glGetQueryIndexediv glplatform_dispatch_glGetQueryIndexediv
+#undef glGetQueryObjecti64v
+#define glGetQueryObjecti64v glplatform_dispatch_glGetQueryObjecti64v
+#undef glGetQueryObjectiv
+#define glGetQueryObjectiv glplatform_dispatch_glGetQueryObjectiv
+#undef glGetQueryObjectui64v
+#define glGetQueryObjectui64v glplatform_dispatch_glGetQueryObjectui64v
+#undef glGetQueryObjectuiv
+#define glGetQueryObjectuiv glplatform_dispatch_glGetQueryObjectuiv
+#undef glGetQueryiv
+#define glGetQueryiv glplatform_dispatch_glGetQueryiv
+#undef glGetRenderbufferParameteriv
+#define glGetRenderbufferParameteriv glplatform_dispatch_glGetRenderbufferParameteriv
+#undef glGetSamplerParameterIiv
+#define glGetSamplerParameterIiv glplatform_dispatch_glGetSamplerParameterIiv
+#undef glGetSamplerParameterIuiv
+#define glGetSamplerParameterIuiv glplatform_dispatch_glGetSamplerParameterIuiv
+#undef glGetSamplerParameterfv
+#define glGetSamplerParameterfv glplatform_dispatch_glGetSamplerParameterfv
+#undef glGetSamplerParameteriv
+#define glGetSamplerParameteriv glplatform_dispatch_glGetSamplerParameteriv
+#undef glGetShaderInfoLog
+#define glGetShaderInfoLog glplatform_dispatch_glGetShaderInfoLog
+#undef glGetShaderPrecisionFormat
+#define glGetShaderPrecisionFormat glplatform_dispatch_glGetShaderPrecisionFormat
+#undef glGetShaderSource
+#define glGetShaderSource glplatform_dispatch_glGetShaderSource
+#undef glGetShaderiv
+#define glGetShaderiv glplatform_dispatch_glGetShaderiv
+#undef glGetString
+#define glGetString glplatform_dispatch_glGetString
+#undef glGetStringi
+#define glGetStringi glplatform_dispatch_glGetStringi
+#undef glGetSubroutineIndex
+#define glGetSubroutineIndex glplatform_dispatch_glGetSubroutineIndex
+#undef glGetSubroutineUniformLocation
+#define glGetSubroutineUniformLocation glplatform_dispatch_glGetSubroutineUniformLocation
+#undef glGetSynciv
+#define glGetSynciv glplatform_dispatch_glGetSynciv
+#undef glGetTexImage
+#define glGetTexImage glplatform_dispatch_glGetTexImage
+#undef glGetTexLevelParameterfv
+#define glGetTexLevelParameterfv glplatform_dispatch_glGetTexLevelParameterfv
+#undef glGetTexLevelParameteriv
+#define glGetTexLevelParameteriv glplatform_dispatch_glGetTexLevelParameteriv
+#undef glGetTexParameterIiv
+#define glGetTexParameterIiv glplatform_dispatch_glGetTexParameterIiv
+#undef glGetTexParameterIuiv
+#define glGetTexParameterIuiv glplatform_dispatch_glGetTexParameterIuiv
+#undef glGetTexParameterfv
+#define glGetTexParameterfv glplatform_dispatch_glGetTexParameterfv
+#undef glGetTexParameteriv
+#define glGetTexParameteriv glplatform_dispatch_glGetTexParameteriv
+#undef glGetTextureHandleARB
+#define glGetTextureHandleARB glplatform_dispatch_glGetTextureHandleARB
+#undef glGetTextureImage
+#define glGetTextureImage glplatform_dispatch_glGetTextureImage
+#undef glGetTextureLevelParameterfv
+#define glGetTextureLevelParameterfv glplatform_dispatch_glGetTextureLevelParameterfv
+#undef glGetTextureLevelParameteriv
+#define glGetTextureLevelParameteriv glplatform_dispatch_glGetTextureLevelParameteriv
+#undef glGetTextureParameterIiv
+#define glGetTextureParameterIiv glplatform_dispatch_glGetTextureParameterIiv
+#undef glGetTextureParameterIuiv
+#define glGetTextureParameterIuiv glplatform_dispatch_glGetTextureParameterIuiv
+#undef glGetTextureParameterfv
+#define glGetTextureParameterfv glplatform_dispatch_glGetTextureParameterfv
+#undef glGetTextureParameteriv
+#define glGetTextureParameteriv glplatform_dispatch_glGetTextureParameteriv
+#undef glGetTextureSamplerHandleARB
+#define glGetTextureSamplerHandleARB glplatform_dispatch_glGetTextureSamplerHandleARB
+#undef glGetTextureSubImage
+#define glGetTextureSubImage glplatform_dispatch_glGetTextureSubImage
+#undef glGetTransformFeedbackVarying
+#define glGetTransformFeedbackVarying glplatform_dispatch_glGetTransformFeedbackVarying
+#undef glGetTransformFeedbacki64_v
+#define glGetTransformFeedbacki64_v glplatform_dispatch_glGetTransformFeedbacki64_v
+#undef glGetTransformFeedbacki_v
+#define glGetTransformFeedbacki_v glplatform_dispatch_glGetTransformFeedbacki_v
+#undef glGetTransformFeedbackiv
+#define glGetTransformFeedbackiv glplatform_dispatch_glGetTransformFeedbackiv
+#undef glGetUniformBlockIndex
+#define glGetUniformBlockIndex glplatform_dispatch_glGetUniformBlockIndex
+#undef glGetUniformIndices
+#define glGetUniformIndices glplatform_dispatch_glGetUniformIndices
+#undef glGetUniformLocation
+#define glGetUniformLocation glplatform_dispatch_glGetUniformLocation
+#undef glGetUniformSubroutineuiv
+#define glGetUniformSubroutineuiv glplatform_dispatch_glGetUniformSubroutineuiv
+#undef glGetUniformdv
+#define glGetUniformdv glplatform_dispatch_glGetUniformdv
+#undef glGetUniformfv
+#define glGetUniformfv glplatform_dispatch_glGetUniformfv
+#undef glGetUniformiv
+#define glGetUniformiv glplatform_dispatch_glGetUniformiv
+#undef glGetUniformuiv
+#define glGetUniformuiv glplatform_dispatch_glGetUniformuiv
+#undef glGetVertexArrayIndexed64iv
+#define glGetVertexArrayIndexed64iv glplatform_dispatch_glGetVertexArrayIndexed64iv
+#undef glGetVertexArrayIndexediv
+#define glGetVertexArrayIndexediv glplatform_dispatch_glGetVertexArrayIndexediv
+#undef glGetVertexArrayiv
+#define glGetVertexArrayiv glplatform_dispatch_glGetVertexArrayiv
+#undef glGetVertexAttribIiv
+#define glGetVertexAttribIiv glplatform_dispatch_glGetVertexAttribIiv
+#undef glGetVertexAttribIuiv
+#define glGetVertexAttribIuiv glplatform_dispatch_glGetVertexAttribIuiv
+#undef glGetVertexAttribLdv
+#define glGetVertexAttribLdv glplatform_dispatch_glGetVertexAttribLdv
+#undef glGetVertexAttribLui64vARB
+#define glGetVertexAttribLui64vARB glplatform_dispatch_glGetVertexAttribLui64vARB
+#undef glGetVertexAttribPointerv
+#define glGetVertexAttribPointerv glplatform_dispatch_glGetVertexAttribPointerv
+#undef glGetVertexAttribdv
+#define glGetVertexAttribdv glplatform_dispatch_glGetVertexAttribdv
+#undef glGetVertexAttribfv
+#define glGetVertexAttribfv glplatform_dispatch_glGetVertexAttribfv
+#undef glGetVertexAttribiv
+#define glGetVertexAttribiv glplatform_dispatch_glGetVertexAttribiv
+#undef glGetnCompressedTexImage
+#define glGetnCompressedTexImage glplatform_dispatch_glGetnCompressedTexImage
+#undef glGetnCompressedTexImageARB
+#define glGetnCompressedTexImageARB glplatform_dispatch_glGetnCompressedTexImageARB
+#undef glGetnTexImage
+#define glGetnTexImage glplatform_dispatch_glGetnTexImage
+#undef glGetnTexImageARB
+#define glGetnTexImageARB glplatform_dispatch_glGetnTexImageARB
+#undef glGetnUniformdv
+#define glGetnUniformdv glplatform_dispatch_glGetnUniformdv
+#undef glGetnUniformdvARB
+#define glGetnUniformdvARB glplatform_dispatch_glGetnUniformdvARB
+#undef glGetnUniformfv
+#define glGetnUniformfv glplatform_dispatch_glGetnUniformfv
+#undef glGetnUniformfvARB
+#define glGetnUniformfvARB glplatform_dispatch_glGetnUniformfvARB
+#undef glGetnUniformfvKHR
+#define glGetnUniformfvKHR glplatform_dispatch_glGetnUniformfvKHR
+#undef glGetnUniformiv
+#define glGetnUniformiv glplatform_dispatch_glGetnUniformiv
+#undef glGetnUniformivARB
+#define glGetnUniformivARB glplatform_dispatch_glGetnUniformivARB
+#undef glGetnUniformivKHR
+#define glGetnUniformivKHR glplatform_dispatch_glGetnUniformivKHR
+#undef glGetnUniformuiv
+#define glGetnUniformuiv glplatform_dispatch_glGetnUniformuiv
+#undef glGetnUniformuivARB
+#define glGetnUniformuivARB glplatform_dispatch_glGetnUniformuivARB
+#undef glGetnUniformuivKHR
+#define glGetnUniformuivKHR glplatform_dispatch_glGetnUniformuivKHR
+#undef glHint
+#define glHint glplatform_dispatch_glHint
+#undef glInvalidateBufferData
+#define glInvalidateBufferData glplatform_dispatch_glInvalidateBufferData
+#undef glInvalidateBufferSubData
+#define glInvalidateBufferSubData glplatform_dispatch_glInvalidateBufferSubData
+#undef glInvalidateFramebuffer
+#define glInvalidateFramebuffer glplatform_dispatch_glInvalidateFramebuffer
+#undef glInvalidateNamedFramebufferData
+#define glInvalidateNamedFramebufferData glplatform_dispatch_glInvalidateNamedFramebufferData
+#undef glInvalidateNamedFramebufferSubData
+#define glInvalidateNamedFramebufferSubData glplatform_dispatch_glInvalidateNamedFramebufferSubData
+#undef glInvalidateSubFramebuffer
+#define glInvalidateSubFramebuffer glplatform_dispatch_glInvalidateSubFramebuffer
+#undef glInvalidateTexImage
+#define glInvalidateTexImage glplatform_dispatch_glInvalidateTexImage
+#undef glInvalidateTexSubImage
+#define glInvalidateTexSubImage glplatform_dispatch_glInvalidateTexSubImage
+#undef glIsBuffer
+#define glIsBuffer glplatform_dispatch_glIsBuffer
+#undef glIsEnabled
+#define glIsEnabled glplatform_dispatch_glIsEnabled
+#undef glIsEnabledi
+#define glIsEnabledi glplatform_dispatch_glIsEnabledi
+#undef glIsFramebuffer
+#define glIsFramebuffer glplatform_dispatch_glIsFramebuffer
+#undef glIsImageHandleResidentARB
+#define glIsImageHandleResidentARB glplatform_dispatch_glIsImageHandleResidentARB
+#undef glIsNamedStringARB
+#define glIsNamedStringARB glplatform_dispatch_glIsNamedStringARB
+#undef glIsProgram
+#define glIsProgram glplatform_dispatch_glIsProgram
+#undef glIsProgramPipeline
+#define glIsProgramPipeline glplatform_dispatch_glIsProgramPipeline
+#undef glIsQuery
+#define glIsQuery glplatform_dispatch_glIsQuery
+#undef glIsRenderbuffer
+#define glIsRenderbuffer glplatform_dispatch_glIsRenderbuffer
+#undef glIsSampler
+#define glIsSampler glplatform_dispatch_glIsSampler
+#undef glIsShader
+#define glIsShader glplatform_dispatch_glIsShader
+#undef glIsSync
+#define glIsSync glplatform_dispatch_glIsSync
+#undef glIsTexture
+#define glIsTexture glplatform_dispatch_glIsTexture
+#undef glIsTextureHandleResidentARB
+#define glIsTextureHandleResidentARB glplatform_dispatch_glIsTextureHandleResidentARB
+#undef glIsTransformFeedback
+#define glIsTransformFeedback glplatform_dispatch_glIsTransformFeedback
+#undef glIsVertexArray
+#define glIsVertexArray glplatform_dispatch_glIsVertexArray
+#undef glLineWidth
+#define glLineWidth glplatform_dispatch_glLineWidth
+#undef glLinkProgram
+#define glLinkProgram glplatform_dispatch_glLinkProgram
+#undef glLogicOp
+#define glLogicOp glplatform_dispatch_glLogicOp
+#undef glMakeImageHandleNonResidentARB
+#define glMakeImageHandleNonResidentARB glplatform_dispatch_glMakeImageHandleNonResidentARB
+#undef glMakeImageHandleResidentARB
+#define glMakeImageHandleResidentARB glplatform_dispatch_glMakeImageHandleResidentARB
+#undef glMakeTextureHandleNonResidentARB
+#define glMakeTextureHandleNonResidentARB glplatform_dispatch_glMakeTextureHandleNonResidentARB
+#undef glMakeTextureHandleResidentARB
+#define glMakeTextureHandleResidentARB glplatform_dispatch_glMakeTextureHandleResidentARB
+#undef glMapBuffer
+#define glMapBuffer glplatform_dispatch_glMapBuffer
+#undef glMapBufferRange
+#define glMapBufferRange glplatform_dispatch_glMapBufferRange
+#undef glMapNamedBuffer
+#define glMapNamedBuffer glplatform_dispatch_glMapNamedBuffer
+#undef glMapNamedBufferRange
+#define glMapNamedBufferRange glplatform_dispatch_glMapNamedBufferRange
+#undef glMemoryBarrier
+#define glMemoryBarrier glplatform_dispatch_glMemoryBarrier
+#undef glMemoryBarrierByRegion
+#define glMemoryBarrierByRegion glplatform_dispatch_glMemoryBarrierByRegion
+#undef glMinSampleShading
+#define glMinSampleShading glplatform_dispatch_glMinSampleShading
+#undef glMinSampleShadingARB
+#define glMinSampleShadingARB glplatform_dispatch_glMinSampleShadingARB
+#undef glMultiDrawArrays
+#define glMultiDrawArrays glplatform_dispatch_glMultiDrawArrays
+#undef glMultiDrawArraysIndirect
+#define glMultiDrawArraysIndirect glplatform_dispatch_glMultiDrawArraysIndirect
+#undef glMultiDrawArraysIndirectCountARB
+#define glMultiDrawArraysIndirectCountARB glplatform_dispatch_glMultiDrawArraysIndirectCountARB
+#undef glMultiDrawElements
+#define glMultiDrawElements glplatform_dispatch_glMultiDrawElements
+#undef glMultiDrawElementsBaseVertex
+#define glMultiDrawElementsBaseVertex glplatform_dispatch_glMultiDrawElementsBaseVertex
+#undef glMultiDrawElementsIndirect
+#define glMultiDrawElementsIndirect glplatform_dispatch_glMultiDrawElementsIndirect
+#undef glMultiDrawElementsIndirectCountARB
+#define glMultiDrawElementsIndirectCountARB glplatform_dispatch_glMultiDrawElementsIndirectCountARB
+#undef glNamedBufferData
+#define glNamedBufferData glplatform_dispatch_glNamedBufferData
+#undef glNamedBufferPageCommitmentARB
+#define glNamedBufferPageCommitmentARB glplatform_dispatch_glNamedBufferPageCommitmentARB
+#undef glNamedBufferPageCommitmentEXT
+#define glNamedBufferPageCommitmentEXT glplatform_dispatch_glNamedBufferPageCommitmentEXT
+#undef glNamedBufferStorage
+#define glNamedBufferStorage glplatform_dispatch_glNamedBufferStorage
+#undef glNamedBufferSubData
+#define glNamedBufferSubData glplatform_dispatch_glNamedBufferSubData
+#undef glNamedFramebufferDrawBuffer
+#define glNamedFramebufferDrawBuffer glplatform_dispatch_glNamedFramebufferDrawBuffer
+#undef glNamedFramebufferDrawBuffers
+#define glNamedFramebufferDrawBuffers glplatform_dispatch_glNamedFramebufferDrawBuffers
+#undef glNamedFramebufferParameteri
+#define glNamedFramebufferParameteri glplatform_dispatch_glNamedFramebufferParameteri
+#undef glNamedFramebufferReadBuffer
+#define glNamedFramebufferReadBuffer glplatform_dispatch_glNamedFramebufferReadBuffer
+#undef glNamedFramebufferRenderbuffer
+#define glNamedFramebufferRenderbuffer glplatform_dispatch_glNamedFramebufferRenderbuffer
+#undef glNamedFramebufferTexture
+#define glNamedFramebufferTexture glplatform_dispatch_glNamedFramebufferTexture
+#undef glNamedFramebufferTextureLayer
+#define glNamedFramebufferTextureLayer glplatform_dispatch_glNamedFramebufferTextureLayer
+#undef glNamedRenderbufferStorage
+#define glNamedRenderbufferStorage glplatform_dispatch_glNamedRenderbufferStorage
+#undef glNamedRenderbufferStorageMultisample
+#define glNamedRenderbufferStorageMultisample glplatform_dispatch_glNamedRenderbufferStorageMultisample
+#undef glNamedStringARB
+#define glNamedStringARB glplatform_dispatch_glNamedStringARB
+#undef glObjectLabel
+#define glObjectLabel glplatform_dispatch_glObjectLabel
+#undef glObjectLabelKHR
+#define glObjectLabelKHR glplatform_dispatch_glObjectLabelKHR
+#undef glObjectPtrLabel
+#define glObjectPtrLabel glplatform_dispatch_glObjectPtrLabel
+#undef glObjectPtrLabelKHR
+#define glObjectPtrLabelKHR glplatform_dispatch_glObjectPtrLabelKHR
+#undef glPatchParameterfv
+#define glPatchParameterfv glplatform_dispatch_glPatchParameterfv
+#undef glPatchParameteri
+#define glPatchParameteri glplatform_dispatch_glPatchParameteri
+#undef glPauseTransformFeedback
+#define glPauseTransformFeedback glplatform_dispatch_glPauseTransformFeedback
+#undef glPixelStoref
+#define glPixelStoref glplatform_dispatch_glPixelStoref
+#undef glPixelStorei
+#define glPixelStorei glplatform_dispatch_glPixelStorei
+#undef glPointParameterf
+#define glPointParameterf glplatform_dispatch_glPointParameterf
+#undef glPointParameterfv
+#define glPointParameterfv glplatform_dispatch_glPointParameterfv
+#undef glPointParameteri
+#define glPointParameteri glplatform_dispatch_glPointParameteri
+#undef glPointParameteriv
+#define glPointParameteriv glplatform_dispatch_glPointParameteriv
+#undef glPointSize
+#define glPointSize glplatform_dispatch_glPointSize
+#undef glPolygonMode
+#define glPolygonMode glplatform_dispatch_glPolygonMode
+#undef glPolygonOffset
+#define glPolygonOffset glplatform_dispatch_glPolygonOffset
+#undef glPopDebugGroup
+#define glPopDebugGroup glplatform_dispatch_glPopDebugGroup
+#undef glPopDebugGroupKHR
+#define glPopDebugGroupKHR glplatform_dispatch_glPopDebugGroupKHR
+#undef glPrimitiveRestartIndex
+#define glPrimitiveRestartIndex glplatform_dispatch_glPrimitiveRestartIndex
+#undef glProgramBinary
+#define glProgramBinary glplatform_dispatch_glProgramBinary
+#undef glProgramParameteri
+#define glProgramParameteri glplatform_dispatch_glProgramParameteri
+#undef glProgramUniform1d
+#define glProgramUniform1d glplatform_dispatch_glProgramUniform1d
+#undef glProgramUniform1dv
+#define glProgramUniform1dv glplatform_dispatch_glProgramUniform1dv
+#undef glProgramUniform1f
+#define glProgramUniform1f glplatform_dispatch_glProgramUniform1f
+#undef glProgramUniform1fv
+#define glProgramUniform1fv glplatform_dispatch_glProgramUniform1fv
+#undef glProgramUniform1i
+#define glProgramUniform1i glplatform_dispatch_glProgramUniform1i
+#undef glProgramUniform1iv
+#define glProgramUniform1iv glplatform_dispatch_glProgramUniform1iv
+#undef glProgramUniform1ui
+#define glProgramUniform1ui glplatform_dispatch_glProgramUniform1ui
+#undef glProgramUniform1uiv
+#define glProgramUniform1uiv glplatform_dispatch_glProgramUniform1uiv
+#undef glProgramUniform2d
+#define glProgramUniform2d glplatform_dispatch_glProgramUniform2d
+#undef glProgramUniform2dv
+#define glProgramUniform2dv glplatform_dispatch_glProgramUniform2dv
+#undef glProgramUniform2f
+#define glProgramUniform2f glplatform_dispatch_glProgramUniform2f
+#undef glProgramUniform2fv
+#define glProgramUniform2fv glplatform_dispatch_glProgramUniform2fv
+#undef glProgramUniform2i
+#define glProgramUniform2i glplatform_dispatch_glProgramUniform2i
+#undef glProgramUniform2iv
+#define glProgramUniform2iv glplatform_dispatch_glProgramUniform2iv
+#undef glProgramUniform2ui
+#define glProgramUniform2ui glplatform_dispatch_glProgramUniform2ui
+#undef glProgramUniform2uiv
+#define glProgramUniform2uiv glplatform_dispatch_glProgramUniform2uiv
+#undef glProgramUniform3d
+#define glProgramUniform3d glplatform_dispatch_glProgramUniform3d
+#undef glProgramUniform3dv
+#define glProgramUniform3dv glplatform_dispatch_glProgramUniform3dv
+#undef glProgramUniform3f
+#define glProgramUniform3f glplatform_dispatch_glProgramUniform3f
+#undef glProgramUniform3fv
+#define glProgramUniform3fv glplatform_dispatch_glProgramUniform3fv
+#undef glProgramUniform3i
+#define glProgramUniform3i glplatform_dispatch_glProgramUniform3i
+#undef glProgramUniform3iv
+#define glProgramUniform3iv glplatform_dispatch_glProgramUniform3iv
+#undef glProgramUniform3ui
+#define glProgramUniform3ui glplatform_dispatch_glProgramUniform3ui
+#undef glProgramUniform3uiv
+#define glProgramUniform3uiv glplatform_dispatch_glProgramUniform3uiv
+#undef glProgramUniform4d
+#define glProgramUniform4d glplatform_dispatch_glProgramUniform4d
+#undef glProgramUniform4dv
+#define glProgramUniform4dv glplatform_dispatch_glProgramUniform4dv
+#undef glProgramUniform4f
+#define glProgramUniform4f glplatform_dispatch_glProgramUniform4f
+#undef glProgramUniform4fv
+#define glProgramUniform4fv glplatform_dispatch_glProgramUniform4fv
+#undef glProgramUniform4i
+#define glProgramUniform4i glplatform_dispatch_glProgramUniform4i
+#undef glProgramUniform4iv
+#define glProgramUniform4iv glplatform_dispatch_glProgramUniform4iv
+#undef glProgramUniform4ui
+#define glProgramUniform4ui glplatform_dispatch_glProgramUniform4ui
+#undef glProgramUniform4uiv
+#define glProgramUniform4uiv glplatform_dispatch_glProgramUniform4uiv
+#undef glProgramUniformHandleui64ARB
+#define glProgramUniformHandleui64ARB glplatform_dispatch_glProgramUniformHandleui64ARB
+#undef glProgramUniformHandleui64vARB
+#define glProgramUniformHandleui64vARB glplatform_dispatch_glProgramUniformHandleui64vARB
+#undef glProgramUniformMatrix2dv
+#define glProgramUniformMatrix2dv glplatform_dispatch_glProgramUniformMatrix2dv
+#undef glProgramUniformMatrix2fv
+#define glProgramUniformMatrix2fv glplatform_dispatch_glProgramUniformMatrix2fv
+#undef glProgramUniformMatrix2x3dv
+#define glProgramUniformMatrix2x3dv glplatform_dispatch_glProgramUniformMatrix2x3dv
+#undef glProgramUniformMatrix2x3fv
+#define glProgramUniformMatrix2x3fv glplatform_dispatch_glProgramUniformMatrix2x3fv
+#undef glProgramUniformMatrix2x4dv
+#define glProgramUniformMatrix2x4dv glplatform_dispatch_glProgramUniformMatrix2x4dv
+#undef glProgramUniformMatrix2x4fv
+#define glProgramUniformMatrix2x4fv glplatform_dispatch_glProgramUniformMatrix2x4fv
+#undef glProgramUniformMatrix3dv
+#define glProgramUniformMatrix3dv glplatform_dispatch_glProgramUniformMatrix3dv
+#undef glProgramUniformMatrix3fv
+#define glProgramUniformMatrix3fv glplatform_dispatch_glProgramUniformMatrix3fv
+#undef glProgramUniformMatrix3x2dv
+#define glProgramUniformMatrix3x2dv glplatform_dispatch_glProgramUniformMatrix3x2dv
+#undef glProgramUniformMatrix3x2fv
+#define glProgramUniformMatrix3x2fv glplatform_dispatch_glProgramUniformMatrix3x2fv
+#undef glProgramUniformMatrix3x4dv
+#define glProgramUniformMatrix3x4dv glplatform_dispatch_glProgramUniformMatrix3x4dv
+#undef glProgramUniformMatrix3x4fv
+#define glProgramUniformMatrix3x4fv glplatform_dispatch_glProgramUniformMatrix3x4fv
+#undef glProgramUniformMatrix4dv
+#define glProgramUniformMatrix4dv glplatform_dispatch_glProgramUniformMatrix4dv
+#undef glProgramUniformMatrix4fv
+#define glProgramUniformMatrix4fv glplatform_dispatch_glProgramUniformMatrix4fv
+#undef glProgramUniformMatrix4x2dv
+#define glProgramUniformMatrix4x2dv glplatform_dispatch_glProgramUniformMatrix4x2dv
+#undef glProgramUniformMatrix4x2fv
+#define glProgramUniformMatrix4x2fv glplatform_dispatch_glProgramUniformMatrix4x2fv
+#undef glProgramUniformMatrix4x3dv
+#define glProgramUniformMatrix4x3dv glplatform_dispatch_glProgramUniformMatrix4x3dv
+#undef glProgramUniformMatrix4x3fv
+#define glProgramUniformMatrix4x3fv glplatform_dispatch_glProgramUniformMatrix4x3fv
+#undef glProvokingVertex
+#define glProvokingVertex glplatform_dispatch_glProvokingVertex
+#undef glPushDebugGroup
+#define glPushDebugGroup glplatform_dispatch_glPushDebugGroup
+#undef glPushDebugGroupKHR
+#define glPushDebugGroupKHR glplatform_dispatch_glPushDebugGroupKHR
+#undef glQueryCounter
+#define glQueryCounter glplatform_dispatch_glQueryCounter
+#undef glReadBuffer
+#define glReadBuffer glplatform_dispatch_glReadBuffer
+#undef glReadPixels
+#define glReadPixels glplatform_dispatch_glReadPixels
+#undef glReadnPixels
+#define glReadnPixels glplatform_dispatch_glReadnPixels
+#undef glReadnPixelsARB
+#define glReadnPixelsARB glplatform_dispatch_glReadnPixelsARB
+#undef glReadnPixelsKHR
+#define glReadnPixelsKHR glplatform_dispatch_glReadnPixelsKHR
+#undef glReleaseShaderCompiler
+#define glReleaseShaderCompiler glplatform_dispatch_glReleaseShaderCompiler
+#undef glRenderbufferStorage
+#define glRenderbufferStorage glplatform_dispatch_glRenderbufferStorage
+#undef glRenderbufferStorageMultisample
+#define glRenderbufferStorageMultisample glplatform_dispatch_glRenderbufferStorageMultisample
+#undef glResumeTransformFeedback
+#define glResumeTransformFeedback glplatform_dispatch_glResumeTransformFeedback
+#undef glSampleCoverage
+#define glSampleCoverage glplatform_dispatch_glSampleCoverage
+#undef glSampleMaski
+#define glSampleMaski glplatform_dispatch_glSampleMaski
+#undef glSamplerParameterIiv
+#define glSamplerParameterIiv glplatform_dispatch_glSamplerParameterIiv
+#undef glSamplerParameterIuiv
+#define glSamplerParameterIuiv glplatform_dispatch_glSamplerParameterIuiv
+#undef glSamplerParameterf
+#define glSamplerParameterf glplatform_dispatch_glSamplerParameterf
+#undef glSamplerParameterfv
+#define glSamplerParameterfv glplatform_dispatch_glSamplerParameterfv
+#undef glSamplerParameteri
+#define glSamplerParameteri glplatform_dispatch_glSamplerParameteri
+#undef glSamplerParameteriv
+#define glSamplerParameteriv glplatform_dispatch_glSamplerParameteriv
+#undef glScissor
+#define glScissor glplatform_dispatch_glScissor
+#undef glScissorArrayv
+#define glScissorArrayv glplatform_dispatch_glScissorArrayv
+#undef glScissorIndexed
+#define glScissorIndexed glplatform_dispatch_glScissorIndexed
+#undef glScissorIndexedv
+#define glScissorIndexedv glplatform_dispatch_glScissorIndexedv
+#undef glShaderBinary
+#define glShaderBinary glplatform_dispatch_glShaderBinary
+#undef glShaderSource
+#define glShaderSource glplatform_dispatch_glShaderSource
+#undef glShaderStorageBlockBinding
+#define glShaderStorageBlockBinding glplatform_dispatch_glShaderStorageBlockBinding
+#undef glStencilFunc
+#define glStencilFunc glplatform_dispatch_glStencilFunc
+#undef glStencilFuncSeparate
+#define glStencilFuncSeparate glplatform_dispatch_glStencilFuncSeparate
+#undef glStencilMask
+#define glStencilMask glplatform_dispatch_glStencilMask
+#undef glStencilMaskSeparate
+#define glStencilMaskSeparate glplatform_dispatch_glStencilMaskSeparate
+#undef glStencilOp
+#define glStencilOp glplatform_dispatch_glStencilOp
+#undef glStencilOpSeparate
+#define glStencilOpSeparate glplatform_dispatch_glStencilOpSeparate
+#undef glTexBuffer
+#define glTexBuffer glplatform_dispatch_glTexBuffer
+#undef glTexBufferRange
+#define glTexBufferRange glplatform_dispatch_glTexBufferRange
+#undef glTexImage1D
+#define glTexImage1D glplatform_dispatch_glTexImage1D
+#undef glTexImage2D
+#define glTexImage2D glplatform_dispatch_glTexImage2D
+#undef glTexImage2DMultisample
+#define glTexImage2DMultisample glplatform_dispatch_glTexImage2DMultisample
+#undef glTexImage3D
+#define glTexImage3D glplatform_dispatch_glTexImage3D
+#undef glTexImage3DMultisample
+#define glTexImage3DMultisample glplatform_dispatch_glTexImage3DMultisample
+#undef glTexPageCommitmentARB
+#define glTexPageCommitmentARB glplatform_dispatch_glTexPageCommitmentARB
+#undef glTexParameterIiv
+#define glTexParameterIiv glplatform_dispatch_glTexParameterIiv
+#undef glTexParameterIuiv
+#define glTexParameterIuiv glplatform_dispatch_glTexParameterIuiv
+#undef glTexParameterf
+#define glTexParameterf glplatform_dispatch_glTexParameterf
+#undef glTexParameterfv
+#define glTexParameterfv glplatform_dispatch_glTexParameterfv
+#undef glTexParameteri
+#define glTexParameteri glplatform_dispatch_glTexParameteri
+#undef glTexParameteriv
+#define glTexParameteriv glplatform_dispatch_glTexParameteriv
+#undef glTexStorage1D
+#define glTexStorage1D glplatform_dispatch_glTexStorage1D
+#undef glTexStorage2D
+#define glTexStorage2D glplatform_dispatch_glTexStorage2D
+#undef glTexStorage2DMultisample
+#define glTexStorage2DMultisample glplatform_dispatch_glTexStorage2DMultisample
+#undef glTexStorage3D
+#define glTexStorage3D glplatform_dispatch_glTexStorage3D
+#undef glTexStorage3DMultisample
+#define glTexStorage3DMultisample glplatform_dispatch_glTexStorage3DMultisample
+#undef glTexSubImage1D
+#define glTexSubImage1D glplatform_dispatch_glTexSubImage1D
+#undef glTexSubImage2D
+#define glTexSubImage2D glplatform_dispatch_glTexSubImage2D
+#undef glTexSubImage3D
+#define glTexSubImage3D glplatform_dispatch_glTexSubImage3D
+#undef glTextureBarrier
+#define glTextureBarrier glplatform_dispatch_glTextureBarrier
+#undef glTextureBuffer
+#define glTextureBuffer glplatform_dispatch_glTextureBuffer
+#undef glTextureBufferRange
+#define glTextureBufferRange glplatform_dispatch_glTextureBufferRange
+#undef glTextureParameterIiv
+#define glTextureParameterIiv glplatform_dispatch_glTextureParameterIiv
+#undef glTextureParameterIuiv
+#define glTextureParameterIuiv glplatform_dispatch_glTextureParameterIuiv
+#undef glTextureParameterf
+#define glTextureParameterf glplatform_dispatch_glTextureParameterf
+#undef glTextureParameterfv
+#define glTextureParameterfv glplatform_dispatch_glTextureParameterfv
+#undef glTextureParameteri
+#define glTextureParameteri glplatform_dispatch_glTextureParameteri
+#undef glTextureParameteriv
+#define glTextureParameteriv glplatform_dispatch_glTextureParameteriv
+#undef glTextureStorage1D
+#define glTextureStorage1D glplatform_dispatch_glTextureStorage1D
+#undef glTextureStorage2D
+#define glTextureStorage2D glplatform_dispatch_glTextureStorage2D
+#undef glTextureStorage2DMultisample
+#define glTextureStorage2DMultisample glplatform_dispatch_glTextureStorage2DMultisample
+#undef glTextureStorage3D
+#define glTextureStorage3D glplatform_dispatch_glTextureStorage3D
+#undef glTextureStorage3DMultisample
+#define glTextureStorage3DMultisample glplatform_dispatch_glTextureStorage3DMultisample
+#undef glTextureSubImage1D
+#define glTextureSubImage1D glplatform_dispatch_glTextureSubImage1D
+#undef glTextureSubImage2D
+#define glTextureSubImage2D glplatform_dispatch_glTextureSubImage2D
+#undef glTextureSubImage3D
+#define glTextureSubImage3D glplatform_dispatch_glTextureSubImage3D
+#undef glTextureView
+#define glTextureView glplatform_dispatch_glTextureView
+#undef glTransformFeedbackBufferBase
+#define glTransformFeedbackBufferBase glplatform_dispatch_glTransformFeedbackBufferBase
+#undef glTransformFeedbackBufferRange
+#define glTransformFeedbackBufferRange glplatform_dispatch_glTransformFeedbackBufferRange
+#undef glTransformFeedbackVaryings
+#define glTransformFeedbackVaryings glplatform_dispatch_glTransformFeedbackVaryings
+#undef glUniform1d
+#define glUniform1d glplatform_dispatch_glUniform1d
+#undef glUniform1dv
+#define glUniform1dv glplatform_dispatch_glUniform1dv
+#undef glUniform1f
+#define glUniform1f glplatform_dispatch_glUniform1f
+#undef glUniform1fv
+#define glUniform1fv glplatform_dispatch_glUniform1fv
+#undef glUniform1i
+#define glUniform1i glplatform_dispatch_glUniform1i
+#undef glUniform1iv
+#define glUniform1iv glplatform_dispatch_glUniform1iv
+#undef glUniform1ui
+#define glUniform1ui glplatform_dispatch_glUniform1ui
+#undef glUniform1uiv
+#define glUniform1uiv glplatform_dispatch_glUniform1uiv
+#undef glUniform2d
+#define glUniform2d glplatform_dispatch_glUniform2d
+#undef glUniform2dv
+#define glUniform2dv glplatform_dispatch_glUniform2dv
+#undef glUniform2f
+#define glUniform2f glplatform_dispatch_glUniform2f
+#undef glUniform2fv
+#define glUniform2fv glplatform_dispatch_glUniform2fv
+#undef glUniform2i
+#define glUniform2i glplatform_dispatch_glUniform2i
+#undef glUniform2iv
+#define glUniform2iv glplatform_dispatch_glUniform2iv
+#undef glUniform2ui
+#define glUniform2ui glplatform_dispatch_glUniform2ui
+#undef glUniform2uiv
+#define glUniform2uiv glplatform_dispatch_glUniform2uiv
+#undef glUniform3d
+#define glUniform3d glplatform_dispatch_glUniform3d
+#undef glUniform3dv
+#define glUniform3dv glplatform_dispatch_glUniform3dv
+#undef glUniform3f
+#define glUniform3f glplatform_dispatch_glUniform3f
+#undef glUniform3fv
+#define glUniform3fv glplatform_dispatch_glUniform3fv
+#undef glUniform3i
+#define glUniform3i glplatform_dispatch_glUniform3i
+#undef glUniform3iv
+#define glUniform3iv glplatform_dispatch_glUniform3iv
+#undef glUniform3ui
+#define glUniform3ui glplatform_dispatch_glUniform3ui
+#undef glUniform3uiv
+#define glUniform3uiv glplatform_dispatch_glUniform3uiv
+#undef glUniform4d
+#define glUniform4d glplatform_dispatch_glUniform4d
+#undef glUniform4dv
+#define glUniform4dv glplatform_dispatch_glUniform4dv
+#undef glUniform4f
+#define glUniform4f glplatform_dispatch_glUniform4f
+#undef glUniform4fv
+#define glUniform4fv glplatform_dispatch_glUniform4fv
+#undef glUniform4i
+#define glUniform4i glplatform_dispatch_glUniform4i
+#undef glUniform4iv
+#define glUniform4iv glplatform_dispatch_glUniform4iv
+#undef glUniform4ui
+#define glUniform4ui glplatform_dispatch_glUniform4ui
+#undef glUniform4uiv
+#define glUniform4uiv glplatform_dispatch_glUniform4uiv
+#undef glUniformBlockBinding
+#define glUniformBlockBinding glplatform_dispatch_glUniformBlockBinding
+#undef glUniformHandleui64ARB
+#define glUniformHandleui64ARB glplatform_dispatch_glUniformHandleui64ARB
+#undef glUniformHandleui64vARB
+#define glUniformHandleui64vARB glplatform_dispatch_glUniformHandleui64vARB
+#undef glUniformMatrix2dv
+#define glUniformMatrix2dv glplatform_dispatch_glUniformMatrix2dv
+#undef glUniformMatrix2fv
+#define glUniformMatrix2fv glplatform_dispatch_glUniformMatrix2fv
+#undef glUniformMatrix2x3dv
+#define glUniformMatrix2x3dv glplatform_dispatch_glUniformMatrix2x3dv
+#undef glUniformMatrix2x3fv
+#define glUniformMatrix2x3fv glplatform_dispatch_glUniformMatrix2x3fv
+#undef glUniformMatrix2x4dv
+#define glUniformMatrix2x4dv glplatform_dispatch_glUniformMatrix2x4dv
+#undef glUniformMatrix2x4fv
+#define glUniformMatrix2x4fv glplatform_dispatch_glUniformMatrix2x4fv
+#undef glUniformMatrix3dv
+#define glUniformMatrix3dv glplatform_dispatch_glUniformMatrix3dv
+#undef glUniformMatrix3fv
+#define glUniformMatrix3fv glplatform_dispatch_glUniformMatrix3fv
+#undef glUniformMatrix3x2dv
+#define glUniformMatrix3x2dv glplatform_dispatch_glUniformMatrix3x2dv
+#undef glUniformMatrix3x2fv
+#define glUniformMatrix3x2fv glplatform_dispatch_glUniformMatrix3x2fv
+#undef glUniformMatrix3x4dv
+#define glUniformMatrix3x4dv glplatform_dispatch_glUniformMatrix3x4dv
+#undef glUniformMatrix3x4fv
+#define glUniformMatrix3x4fv glplatform_dispatch_glUniformMatrix3x4fv
+#undef glUniformMatrix4dv
+#define glUniformMatrix4dv glplatform_dispatch_glUniformMatrix4dv
+#undef glUniformMatrix4fv
+#define glUniformMatrix4fv glplatform_dispatch_glUniformMatrix4fv
+#undef glUniformMatrix4x2dv
+#define glUniformMatrix4x2dv glplatform_dispatch_glUniformMatrix4x2dv
+#undef glUniformMatrix4x2fv
+#define glUniformMatrix4x2fv glplatform_dispatch_glUniformMatrix4x2fv
+#undef glUniformMatrix4x3dv
+#define glUniformMatrix4x3dv glplatform_dispatch_glUniformMatrix4x3dv
+#undef glUniformMatrix4x3fv
+#define glUniformMatrix4x3fv glplatform_dispatch_glUniformMatrix4x3fv
+#undef glUniformSubroutinesuiv
+#define glUniformSubroutinesuiv glplatform_dispatch_glUniformSubroutinesuiv
+#undef glUnmapBuffer
+#define glUnmapBuffer glplatform_dispatch_glUnmapBuffer
+#undef glUnmapNamedBuffer
+#define glUnmapNamedBuffer glplatform_dispatch_glUnmapNamedBuffer
+#undef glUseProgram
+#define glUseProgram glplatform_dispatch_glUseProgram
+#undef glUseProgramStages
+#define glUseProgramStages glplatform_dispatch_glUseProgramStages
+#undef glValidateProgram
+#define glValidateProgram glplatform_dispatch_glValidateProgram
+#undef glValidateProgramPipeline
+#define glValidateProgramPipeline glplatform_dispatch_glValidateProgramPipeline
+#undef glVertexArrayAttribBinding
+#define glVertexArrayAttribBinding glplatform_dispatch_glVertexArrayAttribBinding
+#undef glVertexArrayAttribFormat
+#define glVertexArrayAttribFormat glplatform_dispatch_glVertexArrayAttribFormat
+#undef glVertexArrayAttribIFormat
+#define glVertexArrayAttribIFormat glplatform_dispatch_glVertexArrayAttribIFormat
+#undef glVertexArrayAttribLFormat
+#define glVertexArrayAttribLFormat glplatform_dispatch_glVertexArrayAttribLFormat
+#undef glVertexArrayBindingDivisor
+#define glVertexArrayBindingDivisor glplatform_dispatch_glVertexArrayBindingDivisor
+#undef glVertexArrayElementBuffer
+#define glVertexArrayElementBuffer glplatform_dispatch_glVertexArrayElementBuffer
+#undef glVertexArrayVertexBuffer
+#define glVertexArrayVertexBuffer glplatform_dispatch_glVertexArrayVertexBuffer
+#undef glVertexArrayVertexBuffers
+#define glVertexArrayVertexBuffers glplatform_dispatch_glVertexArrayVertexBuffers
+#undef glVertexAttrib1d
+#define glVertexAttrib1d glplatform_dispatch_glVertexAttrib1d
+#undef glVertexAttrib1dv
+#define glVertexAttrib1dv glplatform_dispatch_glVertexAttrib1dv
+#undef glVertexAttrib1f
+#define glVertexAttrib1f glplatform_dispatch_glVertexAttrib1f
+#undef glVertexAttrib1fv
+#define glVertexAttrib1fv glplatform_dispatch_glVertexAttrib1fv
+#undef glVertexAttrib1s
+#define glVertexAttrib1s glplatform_dispatch_glVertexAttrib1s
+#undef glVertexAttrib1sv
+#define glVertexAttrib1sv glplatform_dispatch_glVertexAttrib1sv
+#undef glVertexAttrib2d
+#define glVertexAttrib2d glplatform_dispatch_glVertexAttrib2d
+#undef glVertexAttrib2dv
+#define glVertexAttrib2dv glplatform_dispatch_glVertexAttrib2dv
+#undef glVertexAttrib2f
+#define glVertexAttrib2f glplatform_dispatch_glVertexAttrib2f
+#undef glVertexAttrib2fv
+#define glVertexAttrib2fv glplatform_dispatch_glVertexAttrib2fv
+#undef glVertexAttrib2s
+#define glVertexAttrib2s glplatform_dispatch_glVertexAttrib2s
+#undef glVertexAttrib2sv
+#define glVertexAttrib2sv glplatform_dispatch_glVertexAttrib2sv
+#undef glVertexAttrib3d
+#define glVertexAttrib3d glplatform_dispatch_glVertexAttrib3d
+#undef glVertexAttrib3dv
+#define glVertexAttrib3dv glplatform_dispatch_glVertexAttrib3dv
+#undef glVertexAttrib3f
+#define glVertexAttrib3f glplatform_dispatch_glVertexAttrib3f
+#undef glVertexAttrib3fv
+#define glVertexAttrib3fv glplatform_dispatch_glVertexAttrib3fv
+#undef glVertexAttrib3s
+#define glVertexAttrib3s glplatform_dispatch_glVertexAttrib3s
+#undef glVertexAttrib3sv
+#define glVertexAttrib3sv glplatform_dispatch_glVertexAttrib3sv
+#undef glVertexAttrib4Nbv
+#define glVertexAttrib4Nbv glplatform_dispatch_glVertexAttrib4Nbv
+#undef glVertexAttrib4Niv
+#define glVertexAttrib4Niv glplatform_dispatch_glVertexAttrib4Niv
+#undef glVertexAttrib4Nsv
+#define glVertexAttrib4Nsv glplatform_dispatch_glVertexAttrib4Nsv
+#undef glVertexAttrib4Nub
+#define glVertexAttrib4Nub glplatform_dispatch_glVertexAttrib4Nub
+#undef glVertexAttrib4Nubv
+#define glVertexAttrib4Nubv glplatform_dispatch_glVertexAttrib4Nubv
+#undef glVertexAttrib4Nuiv
+#define glVertexAttrib4Nuiv glplatform_dispatch_glVertexAttrib4Nuiv
+#undef glVertexAttrib4Nusv
+#define glVertexAttrib4Nusv glplatform_dispatch_glVertexAttrib4Nusv
+#undef glVertexAttrib4bv
+#define glVertexAttrib4bv glplatform_dispatch_glVertexAttrib4bv
+#undef glVertexAttrib4d
+#define glVertexAttrib4d glplatform_dispatch_glVertexAttrib4d
+#undef glVertexAttrib4dv
+#define glVertexAttrib4dv glplatform_dispatch_glVertexAttrib4dv
+#undef glVertexAttrib4f
+#define glVertexAttrib4f glplatform_dispatch_glVertexAttrib4f
+#undef glVertexAttrib4fv
+#define glVertexAttrib4fv glplatform_dispatch_glVertexAttrib4fv
+#undef glVertexAttrib4iv
+#define glVertexAttrib4iv glplatform_dispatch_glVertexAttrib4iv
+#undef glVertexAttrib4s
+#define glVertexAttrib4s glplatform_dispatch_glVertexAttrib4s
+#undef glVertexAttrib4sv
+#define glVertexAttrib4sv glplatform_dispatch_glVertexAttrib4sv
+#undef glVertexAttrib4ubv
+#define glVertexAttrib4ubv glplatform_dispatch_glVertexAttrib4ubv
+#undef glVertexAttrib4uiv
+#define glVertexAttrib4uiv glplatform_dispatch_glVertexAttrib4uiv
+#undef glVertexAttrib4usv
+#define glVertexAttrib4usv glplatform_dispatch_glVertexAttrib4usv
+#undef glVertexAttribBinding
+#define glVertexAttribBinding glplatform_dispatch_glVertexAttribBinding
+#undef glVertexAttribDivisor
+#define glVertexAttribDivisor glplatform_dispatch_glVertexAttribDivisor
+#undef glVertexAttribFormat
+#define glVertexAttribFormat glplatform_dispatch_glVertexAttribFormat
+#undef glVertexAttribI1i
+#define glVertexAttribI1i glplatform_dispatch_glVertexAttribI1i
+#undef glVertexAttribI1iv
+#define glVertexAttribI1iv glplatform_dispatch_glVertexAttribI1iv
+#undef glVertexAttribI1ui
+#define glVertexAttribI1ui glplatform_dispatch_glVertexAttribI1ui
+#undef glVertexAttribI1uiv
+#define glVertexAttribI1uiv glplatform_dispatch_glVertexAttribI1uiv
+#undef glVertexAttribI2i
+#define glVertexAttribI2i glplatform_dispatch_glVertexAttribI2i
+#undef glVertexAttribI2iv
+#define glVertexAttribI2iv glplatform_dispatch_glVertexAttribI2iv
+#undef glVertexAttribI2ui
+#define glVertexAttribI2ui glplatform_dispatch_glVertexAttribI2ui
+#undef glVertexAttribI2uiv
+#define glVertexAttribI2uiv glplatform_dispatch_glVertexAttribI2uiv
+#undef glVertexAttribI3i
+#define glVertexAttribI3i glplatform_dispatch_glVertexAttribI3i
+#undef glVertexAttribI3iv
+#define glVertexAttribI3iv glplatform_dispatch_glVertexAttribI3iv
+#undef glVertexAttribI3ui
+#define glVertexAttribI3ui glplatform_dispatch_glVertexAttribI3ui
+#undef glVertexAttribI3uiv
+#define glVertexAttribI3uiv glplatform_dispatch_glVertexAttribI3uiv
+#undef glVertexAttribI4bv
+#define glVertexAttribI4bv glplatform_dispatch_glVertexAttribI4bv
+#undef glVertexAttribI4i
+#define glVertexAttribI4i glplatform_dispatch_glVertexAttribI4i
+#undef glVertexAttribI4iv
+#define glVertexAttribI4iv glplatform_dispatch_glVertexAttribI4iv
+#undef glVertexAttribI4sv
+#define glVertexAttribI4sv glplatform_dispatch_glVertexAttribI4sv
+#undef glVertexAttribI4ubv
+#define glVertexAttribI4ubv glplatform_dispatch_glVertexAttribI4ubv
+#undef glVertexAttribI4ui
+#define glVertexAttribI4ui glplatform_dispatch_glVertexAttribI4ui
+#undef glVertexAttribI4uiv
+#define glVertexAttribI4uiv glplatform_dispatch_glVertexAttribI4uiv
+#undef glVertexAttribI4usv
+#define glVertexAttribI4usv glplatform_dispatch_glVertexAttribI4usv
+#undef glVertexAttribIFormat
+#define glVertexAttribIFormat glplatform_dispatch_glVertexAttribIFormat
+#undef glVertexAttribIPointer
+#define glVertexAttribIPointer glplatform_dispatch_glVertexAttribIPointer
+#undef glVertexAttribL1d
+#define glVertexAttribL1d glplatform_dispatch_glVertexAttribL1d
+#undef glVertexAttribL1dv
+#define glVertexAttribL1dv glplatform_dispatch_glVertexAttribL1dv
+#undef glVertexAttribL1ui64ARB
+#define glVertexAttribL1ui64ARB glplatform_dispatch_glVertexAttribL1ui64ARB
+#undef glVertexAttribL1ui64vARB
+#define glVertexAttribL1ui64vARB glplatform_dispatch_glVertexAttribL1ui64vARB
+#undef glVertexAttribL2d
+#define glVertexAttribL2d glplatform_dispatch_glVertexAttribL2d
+#undef glVertexAttribL2dv
+#define glVertexAttribL2dv glplatform_dispatch_glVertexAttribL2dv
+#undef glVertexAttribL3d
+#define glVertexAttribL3d glplatform_dispatch_glVertexAttribL3d
+#undef glVertexAttribL3dv
+#define glVertexAttribL3dv glplatform_dispatch_glVertexAttribL3dv
+#undef glVertexAttribL4d
+#define glVertexAttribL4d glplatform_dispatch_glVertexAttribL4d
+#undef glVertexAttribL4dv
+#define glVertexAttribL4dv glplatform_dispatch_glVertexAttribL4dv
+#undef glVertexAttribLFormat
+#define glVertexAttribLFormat glplatform_dispatch_glVertexAttribLFormat
+#undef glVertexAttribLPointer
+#define glVertexAttribLPointer glplatform_dispatch_glVertexAttribLPointer
+#undef glVertexAttribP1ui
+#define glVertexAttribP1ui glplatform_dispatch_glVertexAttribP1ui
+#undef glVertexAttribP1uiv
+#define glVertexAttribP1uiv glplatform_dispatch_glVertexAttribP1uiv
+#undef glVertexAttribP2ui
+#define glVertexAttribP2ui glplatform_dispatch_glVertexAttribP2ui
+#undef glVertexAttribP2uiv
+#define glVertexAttribP2uiv glplatform_dispatch_glVertexAttribP2uiv
+#undef glVertexAttribP3ui
+#define glVertexAttribP3ui glplatform_dispatch_glVertexAttribP3ui
+#undef glVertexAttribP3uiv
+#define glVertexAttribP3uiv glplatform_dispatch_glVertexAttribP3uiv
+#undef glVertexAttribP4ui
+#define glVertexAttribP4ui glplatform_dispatch_glVertexAttribP4ui
+#undef glVertexAttribP4uiv
+#define glVertexAttribP4uiv glplatform_dispatch_glVertexAttribP4uiv
+#undef glVertexAttribPointer
+#define glVertexAttribPointer glplatform_dispatch_glVertexAttribPointer
+#undef glVertexBindingDivisor
+#define glVertexBindingDivisor glplatform_dispatch_glVertexBindingDivisor
+#undef glViewport
+#define glViewport glplatform_dispatch_glViewport
+#undef glViewportArrayv
+#define glViewportArrayv glplatform_dispatch_glViewportArrayv
+#undef glViewportIndexedf
+#define glViewportIndexedf glplatform_dispatch_glViewportIndexedf
+#undef glViewportIndexedfv
+#define glViewportIndexedfv glplatform_dispatch_glViewportIndexedfv
+#undef glWaitSync
+#define glWaitSync glplatform_dispatch_glWaitSync
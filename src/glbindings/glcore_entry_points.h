@@ -0,0 +1,1868 @@
+/* Generated by gen_entry_points.py from glcore.c, do not edit */
+
+/*
+ * X-macro list of the OpenGL entry points and extensions bound by glcore.c.
+ * Define any of the following before including this file:
+ *
+ * GLPLATFORM_GL_FUNC(ret, name, params, args) - Entry point returning a value
+ * GLPLATFORM_GL_VOID_FUNC(name, params, args) - Entry point returning void
+ * GLPLATFORM_GL_EXTENSION(name) - Extension, in strcmp() order
+ *
+ * 'params' is the parenthesized parameter list with parameters named a0, a1, ...
+ * and 'args' the parenthesized argument list passing them on.
+ *
+ * GLPLATFORM_GL_SIGNATURE(ret, name, params, args, sig, store, load) - Entry point
+ * 	returning a value, with its signature
+ * GLPLATFORM_GL_VOID_SIGNATURE(name, params, args, sig, store, load) - Entry point
+ * 	returning void, with its signature
+ *
+ * 'sig' is a string with a code for the return type followed by one per
+ * parameter:
+ *
+ * v - void return
+ * i - 32-bit integer, enum or boolean
+ * n - GLsizei
+ * l - 64-bit integer, GLintptr or GLsizeiptr
+ * f, d - GLfloat, GLdouble
+ * s - GLsync
+ * p - const void * or, as return type, any pointer
+ * 1, 2, 4, 8 - Pointer to const elements of that size
+ * S - const GLchar * string
+ * C - const GLchar *const * string array
+ * o - Non-const pointer the entry point writes through
+ * x - Callback or opaque handle
+ * X - const void *const * array of pointers
+ *
+ * 'store' is an expression calling GLPLATFORM_GL_STORE(index, field, value) for each
+ * parameter and 'load' an argument list made of GLPLATFORM_GL_LOAD(index, field)
+ * cast to the parameter types. 'field' is i, l, f, d, s, p, o or x.
+ *
+ * If GLPLATFORM_GL_ENABLE_ALL is defined the file instead enables every extension
+ * section of glcore.h, include it that way before glcore.h to declare all of the
+ * listed entry points.
+ */
+
+#ifdef GLPLATFORM_GL_ENABLE_ALL
+#undef GLPLATFORM_GL_ENABLE_ALL
+#undef GLPLATFORM_ENABLE_GL_ARB_ES2_compatibility
+#define GLPLATFORM_ENABLE_GL_ARB_ES2_compatibility
+#undef GLPLATFORM_ENABLE_GL_ARB_ES3_1_compatibility
+#define GLPLATFORM_ENABLE_GL_ARB_ES3_1_compatibility
+#undef GLPLATFORM_ENABLE_GL_ARB_ES3_compatibility
+#define GLPLATFORM_ENABLE_GL_ARB_ES3_compatibility
+#undef GLPLATFORM_ENABLE_GL_ARB_arrays_of_arrays
+#define GLPLATFORM_ENABLE_GL_ARB_arrays_of_arrays
+#undef GLPLATFORM_ENABLE_GL_ARB_base_instance
+#define GLPLATFORM_ENABLE_GL_ARB_base_instance
+#undef GLPLATFORM_ENABLE_GL_ARB_bindless_texture
+#define GLPLATFORM_ENABLE_GL_ARB_bindless_texture
+#undef GLPLATFORM_ENABLE_GL_ARB_blend_func_extended
+#define GLPLATFORM_ENABLE_GL_ARB_blend_func_extended
+#undef GLPLATFORM_ENABLE_GL_ARB_buffer_storage
+#define GLPLATFORM_ENABLE_GL_ARB_buffer_storage
+#undef GLPLATFORM_ENABLE_GL_ARB_cl_event
+#define GLPLATFORM_ENABLE_GL_ARB_cl_event
+#undef GLPLATFORM_ENABLE_GL_ARB_clear_buffer_object
+#define GLPLATFORM_ENABLE_GL_ARB_clear_buffer_object
+#undef GLPLATFORM_ENABLE_GL_ARB_clear_texture
+#define GLPLATFORM_ENABLE_GL_ARB_clear_texture
+#undef GLPLATFORM_ENABLE_GL_ARB_clip_control
+#define GLPLATFORM_ENABLE_GL_ARB_clip_control
+#undef GLPLATFORM_ENABLE_GL_ARB_compressed_texture_pixel_storage
+#define GLPLATFORM_ENABLE_GL_ARB_compressed_texture_pixel_storage
+#undef GLPLATFORM_ENABLE_GL_ARB_compute_shader
+#define GLPLATFORM_ENABLE_GL_ARB_compute_shader
+#undef GLPLATFORM_ENABLE_GL_ARB_compute_variable_group_size
+#define GLPLATFORM_ENABLE_GL_ARB_compute_variable_group_size
+#undef GLPLATFORM_ENABLE_GL_ARB_conditional_render_inverted
+#define GLPLATFORM_ENABLE_GL_ARB_conditional_render_inverted
+#undef GLPLATFORM_ENABLE_GL_ARB_conservative_depth
+#define GLPLATFORM_ENABLE_GL_ARB_conservative_depth
+#undef GLPLATFORM_ENABLE_GL_ARB_copy_buffer
+#define GLPLATFORM_ENABLE_GL_ARB_copy_buffer
+#undef GLPLATFORM_ENABLE_GL_ARB_copy_image
+#define GLPLATFORM_ENABLE_GL_ARB_copy_image
+#undef GLPLATFORM_ENABLE_GL_ARB_cull_distance
+#define GLPLATFORM_ENABLE_GL_ARB_cull_distance
+#undef GLPLATFORM_ENABLE_GL_ARB_debug_output
+#define GLPLATFORM_ENABLE_GL_ARB_debug_output
+#undef GLPLATFORM_ENABLE_GL_ARB_depth_buffer_float
+#define GLPLATFORM_ENABLE_GL_ARB_depth_buffer_float
+#undef GLPLATFORM_ENABLE_GL_ARB_depth_clamp
+#define GLPLATFORM_ENABLE_GL_ARB_depth_clamp
+#undef GLPLATFORM_ENABLE_GL_ARB_derivative_control
+#define GLPLATFORM_ENABLE_GL_ARB_derivative_control
+#undef GLPLATFORM_ENABLE_GL_ARB_direct_state_access
+#define GLPLATFORM_ENABLE_GL_ARB_direct_state_access
+#undef GLPLATFORM_ENABLE_GL_ARB_draw_buffers_blend
+#define GLPLATFORM_ENABLE_GL_ARB_draw_buffers_blend
+#undef GLPLATFORM_ENABLE_GL_ARB_draw_elements_base_vertex
+#define GLPLATFORM_ENABLE_GL_ARB_draw_elements_base_vertex
+#undef GLPLATFORM_ENABLE_GL_ARB_draw_indirect
+#define GLPLATFORM_ENABLE_GL_ARB_draw_indirect
+#undef GLPLATFORM_ENABLE_GL_ARB_enhanced_layouts
+#define GLPLATFORM_ENABLE_GL_ARB_enhanced_layouts
+#undef GLPLATFORM_ENABLE_GL_ARB_explicit_attrib_location
+#define GLPLATFORM_ENABLE_GL_ARB_explicit_attrib_location
+#undef GLPLATFORM_ENABLE_GL_ARB_explicit_uniform_location
+#define GLPLATFORM_ENABLE_GL_ARB_explicit_uniform_location
+#undef GLPLATFORM_ENABLE_GL_ARB_fragment_coord_conventions
+#define GLPLATFORM_ENABLE_GL_ARB_fragment_coord_conventions
+#undef GLPLATFORM_ENABLE_GL_ARB_fragment_layer_viewport
+#define GLPLATFORM_ENABLE_GL_ARB_fragment_layer_viewport
+#undef GLPLATFORM_ENABLE_GL_ARB_framebuffer_no_attachments
+#define GLPLATFORM_ENABLE_GL_ARB_framebuffer_no_attachments
+#undef GLPLATFORM_ENABLE_GL_ARB_framebuffer_object
+#define GLPLATFORM_ENABLE_GL_ARB_framebuffer_object
+#undef GLPLATFORM_ENABLE_GL_ARB_framebuffer_sRGB
+#define GLPLATFORM_ENABLE_GL_ARB_framebuffer_sRGB
+#undef GLPLATFORM_ENABLE_GL_ARB_get_program_binary
+#define GLPLATFORM_ENABLE_GL_ARB_get_program_binary
+#undef GLPLATFORM_ENABLE_GL_ARB_get_texture_sub_image
+#define GLPLATFORM_ENABLE_GL_ARB_get_texture_sub_image
+#undef GLPLATFORM_ENABLE_GL_ARB_gpu_shader5
+#define GLPLATFORM_ENABLE_GL_ARB_gpu_shader5
+#undef GLPLATFORM_ENABLE_GL_ARB_gpu_shader_fp64
+#define GLPLATFORM_ENABLE_GL_ARB_gpu_shader_fp64
+#undef GLPLATFORM_ENABLE_GL_ARB_half_float_vertex
+#define GLPLATFORM_ENABLE_GL_ARB_half_float_vertex
+#undef GLPLATFORM_ENABLE_GL_ARB_imaging
+#define GLPLATFORM_ENABLE_GL_ARB_imaging
+#undef GLPLATFORM_ENABLE_GL_ARB_indirect_parameters
+#define GLPLATFORM_ENABLE_GL_ARB_indirect_parameters
+#undef GLPLATFORM_ENABLE_GL_ARB_internalformat_query
+#define GLPLATFORM_ENABLE_GL_ARB_internalformat_query
+#undef GLPLATFORM_ENABLE_GL_ARB_internalformat_query2
+#define GLPLATFORM_ENABLE_GL_ARB_internalformat_query2
+#undef GLPLATFORM_ENABLE_GL_ARB_invalidate_subdata
+#define GLPLATFORM_ENABLE_GL_ARB_invalidate_subdata
+#undef GLPLATFORM_ENABLE_GL_ARB_map_buffer_alignment
+#define GLPLATFORM_ENABLE_GL_ARB_map_buffer_alignment
+#undef GLPLATFORM_ENABLE_GL_ARB_map_buffer_range
+#define GLPLATFORM_ENABLE_GL_ARB_map_buffer_range
+#undef GLPLATFORM_ENABLE_GL_ARB_multi_bind
+#define GLPLATFORM_ENABLE_GL_ARB_multi_bind
+#undef GLPLATFORM_ENABLE_GL_ARB_multi_draw_indirect
+#define GLPLATFORM_ENABLE_GL_ARB_multi_draw_indirect
+#undef GLPLATFORM_ENABLE_GL_ARB_occlusion_query2
+#define GLPLATFORM_ENABLE_GL_ARB_occlusion_query2
+#undef GLPLATFORM_ENABLE_GL_ARB_pipeline_statistics_query
+#define GLPLATFORM_ENABLE_GL_ARB_pipeline_statistics_query
+#undef GLPLATFORM_ENABLE_GL_ARB_program_interface_query
+#define GLPLATFORM_ENABLE_GL_ARB_program_interface_query
+#undef GLPLATFORM_ENABLE_GL_ARB_provoking_vertex
+#define GLPLATFORM_ENABLE_GL_ARB_provoking_vertex
+#undef GLPLATFORM_ENABLE_GL_ARB_query_buffer_object
+#define GLPLATFORM_ENABLE_GL_ARB_query_buffer_object
+#undef GLPLATFORM_ENABLE_GL_ARB_robust_buffer_access_behavior
+#define GLPLATFORM_ENABLE_GL_ARB_robust_buffer_access_behavior
+#undef GLPLATFORM_ENABLE_GL_ARB_robustness
+#define GLPLATFORM_ENABLE_GL_ARB_robustness
+#undef GLPLATFORM_ENABLE_GL_ARB_robustness_isolation
+#define GLPLATFORM_ENABLE_GL_ARB_robustness_isolation
+#undef GLPLATFORM_ENABLE_GL_ARB_sample_shading
+#define GLPLATFORM_ENABLE_GL_ARB_sample_shading
+#undef GLPLATFORM_ENABLE_GL_ARB_sampler_objects
+#define GLPLATFORM_ENABLE_GL_ARB_sampler_objects
+#undef GLPLATFORM_ENABLE_GL_ARB_seamless_cube_map
+#define GLPLATFORM_ENABLE_GL_ARB_seamless_cube_map
+#undef GLPLATFORM_ENABLE_GL_ARB_seamless_cubemap_per_texture
+#define GLPLATFORM_ENABLE_GL_ARB_seamless_cubemap_per_texture
+#undef GLPLATFORM_ENABLE_GL_ARB_separate_shader_objects
+#define GLPLATFORM_ENABLE_GL_ARB_separate_shader_objects
+#undef GLPLATFORM_ENABLE_GL_ARB_shader_atomic_counters
+#define GLPLATFORM_ENABLE_GL_ARB_shader_atomic_counters
+#undef GLPLATFORM_ENABLE_GL_ARB_shader_bit_encoding
+#define GLPLATFORM_ENABLE_GL_ARB_shader_bit_encoding
+#undef GLPLATFORM_ENABLE_GL_ARB_shader_draw_parameters
+#define GLPLATFORM_ENABLE_GL_ARB_shader_draw_parameters
+#undef GLPLATFORM_ENABLE_GL_ARB_shader_group_vote
+#define GLPLATFORM_ENABLE_GL_ARB_shader_group_vote
+#undef GLPLATFORM_ENABLE_GL_ARB_shader_image_load_store
+#define GLPLATFORM_ENABLE_GL_ARB_shader_image_load_store
+#undef GLPLATFORM_ENABLE_GL_ARB_shader_image_size
+#define GLPLATFORM_ENABLE_GL_ARB_shader_image_size
+#undef GLPLATFORM_ENABLE_GL_ARB_shader_precision
+#define GLPLATFORM_ENABLE_GL_ARB_shader_precision
+#undef GLPLATFORM_ENABLE_GL_ARB_shader_stencil_export
+#define GLPLATFORM_ENABLE_GL_ARB_shader_stencil_export
+#undef GLPLATFORM_ENABLE_GL_ARB_shader_storage_buffer_object
+#define GLPLATFORM_ENABLE_GL_ARB_shader_storage_buffer_object
+#undef GLPLATFORM_ENABLE_GL_ARB_shader_subroutine
+#define GLPLATFORM_ENABLE_GL_ARB_shader_subroutine
+#undef GLPLATFORM_ENABLE_GL_ARB_shader_texture_image_samples
+#define GLPLATFORM_ENABLE_GL_ARB_shader_texture_image_samples
+#undef GLPLATFORM_ENABLE_GL_ARB_shading_language_420pack
+#define GLPLATFORM_ENABLE_GL_ARB_shading_language_420pack
+#undef GLPLATFORM_ENABLE_GL_ARB_shading_language_include
+#define GLPLATFORM_ENABLE_GL_ARB_shading_language_include
+#undef GLPLATFORM_ENABLE_GL_ARB_shading_language_packing
+#define GLPLATFORM_ENABLE_GL_ARB_shading_language_packing
+#undef GLPLATFORM_ENABLE_GL_ARB_sparse_buffer
+#define GLPLATFORM_ENABLE_GL_ARB_sparse_buffer
+#undef GLPLATFORM_ENABLE_GL_ARB_sparse_texture
+#define GLPLATFORM_ENABLE_GL_ARB_sparse_texture
+#undef GLPLATFORM_ENABLE_GL_ARB_stencil_texturing
+#define GLPLATFORM_ENABLE_GL_ARB_stencil_texturing
+#undef GLPLATFORM_ENABLE_GL_ARB_sync
+#define GLPLATFORM_ENABLE_GL_ARB_sync
+#undef GLPLATFORM_ENABLE_GL_ARB_tessellation_shader
+#define GLPLATFORM_ENABLE_GL_ARB_tessellation_shader
+#undef GLPLATFORM_ENABLE_GL_ARB_texture_barrier
+#define GLPLATFORM_ENABLE_GL_ARB_texture_barrier
+#undef GLPLATFORM_ENABLE_GL_ARB_texture_buffer_object_rgb32
+#define GLPLATFORM_ENABLE_GL_ARB_texture_buffer_object_rgb32
+#undef GLPLATFORM_ENABLE_GL_ARB_texture_buffer_range
+#define GLPLATFORM_ENABLE_GL_ARB_texture_buffer_range
+#undef GLPLATFORM_ENABLE_GL_ARB_texture_compression_bptc
+#define GLPLATFORM_ENABLE_GL_ARB_texture_compression_bptc
+#undef GLPLATFORM_ENABLE_GL_ARB_texture_compression_rgtc
+#define GLPLATFORM_ENABLE_GL_ARB_texture_compression_rgtc
+#undef GLPLATFORM_ENABLE_GL_ARB_texture_cube_map_array
+#define GLPLATFORM_ENABLE_GL_ARB_texture_cube_map_array
+#undef GLPLATFORM_ENABLE_GL_ARB_texture_gather
+#define GLPLATFORM_ENABLE_GL_ARB_texture_gather
+#undef GLPLATFORM_ENABLE_GL_ARB_texture_mirror_clamp_to_edge
+#define GLPLATFORM_ENABLE_GL_ARB_texture_mirror_clamp_to_edge
+#undef GLPLATFORM_ENABLE_GL_ARB_texture_multisample
+#define GLPLATFORM_ENABLE_GL_ARB_texture_multisample
+#undef GLPLATFORM_ENABLE_GL_ARB_texture_query_levels
+#define GLPLATFORM_ENABLE_GL_ARB_texture_query_levels
+#undef GLPLATFORM_ENABLE_GL_ARB_texture_query_lod
+#define GLPLATFORM_ENABLE_GL_ARB_texture_query_lod
+#undef GLPLATFORM_ENABLE_GL_ARB_texture_rg
+#define GLPLATFORM_ENABLE_GL_ARB_texture_rg
+#undef GLPLATFORM_ENABLE_GL_ARB_texture_rgb10_a2ui
+#define GLPLATFORM_ENABLE_GL_ARB_texture_rgb10_a2ui
+#undef GLPLATFORM_ENABLE_GL_ARB_texture_stencil8
+#define GLPLATFORM_ENABLE_GL_ARB_texture_stencil8
+#undef GLPLATFORM_ENABLE_GL_ARB_texture_storage
+#define GLPLATFORM_ENABLE_GL_ARB_texture_storage
+#undef GLPLATFORM_ENABLE_GL_ARB_texture_storage_multisample
+#define GLPLATFORM_ENABLE_GL_ARB_texture_storage_multisample
+#undef GLPLATFORM_ENABLE_GL_ARB_texture_swizzle
+#define GLPLATFORM_ENABLE_GL_ARB_texture_swizzle
+#undef GLPLATFORM_ENABLE_GL_ARB_texture_view
+#define GLPLATFORM_ENABLE_GL_ARB_texture_view
+#undef GLPLATFORM_ENABLE_GL_ARB_timer_query
+#define GLPLATFORM_ENABLE_GL_ARB_timer_query
+#undef GLPLATFORM_ENABLE_GL_ARB_transform_feedback2
+#define GLPLATFORM_ENABLE_GL_ARB_transform_feedback2
+#undef GLPLATFORM_ENABLE_GL_ARB_transform_feedback3
+#define GLPLATFORM_ENABLE_GL_ARB_transform_feedback3
+#undef GLPLATFORM_ENABLE_GL_ARB_transform_feedback_instanced
+#define GLPLATFORM_ENABLE_GL_ARB_transform_feedback_instanced
+#undef GLPLATFORM_ENABLE_GL_ARB_transform_feedback_overflow_query
+#define GLPLATFORM_ENABLE_GL_ARB_transform_feedback_overflow_query
+#undef GLPLATFORM_ENABLE_GL_ARB_uniform_buffer_object
+#define GLPLATFORM_ENABLE_GL_ARB_uniform_buffer_object
+#undef GLPLATFORM_ENABLE_GL_ARB_vertex_array_bgra
+#define GLPLATFORM_ENABLE_GL_ARB_vertex_array_bgra
+#undef GLPLATFORM_ENABLE_GL_ARB_vertex_array_object
+#define GLPLATFORM_ENABLE_GL_ARB_vertex_array_object
+#undef GLPLATFORM_ENABLE_GL_ARB_vertex_attrib_64bit
+#define GLPLATFORM_ENABLE_GL_ARB_vertex_attrib_64bit
+#undef GLPLATFORM_ENABLE_GL_ARB_vertex_attrib_binding
+#define GLPLATFORM_ENABLE_GL_ARB_vertex_attrib_binding
+#undef GLPLATFORM_ENABLE_GL_ARB_vertex_type_10f_11f_11f_rev
+#define GLPLATFORM_ENABLE_GL_ARB_vertex_type_10f_11f_11f_rev
+#undef GLPLATFORM_ENABLE_GL_ARB_vertex_type_2_10_10_10_rev
+#define GLPLATFORM_ENABLE_GL_ARB_vertex_type_2_10_10_10_rev
+#undef GLPLATFORM_ENABLE_GL_ARB_viewport_array
+#define GLPLATFORM_ENABLE_GL_ARB_viewport_array
+#undef GLPLATFORM_ENABLE_GL_KHR_context_flush_control
+#define GLPLATFORM_ENABLE_GL_KHR_context_flush_control
+#undef GLPLATFORM_ENABLE_GL_KHR_debug
+#define GLPLATFORM_ENABLE_GL_KHR_debug
+#undef GLPLATFORM_ENABLE_GL_KHR_no_error
+#define GLPLATFORM_ENABLE_GL_KHR_no_error
+#undef GLPLATFORM_ENABLE_GL_KHR_robust_buffer_access_behavior
+#define GLPLATFORM_ENABLE_GL_KHR_robust_buffer_access_behavior
+#undef GLPLATFORM_ENABLE_GL_KHR_robustness
+#define GLPLATFORM_ENABLE_GL_KHR_robustness
+#undef GLPLATFORM_ENABLE_GL_KHR_texture_compression_astc_hdr
+#define GLPLATFORM_ENABLE_GL_KHR_texture_compression_astc_hdr
+#undef GLPLATFORM_ENABLE_GL_KHR_texture_compression_astc_ldr
+#define GLPLATFORM_ENABLE_GL_KHR_texture_compression_astc_ldr
+#undef GLPLATFORM_ENABLE_GL_KHR_texture_compression_astc_sliced_3d
+#define GLPLATFORM_ENABLE_GL_KHR_texture_compression_astc_sliced_3d
+#else
+
+#ifndef GLPLATFORM_GL_FUNC
+#define GLPLATFORM_GL_FUNC(ret, name, params, args)
+#endif
+#ifndef GLPLATFORM_GL_VOID_FUNC
+#define GLPLATFORM_GL_VOID_FUNC(name, params, args)
+#endif
+#ifndef GLPLATFORM_GL_EXTENSION
+#define GLPLATFORM_GL_EXTENSION(name)
+#endif
+#ifndef GLPLATFORM_GL_SIGNATURE
+#define GLPLATFORM_GL_SIGNATURE(ret, name, params, args, sig, store, load)
+#endif
+#ifndef GLPLATFORM_GL_VOID_SIGNATURE
+#define GLPLATFORM_GL_VOID_SIGNATURE(name, params, args, sig, store, load)
+#endif
+
+GLPLATFORM_GL_VOID_FUNC(glActiveShaderProgram, (GLuint a0, GLuint a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glActiveTexture, (GLenum a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glAttachShader, (GLuint a0, GLuint a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glBeginConditionalRender, (GLuint a0, GLenum a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glBeginQuery, (GLenum a0, GLuint a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glBeginQueryIndexed, (GLenum a0, GLuint a1, GLuint a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glBeginTransformFeedback, (GLenum a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glBindAttribLocation, (GLuint a0, GLuint a1, const GLchar * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glBindBuffer, (GLenum a0, GLuint a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glBindBufferBase, (GLenum a0, GLuint a1, GLuint a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glBindBufferRange, (GLenum a0, GLuint a1, GLuint a2, GLintptr a3, GLsizeiptr a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glBindBuffersBase, (GLenum a0, GLuint a1, GLsizei a2, const GLuint * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glBindBuffersRange, (GLenum a0, GLuint a1, GLsizei a2, const GLuint * a3, const GLintptr * a4, const GLsizeiptr * a5), (a0, a1, a2, a3, a4, a5))
+GLPLATFORM_GL_VOID_FUNC(glBindFragDataLocation, (GLuint a0, GLuint a1, const GLchar * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glBindFragDataLocationIndexed, (GLuint a0, GLuint a1, GLuint a2, const GLchar * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glBindFramebuffer, (GLenum a0, GLuint a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glBindImageTexture, (GLuint a0, GLuint a1, GLint a2, GLboolean a3, GLint a4, GLenum a5, GLenum a6), (a0, a1, a2, a3, a4, a5, a6))
+GLPLATFORM_GL_VOID_FUNC(glBindImageTextures, (GLuint a0, GLsizei a1, const GLuint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glBindProgramPipeline, (GLuint a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glBindRenderbuffer, (GLenum a0, GLuint a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glBindSampler, (GLuint a0, GLuint a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glBindSamplers, (GLuint a0, GLsizei a1, const GLuint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glBindTexture, (GLenum a0, GLuint a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glBindTextureUnit, (GLuint a0, GLuint a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glBindTextures, (GLuint a0, GLsizei a1, const GLuint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glBindTransformFeedback, (GLenum a0, GLuint a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glBindVertexArray, (GLuint a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glBindVertexBuffer, (GLuint a0, GLuint a1, GLintptr a2, GLsizei a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glBindVertexBuffers, (GLuint a0, GLsizei a1, const GLuint * a2, const GLintptr * a3, const GLsizei * a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glBlendColor, (GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glBlendEquation, (GLenum a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glBlendEquationSeparate, (GLenum a0, GLenum a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glBlendEquationSeparatei, (GLuint a0, GLenum a1, GLenum a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glBlendEquationSeparateiARB, (GLuint a0, GLenum a1, GLenum a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glBlendEquationi, (GLuint a0, GLenum a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glBlendEquationiARB, (GLuint a0, GLenum a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glBlendFunc, (GLenum a0, GLenum a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glBlendFuncSeparate, (GLenum a0, GLenum a1, GLenum a2, GLenum a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glBlendFuncSeparatei, (GLuint a0, GLenum a1, GLenum a2, GLenum a3, GLenum a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glBlendFuncSeparateiARB, (GLuint a0, GLenum a1, GLenum a2, GLenum a3, GLenum a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glBlendFunci, (GLuint a0, GLenum a1, GLenum a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glBlendFunciARB, (GLuint a0, GLenum a1, GLenum a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glBlitFramebuffer, (GLint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLint a7, GLbitfield a8, GLenum a9), (a0, a1, a2, a3, a4, a5, a6, a7, a8, a9))
+GLPLATFORM_GL_VOID_FUNC(glBlitNamedFramebuffer, (GLuint a0, GLuint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLint a7, GLint a8, GLint a9, GLbitfield a10, GLenum a11), (a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11))
+GLPLATFORM_GL_VOID_FUNC(glBufferData, (GLenum a0, GLsizeiptr a1, const void * a2, GLenum a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glBufferPageCommitmentARB, (GLenum a0, GLintptr a1, GLsizeiptr a2, GLboolean a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glBufferStorage, (GLenum a0, GLsizeiptr a1, const void * a2, GLbitfield a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glBufferSubData, (GLenum a0, GLintptr a1, GLsizeiptr a2, const void * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_FUNC(GLenum, glCheckFramebufferStatus, (GLenum a0), (a0))
+GLPLATFORM_GL_FUNC(GLenum, glCheckNamedFramebufferStatus, (GLuint a0, GLenum a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glClampColor, (GLenum a0, GLenum a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glClear, (GLbitfield a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glClearBufferData, (GLenum a0, GLenum a1, GLenum a2, GLenum a3, const void * a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glClearBufferSubData, (GLenum a0, GLenum a1, GLintptr a2, GLsizeiptr a3, GLenum a4, GLenum a5, const void * a6), (a0, a1, a2, a3, a4, a5, a6))
+GLPLATFORM_GL_VOID_FUNC(glClearBufferfi, (GLenum a0, GLint a1, GLfloat a2, GLint a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glClearBufferfv, (GLenum a0, GLint a1, const GLfloat * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glClearBufferiv, (GLenum a0, GLint a1, const GLint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glClearBufferuiv, (GLenum a0, GLint a1, const GLuint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glClearColor, (GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glClearDepth, (GLdouble a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glClearDepthf, (GLfloat a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glClearNamedBufferData, (GLuint a0, GLenum a1, GLenum a2, GLenum a3, const void * a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glClearNamedBufferSubData, (GLuint a0, GLenum a1, GLintptr a2, GLsizeiptr a3, GLenum a4, GLenum a5, const void * a6), (a0, a1, a2, a3, a4, a5, a6))
+GLPLATFORM_GL_VOID_FUNC(glClearNamedFramebufferfi, (GLuint a0, GLenum a1, GLint a2, GLfloat a3, GLint a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glClearNamedFramebufferfv, (GLuint a0, GLenum a1, GLint a2, const GLfloat * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glClearNamedFramebufferiv, (GLuint a0, GLenum a1, GLint a2, const GLint * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glClearNamedFramebufferuiv, (GLuint a0, GLenum a1, GLint a2, const GLuint * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glClearStencil, (GLint a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glClearTexImage, (GLuint a0, GLint a1, GLenum a2, GLenum a3, const void * a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glClearTexSubImage, (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLenum a9, const void * a10), (a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10))
+GLPLATFORM_GL_FUNC(GLenum, glClientWaitSync, (GLsync a0, GLbitfield a1, GLuint64 a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glClipControl, (GLenum a0, GLenum a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glColorMask, (GLboolean a0, GLboolean a1, GLboolean a2, GLboolean a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glColorMaski, (GLuint a0, GLboolean a1, GLboolean a2, GLboolean a3, GLboolean a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glCompileShader, (GLuint a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glCompileShaderIncludeARB, (GLuint a0, GLsizei a1, const GLchar *const* a2, const GLint * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glCompressedTexImage1D, (GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLint a4, GLsizei a5, const void * a6), (a0, a1, a2, a3, a4, a5, a6))
+GLPLATFORM_GL_VOID_FUNC(glCompressedTexImage2D, (GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLsizei a4, GLint a5, GLsizei a6, const void * a7), (a0, a1, a2, a3, a4, a5, a6, a7))
+GLPLATFORM_GL_VOID_FUNC(glCompressedTexImage3D, (GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLint a6, GLsizei a7, const void * a8), (a0, a1, a2, a3, a4, a5, a6, a7, a8))
+GLPLATFORM_GL_VOID_FUNC(glCompressedTexSubImage1D, (GLenum a0, GLint a1, GLint a2, GLsizei a3, GLenum a4, GLsizei a5, const void * a6), (a0, a1, a2, a3, a4, a5, a6))
+GLPLATFORM_GL_VOID_FUNC(glCompressedTexSubImage2D, (GLenum a0, GLint a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5, GLenum a6, GLsizei a7, const void * a8), (a0, a1, a2, a3, a4, a5, a6, a7, a8))
+GLPLATFORM_GL_VOID_FUNC(glCompressedTexSubImage3D, (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLsizei a9, const void * a10), (a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10))
+GLPLATFORM_GL_VOID_FUNC(glCompressedTextureSubImage1D, (GLuint a0, GLint a1, GLint a2, GLsizei a3, GLenum a4, GLsizei a5, const void * a6), (a0, a1, a2, a3, a4, a5, a6))
+GLPLATFORM_GL_VOID_FUNC(glCompressedTextureSubImage2D, (GLuint a0, GLint a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5, GLenum a6, GLsizei a7, const void * a8), (a0, a1, a2, a3, a4, a5, a6, a7, a8))
+GLPLATFORM_GL_VOID_FUNC(glCompressedTextureSubImage3D, (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLsizei a9, const void * a10), (a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10))
+GLPLATFORM_GL_VOID_FUNC(glCopyBufferSubData, (GLenum a0, GLenum a1, GLintptr a2, GLintptr a3, GLsizeiptr a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glCopyImageSubData, (GLuint a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLint a5, GLuint a6, GLenum a7, GLint a8, GLint a9, GLint a10, GLint a11, GLsizei a12, GLsizei a13, GLsizei a14), (a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14))
+GLPLATFORM_GL_VOID_FUNC(glCopyNamedBufferSubData, (GLuint a0, GLuint a1, GLintptr a2, GLintptr a3, GLsizeiptr a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glCopyTexImage1D, (GLenum a0, GLint a1, GLenum a2, GLint a3, GLint a4, GLsizei a5, GLint a6), (a0, a1, a2, a3, a4, a5, a6))
+GLPLATFORM_GL_VOID_FUNC(glCopyTexImage2D, (GLenum a0, GLint a1, GLenum a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLint a7), (a0, a1, a2, a3, a4, a5, a6, a7))
+GLPLATFORM_GL_VOID_FUNC(glCopyTexSubImage1D, (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5), (a0, a1, a2, a3, a4, a5))
+GLPLATFORM_GL_VOID_FUNC(glCopyTexSubImage2D, (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLsizei a6, GLsizei a7), (a0, a1, a2, a3, a4, a5, a6, a7))
+GLPLATFORM_GL_VOID_FUNC(glCopyTexSubImage3D, (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLsizei a7, GLsizei a8), (a0, a1, a2, a3, a4, a5, a6, a7, a8))
+GLPLATFORM_GL_VOID_FUNC(glCopyTextureSubImage1D, (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5), (a0, a1, a2, a3, a4, a5))
+GLPLATFORM_GL_VOID_FUNC(glCopyTextureSubImage2D, (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLsizei a6, GLsizei a7), (a0, a1, a2, a3, a4, a5, a6, a7))
+GLPLATFORM_GL_VOID_FUNC(glCopyTextureSubImage3D, (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLsizei a7, GLsizei a8), (a0, a1, a2, a3, a4, a5, a6, a7, a8))
+GLPLATFORM_GL_VOID_FUNC(glCreateBuffers, (GLsizei a0, GLuint * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glCreateFramebuffers, (GLsizei a0, GLuint * a1), (a0, a1))
+GLPLATFORM_GL_FUNC(GLuint, glCreateProgram, (void), ())
+GLPLATFORM_GL_VOID_FUNC(glCreateProgramPipelines, (GLsizei a0, GLuint * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glCreateQueries, (GLenum a0, GLsizei a1, GLuint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glCreateRenderbuffers, (GLsizei a0, GLuint * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glCreateSamplers, (GLsizei a0, GLuint * a1), (a0, a1))
+GLPLATFORM_GL_FUNC(GLuint, glCreateShader, (GLenum a0), (a0))
+GLPLATFORM_GL_FUNC(GLuint, glCreateShaderProgramv, (GLenum a0, GLsizei a1, const GLchar *const* a2), (a0, a1, a2))
+GLPLATFORM_GL_FUNC(GLsync, glCreateSyncFromCLeventARB, (struct _cl_context * a0, struct _cl_event * a1, GLbitfield a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glCreateTextures, (GLenum a0, GLsizei a1, GLuint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glCreateTransformFeedbacks, (GLsizei a0, GLuint * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glCreateVertexArrays, (GLsizei a0, GLuint * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glCullFace, (GLenum a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glDebugMessageCallback, (GLDEBUGPROC a0, const void * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glDebugMessageCallbackARB, (GLDEBUGPROCARB a0, const void * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glDebugMessageCallbackKHR, (GLDEBUGPROCKHR a0, const void * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glDebugMessageControl, (GLenum a0, GLenum a1, GLenum a2, GLsizei a3, const GLuint * a4, GLboolean a5), (a0, a1, a2, a3, a4, a5))
+GLPLATFORM_GL_VOID_FUNC(glDebugMessageControlARB, (GLenum a0, GLenum a1, GLenum a2, GLsizei a3, const GLuint * a4, GLboolean a5), (a0, a1, a2, a3, a4, a5))
+GLPLATFORM_GL_VOID_FUNC(glDebugMessageControlKHR, (GLenum a0, GLenum a1, GLenum a2, GLsizei a3, const GLuint * a4, GLboolean a5), (a0, a1, a2, a3, a4, a5))
+GLPLATFORM_GL_VOID_FUNC(glDebugMessageInsert, (GLenum a0, GLenum a1, GLuint a2, GLenum a3, GLsizei a4, const GLchar * a5), (a0, a1, a2, a3, a4, a5))
+GLPLATFORM_GL_VOID_FUNC(glDebugMessageInsertARB, (GLenum a0, GLenum a1, GLuint a2, GLenum a3, GLsizei a4, const GLchar * a5), (a0, a1, a2, a3, a4, a5))
+GLPLATFORM_GL_VOID_FUNC(glDebugMessageInsertKHR, (GLenum a0, GLenum a1, GLuint a2, GLenum a3, GLsizei a4, const GLchar * a5), (a0, a1, a2, a3, a4, a5))
+GLPLATFORM_GL_VOID_FUNC(glDeleteBuffers, (GLsizei a0, const GLuint * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glDeleteFramebuffers, (GLsizei a0, const GLuint * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glDeleteNamedStringARB, (GLint a0, const GLchar * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glDeleteProgram, (GLuint a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glDeleteProgramPipelines, (GLsizei a0, const GLuint * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glDeleteQueries, (GLsizei a0, const GLuint * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glDeleteRenderbuffers, (GLsizei a0, const GLuint * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glDeleteSamplers, (GLsizei a0, const GLuint * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glDeleteShader, (GLuint a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glDeleteSync, (GLsync a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glDeleteTextures, (GLsizei a0, const GLuint * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glDeleteTransformFeedbacks, (GLsizei a0, const GLuint * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glDeleteVertexArrays, (GLsizei a0, const GLuint * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glDepthFunc, (GLenum a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glDepthMask, (GLboolean a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glDepthRange, (GLdouble a0, GLdouble a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glDepthRangeArrayv, (GLuint a0, GLsizei a1, const GLdouble * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glDepthRangeIndexed, (GLuint a0, GLdouble a1, GLdouble a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glDepthRangef, (GLfloat a0, GLfloat a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glDetachShader, (GLuint a0, GLuint a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glDisable, (GLenum a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glDisableVertexArrayAttrib, (GLuint a0, GLuint a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glDisableVertexAttribArray, (GLuint a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glDisablei, (GLenum a0, GLuint a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glDispatchCompute, (GLuint a0, GLuint a1, GLuint a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glDispatchComputeGroupSizeARB, (GLuint a0, GLuint a1, GLuint a2, GLuint a3, GLuint a4, GLuint a5), (a0, a1, a2, a3, a4, a5))
+GLPLATFORM_GL_VOID_FUNC(glDispatchComputeIndirect, (GLintptr a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glDrawArrays, (GLenum a0, GLint a1, GLsizei a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glDrawArraysIndirect, (GLenum a0, const void * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glDrawArraysInstanced, (GLenum a0, GLint a1, GLsizei a2, GLsizei a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glDrawArraysInstancedBaseInstance, (GLenum a0, GLint a1, GLsizei a2, GLsizei a3, GLuint a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glDrawBuffer, (GLenum a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glDrawBuffers, (GLsizei a0, const GLenum * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glDrawElements, (GLenum a0, GLsizei a1, GLenum a2, const void * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glDrawElementsBaseVertex, (GLenum a0, GLsizei a1, GLenum a2, const void * a3, GLint a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glDrawElementsIndirect, (GLenum a0, GLenum a1, const void * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glDrawElementsInstanced, (GLenum a0, GLsizei a1, GLenum a2, const void * a3, GLsizei a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glDrawElementsInstancedBaseInstance, (GLenum a0, GLsizei a1, GLenum a2, const void * a3, GLsizei a4, GLuint a5), (a0, a1, a2, a3, a4, a5))
+GLPLATFORM_GL_VOID_FUNC(glDrawElementsInstancedBaseVertex, (GLenum a0, GLsizei a1, GLenum a2, const void * a3, GLsizei a4, GLint a5), (a0, a1, a2, a3, a4, a5))
+GLPLATFORM_GL_VOID_FUNC(glDrawElementsInstancedBaseVertexBaseInstance, (GLenum a0, GLsizei a1, GLenum a2, const void * a3, GLsizei a4, GLint a5, GLuint a6), (a0, a1, a2, a3, a4, a5, a6))
+GLPLATFORM_GL_VOID_FUNC(glDrawRangeElements, (GLenum a0, GLuint a1, GLuint a2, GLsizei a3, GLenum a4, const void * a5), (a0, a1, a2, a3, a4, a5))
+GLPLATFORM_GL_VOID_FUNC(glDrawRangeElementsBaseVertex, (GLenum a0, GLuint a1, GLuint a2, GLsizei a3, GLenum a4, const void * a5, GLint a6), (a0, a1, a2, a3, a4, a5, a6))
+GLPLATFORM_GL_VOID_FUNC(glDrawTransformFeedback, (GLenum a0, GLuint a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glDrawTransformFeedbackInstanced, (GLenum a0, GLuint a1, GLsizei a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glDrawTransformFeedbackStream, (GLenum a0, GLuint a1, GLuint a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glDrawTransformFeedbackStreamInstanced, (GLenum a0, GLuint a1, GLuint a2, GLsizei a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glEnable, (GLenum a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glEnableVertexArrayAttrib, (GLuint a0, GLuint a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glEnableVertexAttribArray, (GLuint a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glEnablei, (GLenum a0, GLuint a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glEndConditionalRender, (void), ())
+GLPLATFORM_GL_VOID_FUNC(glEndQuery, (GLenum a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glEndQueryIndexed, (GLenum a0, GLuint a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glEndTransformFeedback, (void), ())
+GLPLATFORM_GL_FUNC(GLsync, glFenceSync, (GLenum a0, GLbitfield a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glFinish, (void), ())
+GLPLATFORM_GL_VOID_FUNC(glFlush, (void), ())
+GLPLATFORM_GL_VOID_FUNC(glFlushMappedBufferRange, (GLenum a0, GLintptr a1, GLsizeiptr a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glFlushMappedNamedBufferRange, (GLuint a0, GLintptr a1, GLsizeiptr a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glFramebufferParameteri, (GLenum a0, GLenum a1, GLint a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glFramebufferRenderbuffer, (GLenum a0, GLenum a1, GLenum a2, GLuint a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glFramebufferTexture, (GLenum a0, GLenum a1, GLuint a2, GLint a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glFramebufferTexture1D, (GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glFramebufferTexture2D, (GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glFramebufferTexture3D, (GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4, GLint a5), (a0, a1, a2, a3, a4, a5))
+GLPLATFORM_GL_VOID_FUNC(glFramebufferTextureLayer, (GLenum a0, GLenum a1, GLuint a2, GLint a3, GLint a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glFrontFace, (GLenum a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glGenBuffers, (GLsizei a0, GLuint * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glGenFramebuffers, (GLsizei a0, GLuint * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glGenProgramPipelines, (GLsizei a0, GLuint * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glGenQueries, (GLsizei a0, GLuint * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glGenRenderbuffers, (GLsizei a0, GLuint * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glGenSamplers, (GLsizei a0, GLuint * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glGenTextures, (GLsizei a0, GLuint * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glGenTransformFeedbacks, (GLsizei a0, GLuint * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glGenVertexArrays, (GLsizei a0, GLuint * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glGenerateMipmap, (GLenum a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glGenerateTextureMipmap, (GLuint a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glGetActiveAtomicCounterBufferiv, (GLuint a0, GLuint a1, GLenum a2, GLint * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetActiveAttrib, (GLuint a0, GLuint a1, GLsizei a2, GLsizei * a3, GLint * a4, GLenum * a5, GLchar * a6), (a0, a1, a2, a3, a4, a5, a6))
+GLPLATFORM_GL_VOID_FUNC(glGetActiveSubroutineName, (GLuint a0, GLenum a1, GLuint a2, GLsizei a3, GLsizei * a4, GLchar * a5), (a0, a1, a2, a3, a4, a5))
+GLPLATFORM_GL_VOID_FUNC(glGetActiveSubroutineUniformName, (GLuint a0, GLenum a1, GLuint a2, GLsizei a3, GLsizei * a4, GLchar * a5), (a0, a1, a2, a3, a4, a5))
+GLPLATFORM_GL_VOID_FUNC(glGetActiveSubroutineUniformiv, (GLuint a0, GLenum a1, GLuint a2, GLenum a3, GLint * a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glGetActiveUniform, (GLuint a0, GLuint a1, GLsizei a2, GLsizei * a3, GLint * a4, GLenum * a5, GLchar * a6), (a0, a1, a2, a3, a4, a5, a6))
+GLPLATFORM_GL_VOID_FUNC(glGetActiveUniformBlockName, (GLuint a0, GLuint a1, GLsizei a2, GLsizei * a3, GLchar * a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glGetActiveUniformBlockiv, (GLuint a0, GLuint a1, GLenum a2, GLint * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetActiveUniformName, (GLuint a0, GLuint a1, GLsizei a2, GLsizei * a3, GLchar * a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glGetActiveUniformsiv, (GLuint a0, GLsizei a1, const GLuint * a2, GLenum a3, GLint * a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glGetAttachedShaders, (GLuint a0, GLsizei a1, GLsizei * a2, GLuint * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_FUNC(GLint, glGetAttribLocation, (GLuint a0, const GLchar * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glGetBooleani_v, (GLenum a0, GLuint a1, GLboolean * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetBooleanv, (GLenum a0, GLboolean * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glGetBufferParameteri64v, (GLenum a0, GLenum a1, GLint64 * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetBufferParameteriv, (GLenum a0, GLenum a1, GLint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetBufferPointerv, (GLenum a0, GLenum a1, void ** a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetBufferSubData, (GLenum a0, GLintptr a1, GLsizeiptr a2, void * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetCompressedTexImage, (GLenum a0, GLint a1, void * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetCompressedTextureImage, (GLuint a0, GLint a1, GLsizei a2, void * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetCompressedTextureSubImage, (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLsizei a8, void * a9), (a0, a1, a2, a3, a4, a5, a6, a7, a8, a9))
+GLPLATFORM_GL_FUNC(GLuint, glGetDebugMessageLog, (GLuint a0, GLsizei a1, GLenum * a2, GLenum * a3, GLuint * a4, GLenum * a5, GLsizei * a6, GLchar * a7), (a0, a1, a2, a3, a4, a5, a6, a7))
+GLPLATFORM_GL_FUNC(GLuint, glGetDebugMessageLogARB, (GLuint a0, GLsizei a1, GLenum * a2, GLenum * a3, GLuint * a4, GLenum * a5, GLsizei * a6, GLchar * a7), (a0, a1, a2, a3, a4, a5, a6, a7))
+GLPLATFORM_GL_FUNC(GLuint, glGetDebugMessageLogKHR, (GLuint a0, GLsizei a1, GLenum * a2, GLenum * a3, GLuint * a4, GLenum * a5, GLsizei * a6, GLchar * a7), (a0, a1, a2, a3, a4, a5, a6, a7))
+GLPLATFORM_GL_VOID_FUNC(glGetDoublei_v, (GLenum a0, GLuint a1, GLdouble * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetDoublev, (GLenum a0, GLdouble * a1), (a0, a1))
+GLPLATFORM_GL_FUNC(GLenum, glGetError, (void), ())
+GLPLATFORM_GL_VOID_FUNC(glGetFloati_v, (GLenum a0, GLuint a1, GLfloat * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetFloatv, (GLenum a0, GLfloat * a1), (a0, a1))
+GLPLATFORM_GL_FUNC(GLint, glGetFragDataIndex, (GLuint a0, const GLchar * a1), (a0, a1))
+GLPLATFORM_GL_FUNC(GLint, glGetFragDataLocation, (GLuint a0, const GLchar * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glGetFramebufferAttachmentParameteriv, (GLenum a0, GLenum a1, GLenum a2, GLint * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetFramebufferParameteriv, (GLenum a0, GLenum a1, GLint * a2), (a0, a1, a2))
+GLPLATFORM_GL_FUNC(GLenum, glGetGraphicsResetStatus, (void), ())
+GLPLATFORM_GL_FUNC(GLenum, glGetGraphicsResetStatusARB, (void), ())
+GLPLATFORM_GL_FUNC(GLenum, glGetGraphicsResetStatusKHR, (void), ())
+GLPLATFORM_GL_FUNC(GLuint64, glGetImageHandleARB, (GLuint a0, GLint a1, GLboolean a2, GLint a3, GLenum a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glGetInteger64i_v, (GLenum a0, GLuint a1, GLint64 * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetInteger64v, (GLenum a0, GLint64 * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glGetIntegeri_v, (GLenum a0, GLuint a1, GLint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetIntegerv, (GLenum a0, GLint * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glGetInternalformati64v, (GLenum a0, GLenum a1, GLenum a2, GLsizei a3, GLint64 * a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glGetInternalformativ, (GLenum a0, GLenum a1, GLenum a2, GLsizei a3, GLint * a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glGetMultisamplefv, (GLenum a0, GLuint a1, GLfloat * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetNamedBufferParameteri64v, (GLuint a0, GLenum a1, GLint64 * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetNamedBufferParameteriv, (GLuint a0, GLenum a1, GLint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetNamedBufferPointerv, (GLuint a0, GLenum a1, void ** a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetNamedBufferSubData, (GLuint a0, GLintptr a1, GLsizeiptr a2, void * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetNamedFramebufferAttachmentParameteriv, (GLuint a0, GLenum a1, GLenum a2, GLint * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetNamedFramebufferParameteriv, (GLuint a0, GLenum a1, GLint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetNamedRenderbufferParameteriv, (GLuint a0, GLenum a1, GLint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetNamedStringARB, (GLint a0, const GLchar * a1, GLsizei a2, GLint * a3, GLchar * a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glGetNamedStringivARB, (GLint a0, const GLchar * a1, GLenum a2, GLint * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetObjectLabel, (GLenum a0, GLuint a1, GLsizei a2, GLsizei * a3, GLchar * a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glGetObjectLabelKHR, (GLenum a0, GLuint a1, GLsizei a2, GLsizei * a3, GLchar * a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glGetObjectPtrLabel, (const void * a0, GLsizei a1, GLsizei * a2, GLchar * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetObjectPtrLabelKHR, (const void * a0, GLsizei a1, GLsizei * a2, GLchar * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetPointerv, (GLenum a0, void ** a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glGetPointervKHR, (GLenum a0, void ** a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glGetProgramBinary, (GLuint a0, GLsizei a1, GLsizei * a2, GLenum * a3, void * a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glGetProgramInfoLog, (GLuint a0, GLsizei a1, GLsizei * a2, GLchar * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetProgramInterfaceiv, (GLuint a0, GLenum a1, GLenum a2, GLint * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetProgramPipelineInfoLog, (GLuint a0, GLsizei a1, GLsizei * a2, GLchar * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetProgramPipelineiv, (GLuint a0, GLenum a1, GLint * a2), (a0, a1, a2))
+GLPLATFORM_GL_FUNC(GLuint, glGetProgramResourceIndex, (GLuint a0, GLenum a1, const GLchar * a2), (a0, a1, a2))
+GLPLATFORM_GL_FUNC(GLint, glGetProgramResourceLocation, (GLuint a0, GLenum a1, const GLchar * a2), (a0, a1, a2))
+GLPLATFORM_GL_FUNC(GLint, glGetProgramResourceLocationIndex, (GLuint a0, GLenum a1, const GLchar * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetProgramResourceName, (GLuint a0, GLenum a1, GLuint a2, GLsizei a3, GLsizei * a4, GLchar * a5), (a0, a1, a2, a3, a4, a5))
+GLPLATFORM_GL_VOID_FUNC(glGetProgramResourceiv, (GLuint a0, GLenum a1, GLuint a2, GLsizei a3, const GLenum * a4, GLsizei a5, GLsizei * a6, GLint * a7), (a0, a1, a2, a3, a4, a5, a6, a7))
+GLPLATFORM_GL_VOID_FUNC(glGetProgramStageiv, (GLuint a0, GLenum a1, GLenum a2, GLint * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetProgramiv, (GLuint a0, GLenum a1, GLint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetQueryBufferObjecti64v, (GLuint a0, GLuint a1, GLenum a2, GLintptr a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetQueryBufferObjectiv, (GLuint a0, GLuint a1, GLenum a2, GLintptr a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetQueryBufferObjectui64v, (GLuint a0, GLuint a1, GLenum a2, GLintptr a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetQueryBufferObjectuiv, (GLuint a0, GLuint a1, GLenum a2, GLintptr a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetQueryIndexediv, (GLenum a0, GLuint a1, GLenum a2, GLint * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetQueryObjecti64v, (GLuint a0, GLenum a1, GLint64 * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetQueryObjectiv, (GLuint a0, GLenum a1, GLint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetQueryObjectui64v, (GLuint a0, GLenum a1, GLuint64 * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetQueryObjectuiv, (GLuint a0, GLenum a1, GLuint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetQueryiv, (GLenum a0, GLenum a1, GLint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetRenderbufferParameteriv, (GLenum a0, GLenum a1, GLint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetSamplerParameterIiv, (GLuint a0, GLenum a1, GLint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetSamplerParameterIuiv, (GLuint a0, GLenum a1, GLuint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetSamplerParameterfv, (GLuint a0, GLenum a1, GLfloat * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetSamplerParameteriv, (GLuint a0, GLenum a1, GLint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetShaderInfoLog, (GLuint a0, GLsizei a1, GLsizei * a2, GLchar * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetShaderPrecisionFormat, (GLenum a0, GLenum a1, GLint * a2, GLint * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetShaderSource, (GLuint a0, GLsizei a1, GLsizei * a2, GLchar * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetShaderiv, (GLuint a0, GLenum a1, GLint * a2), (a0, a1, a2))
+GLPLATFORM_GL_FUNC(const GLubyte *, glGetString, (GLenum a0), (a0))
+GLPLATFORM_GL_FUNC(const GLubyte *, glGetStringi, (GLenum a0, GLuint a1), (a0, a1))
+GLPLATFORM_GL_FUNC(GLuint, glGetSubroutineIndex, (GLuint a0, GLenum a1, const GLchar * a2), (a0, a1, a2))
+GLPLATFORM_GL_FUNC(GLint, glGetSubroutineUniformLocation, (GLuint a0, GLenum a1, const GLchar * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetSynciv, (GLsync a0, GLenum a1, GLsizei a2, GLsizei * a3, GLint * a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glGetTexImage, (GLenum a0, GLint a1, GLenum a2, GLenum a3, void * a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glGetTexLevelParameterfv, (GLenum a0, GLint a1, GLenum a2, GLfloat * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetTexLevelParameteriv, (GLenum a0, GLint a1, GLenum a2, GLint * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetTexParameterIiv, (GLenum a0, GLenum a1, GLint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetTexParameterIuiv, (GLenum a0, GLenum a1, GLuint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetTexParameterfv, (GLenum a0, GLenum a1, GLfloat * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetTexParameteriv, (GLenum a0, GLenum a1, GLint * a2), (a0, a1, a2))
+GLPLATFORM_GL_FUNC(GLuint64, glGetTextureHandleARB, (GLuint a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glGetTextureImage, (GLuint a0, GLint a1, GLenum a2, GLenum a3, GLsizei a4, void * a5), (a0, a1, a2, a3, a4, a5))
+GLPLATFORM_GL_VOID_FUNC(glGetTextureLevelParameterfv, (GLuint a0, GLint a1, GLenum a2, GLfloat * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetTextureLevelParameteriv, (GLuint a0, GLint a1, GLenum a2, GLint * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetTextureParameterIiv, (GLuint a0, GLenum a1, GLint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetTextureParameterIuiv, (GLuint a0, GLenum a1, GLuint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetTextureParameterfv, (GLuint a0, GLenum a1, GLfloat * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetTextureParameteriv, (GLuint a0, GLenum a1, GLint * a2), (a0, a1, a2))
+GLPLATFORM_GL_FUNC(GLuint64, glGetTextureSamplerHandleARB, (GLuint a0, GLuint a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glGetTextureSubImage, (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLenum a9, GLsizei a10, void * a11), (a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11))
+GLPLATFORM_GL_VOID_FUNC(glGetTransformFeedbackVarying, (GLuint a0, GLuint a1, GLsizei a2, GLsizei * a3, GLsizei * a4, GLenum * a5, GLchar * a6), (a0, a1, a2, a3, a4, a5, a6))
+GLPLATFORM_GL_VOID_FUNC(glGetTransformFeedbacki64_v, (GLuint a0, GLenum a1, GLuint a2, GLint64 * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetTransformFeedbacki_v, (GLuint a0, GLenum a1, GLuint a2, GLint * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetTransformFeedbackiv, (GLuint a0, GLenum a1, GLint * a2), (a0, a1, a2))
+GLPLATFORM_GL_FUNC(GLuint, glGetUniformBlockIndex, (GLuint a0, const GLchar * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glGetUniformIndices, (GLuint a0, GLsizei a1, const GLchar *const* a2, GLuint * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_FUNC(GLint, glGetUniformLocation, (GLuint a0, const GLchar * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glGetUniformSubroutineuiv, (GLenum a0, GLint a1, GLuint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetUniformdv, (GLuint a0, GLint a1, GLdouble * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetUniformfv, (GLuint a0, GLint a1, GLfloat * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetUniformiv, (GLuint a0, GLint a1, GLint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetUniformuiv, (GLuint a0, GLint a1, GLuint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetVertexArrayIndexed64iv, (GLuint a0, GLuint a1, GLenum a2, GLint64 * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetVertexArrayIndexediv, (GLuint a0, GLuint a1, GLenum a2, GLint * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetVertexArrayiv, (GLuint a0, GLenum a1, GLint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetVertexAttribIiv, (GLuint a0, GLenum a1, GLint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetVertexAttribIuiv, (GLuint a0, GLenum a1, GLuint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetVertexAttribLdv, (GLuint a0, GLenum a1, GLdouble * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetVertexAttribLui64vARB, (GLuint a0, GLenum a1, GLuint64EXT * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetVertexAttribPointerv, (GLuint a0, GLenum a1, void ** a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetVertexAttribdv, (GLuint a0, GLenum a1, GLdouble * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetVertexAttribfv, (GLuint a0, GLenum a1, GLfloat * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetVertexAttribiv, (GLuint a0, GLenum a1, GLint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glGetnCompressedTexImage, (GLenum a0, GLint a1, GLsizei a2, void * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetnCompressedTexImageARB, (GLenum a0, GLint a1, GLsizei a2, void * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetnTexImage, (GLenum a0, GLint a1, GLenum a2, GLenum a3, GLsizei a4, void * a5), (a0, a1, a2, a3, a4, a5))
+GLPLATFORM_GL_VOID_FUNC(glGetnTexImageARB, (GLenum a0, GLint a1, GLenum a2, GLenum a3, GLsizei a4, void * a5), (a0, a1, a2, a3, a4, a5))
+GLPLATFORM_GL_VOID_FUNC(glGetnUniformdv, (GLuint a0, GLint a1, GLsizei a2, GLdouble * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetnUniformdvARB, (GLuint a0, GLint a1, GLsizei a2, GLdouble * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetnUniformfv, (GLuint a0, GLint a1, GLsizei a2, GLfloat * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetnUniformfvARB, (GLuint a0, GLint a1, GLsizei a2, GLfloat * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetnUniformfvKHR, (GLuint a0, GLint a1, GLsizei a2, GLfloat * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetnUniformiv, (GLuint a0, GLint a1, GLsizei a2, GLint * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetnUniformivARB, (GLuint a0, GLint a1, GLsizei a2, GLint * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetnUniformivKHR, (GLuint a0, GLint a1, GLsizei a2, GLint * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetnUniformuiv, (GLuint a0, GLint a1, GLsizei a2, GLuint * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetnUniformuivARB, (GLuint a0, GLint a1, GLsizei a2, GLuint * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glGetnUniformuivKHR, (GLuint a0, GLint a1, GLsizei a2, GLuint * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glHint, (GLenum a0, GLenum a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glInvalidateBufferData, (GLuint a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glInvalidateBufferSubData, (GLuint a0, GLintptr a1, GLsizeiptr a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glInvalidateFramebuffer, (GLenum a0, GLsizei a1, const GLenum * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glInvalidateNamedFramebufferData, (GLuint a0, GLsizei a1, const GLenum * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glInvalidateNamedFramebufferSubData, (GLuint a0, GLsizei a1, const GLenum * a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6), (a0, a1, a2, a3, a4, a5, a6))
+GLPLATFORM_GL_VOID_FUNC(glInvalidateSubFramebuffer, (GLenum a0, GLsizei a1, const GLenum * a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6), (a0, a1, a2, a3, a4, a5, a6))
+GLPLATFORM_GL_VOID_FUNC(glInvalidateTexImage, (GLuint a0, GLint a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glInvalidateTexSubImage, (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7), (a0, a1, a2, a3, a4, a5, a6, a7))
+GLPLATFORM_GL_FUNC(GLboolean, glIsBuffer, (GLuint a0), (a0))
+GLPLATFORM_GL_FUNC(GLboolean, glIsEnabled, (GLenum a0), (a0))
+GLPLATFORM_GL_FUNC(GLboolean, glIsEnabledi, (GLenum a0, GLuint a1), (a0, a1))
+GLPLATFORM_GL_FUNC(GLboolean, glIsFramebuffer, (GLuint a0), (a0))
+GLPLATFORM_GL_FUNC(GLboolean, glIsImageHandleResidentARB, (GLuint64 a0), (a0))
+GLPLATFORM_GL_FUNC(GLboolean, glIsNamedStringARB, (GLint a0, const GLchar * a1), (a0, a1))
+GLPLATFORM_GL_FUNC(GLboolean, glIsProgram, (GLuint a0), (a0))
+GLPLATFORM_GL_FUNC(GLboolean, glIsProgramPipeline, (GLuint a0), (a0))
+GLPLATFORM_GL_FUNC(GLboolean, glIsQuery, (GLuint a0), (a0))
+GLPLATFORM_GL_FUNC(GLboolean, glIsRenderbuffer, (GLuint a0), (a0))
+GLPLATFORM_GL_FUNC(GLboolean, glIsSampler, (GLuint a0), (a0))
+GLPLATFORM_GL_FUNC(GLboolean, glIsShader, (GLuint a0), (a0))
+GLPLATFORM_GL_FUNC(GLboolean, glIsSync, (GLsync a0), (a0))
+GLPLATFORM_GL_FUNC(GLboolean, glIsTexture, (GLuint a0), (a0))
+GLPLATFORM_GL_FUNC(GLboolean, glIsTextureHandleResidentARB, (GLuint64 a0), (a0))
+GLPLATFORM_GL_FUNC(GLboolean, glIsTransformFeedback, (GLuint a0), (a0))
+GLPLATFORM_GL_FUNC(GLboolean, glIsVertexArray, (GLuint a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glLineWidth, (GLfloat a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glLinkProgram, (GLuint a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glLogicOp, (GLenum a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glMakeImageHandleNonResidentARB, (GLuint64 a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glMakeImageHandleResidentARB, (GLuint64 a0, GLenum a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glMakeTextureHandleNonResidentARB, (GLuint64 a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glMakeTextureHandleResidentARB, (GLuint64 a0), (a0))
+GLPLATFORM_GL_FUNC(void *, glMapBuffer, (GLenum a0, GLenum a1), (a0, a1))
+GLPLATFORM_GL_FUNC(void *, glMapBufferRange, (GLenum a0, GLintptr a1, GLsizeiptr a2, GLbitfield a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_FUNC(void *, glMapNamedBuffer, (GLuint a0, GLenum a1), (a0, a1))
+GLPLATFORM_GL_FUNC(void *, glMapNamedBufferRange, (GLuint a0, GLintptr a1, GLsizeiptr a2, GLbitfield a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glMemoryBarrier, (GLbitfield a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glMemoryBarrierByRegion, (GLbitfield a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glMinSampleShading, (GLfloat a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glMinSampleShadingARB, (GLfloat a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glMultiDrawArrays, (GLenum a0, const GLint * a1, const GLsizei * a2, GLsizei a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glMultiDrawArraysIndirect, (GLenum a0, const void * a1, GLsizei a2, GLsizei a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glMultiDrawArraysIndirectCountARB, (GLenum a0, GLintptr a1, GLintptr a2, GLsizei a3, GLsizei a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glMultiDrawElements, (GLenum a0, const GLsizei * a1, GLenum a2, const void *const* a3, GLsizei a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glMultiDrawElementsBaseVertex, (GLenum a0, const GLsizei * a1, GLenum a2, const void *const* a3, GLsizei a4, const GLint * a5), (a0, a1, a2, a3, a4, a5))
+GLPLATFORM_GL_VOID_FUNC(glMultiDrawElementsIndirect, (GLenum a0, GLenum a1, const void * a2, GLsizei a3, GLsizei a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glMultiDrawElementsIndirectCountARB, (GLenum a0, GLenum a1, GLintptr a2, GLintptr a3, GLsizei a4, GLsizei a5), (a0, a1, a2, a3, a4, a5))
+GLPLATFORM_GL_VOID_FUNC(glNamedBufferData, (GLuint a0, GLsizeiptr a1, const void * a2, GLenum a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glNamedBufferPageCommitmentARB, (GLuint a0, GLintptr a1, GLsizeiptr a2, GLboolean a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glNamedBufferPageCommitmentEXT, (GLuint a0, GLintptr a1, GLsizeiptr a2, GLboolean a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glNamedBufferStorage, (GLuint a0, GLsizeiptr a1, const void * a2, GLbitfield a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glNamedBufferSubData, (GLuint a0, GLintptr a1, GLsizeiptr a2, const void * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glNamedFramebufferDrawBuffer, (GLuint a0, GLenum a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glNamedFramebufferDrawBuffers, (GLuint a0, GLsizei a1, const GLenum * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glNamedFramebufferParameteri, (GLuint a0, GLenum a1, GLint a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glNamedFramebufferReadBuffer, (GLuint a0, GLenum a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glNamedFramebufferRenderbuffer, (GLuint a0, GLenum a1, GLenum a2, GLuint a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glNamedFramebufferTexture, (GLuint a0, GLenum a1, GLuint a2, GLint a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glNamedFramebufferTextureLayer, (GLuint a0, GLenum a1, GLuint a2, GLint a3, GLint a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glNamedRenderbufferStorage, (GLuint a0, GLenum a1, GLsizei a2, GLsizei a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glNamedRenderbufferStorageMultisample, (GLuint a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glNamedStringARB, (GLenum a0, GLint a1, const GLchar * a2, GLint a3, const GLchar * a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glObjectLabel, (GLenum a0, GLuint a1, GLsizei a2, const GLchar * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glObjectLabelKHR, (GLenum a0, GLuint a1, GLsizei a2, const GLchar * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glObjectPtrLabel, (const void * a0, GLsizei a1, const GLchar * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glObjectPtrLabelKHR, (const void * a0, GLsizei a1, const GLchar * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glPatchParameterfv, (GLenum a0, const GLfloat * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glPatchParameteri, (GLenum a0, GLint a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glPauseTransformFeedback, (void), ())
+GLPLATFORM_GL_VOID_FUNC(glPixelStoref, (GLenum a0, GLfloat a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glPixelStorei, (GLenum a0, GLint a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glPointParameterf, (GLenum a0, GLfloat a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glPointParameterfv, (GLenum a0, const GLfloat * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glPointParameteri, (GLenum a0, GLint a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glPointParameteriv, (GLenum a0, const GLint * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glPointSize, (GLfloat a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glPolygonMode, (GLenum a0, GLenum a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glPolygonOffset, (GLfloat a0, GLfloat a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glPopDebugGroup, (void), ())
+GLPLATFORM_GL_VOID_FUNC(glPopDebugGroupKHR, (void), ())
+GLPLATFORM_GL_VOID_FUNC(glPrimitiveRestartIndex, (GLuint a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glProgramBinary, (GLuint a0, GLenum a1, const void * a2, GLsizei a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glProgramParameteri, (GLuint a0, GLenum a1, GLint a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniform1d, (GLuint a0, GLint a1, GLdouble a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniform1dv, (GLuint a0, GLint a1, GLsizei a2, const GLdouble * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniform1f, (GLuint a0, GLint a1, GLfloat a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniform1fv, (GLuint a0, GLint a1, GLsizei a2, const GLfloat * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniform1i, (GLuint a0, GLint a1, GLint a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniform1iv, (GLuint a0, GLint a1, GLsizei a2, const GLint * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniform1ui, (GLuint a0, GLint a1, GLuint a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniform1uiv, (GLuint a0, GLint a1, GLsizei a2, const GLuint * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniform2d, (GLuint a0, GLint a1, GLdouble a2, GLdouble a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniform2dv, (GLuint a0, GLint a1, GLsizei a2, const GLdouble * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniform2f, (GLuint a0, GLint a1, GLfloat a2, GLfloat a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniform2fv, (GLuint a0, GLint a1, GLsizei a2, const GLfloat * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniform2i, (GLuint a0, GLint a1, GLint a2, GLint a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniform2iv, (GLuint a0, GLint a1, GLsizei a2, const GLint * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniform2ui, (GLuint a0, GLint a1, GLuint a2, GLuint a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniform2uiv, (GLuint a0, GLint a1, GLsizei a2, const GLuint * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniform3d, (GLuint a0, GLint a1, GLdouble a2, GLdouble a3, GLdouble a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniform3dv, (GLuint a0, GLint a1, GLsizei a2, const GLdouble * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniform3f, (GLuint a0, GLint a1, GLfloat a2, GLfloat a3, GLfloat a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniform3fv, (GLuint a0, GLint a1, GLsizei a2, const GLfloat * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniform3i, (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniform3iv, (GLuint a0, GLint a1, GLsizei a2, const GLint * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniform3ui, (GLuint a0, GLint a1, GLuint a2, GLuint a3, GLuint a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniform3uiv, (GLuint a0, GLint a1, GLsizei a2, const GLuint * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniform4d, (GLuint a0, GLint a1, GLdouble a2, GLdouble a3, GLdouble a4, GLdouble a5), (a0, a1, a2, a3, a4, a5))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniform4dv, (GLuint a0, GLint a1, GLsizei a2, const GLdouble * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniform4f, (GLuint a0, GLint a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5), (a0, a1, a2, a3, a4, a5))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniform4fv, (GLuint a0, GLint a1, GLsizei a2, const GLfloat * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniform4i, (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5), (a0, a1, a2, a3, a4, a5))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniform4iv, (GLuint a0, GLint a1, GLsizei a2, const GLint * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniform4ui, (GLuint a0, GLint a1, GLuint a2, GLuint a3, GLuint a4, GLuint a5), (a0, a1, a2, a3, a4, a5))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniform4uiv, (GLuint a0, GLint a1, GLsizei a2, const GLuint * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniformHandleui64ARB, (GLuint a0, GLint a1, GLuint64 a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniformHandleui64vARB, (GLuint a0, GLint a1, GLsizei a2, const GLuint64 * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniformMatrix2dv, (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble * a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniformMatrix2fv, (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat * a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniformMatrix2x3dv, (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble * a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniformMatrix2x3fv, (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat * a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniformMatrix2x4dv, (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble * a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniformMatrix2x4fv, (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat * a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniformMatrix3dv, (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble * a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniformMatrix3fv, (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat * a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniformMatrix3x2dv, (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble * a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniformMatrix3x2fv, (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat * a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniformMatrix3x4dv, (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble * a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniformMatrix3x4fv, (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat * a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniformMatrix4dv, (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble * a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniformMatrix4fv, (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat * a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniformMatrix4x2dv, (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble * a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniformMatrix4x2fv, (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat * a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniformMatrix4x3dv, (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble * a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glProgramUniformMatrix4x3fv, (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat * a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glProvokingVertex, (GLenum a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glPushDebugGroup, (GLenum a0, GLuint a1, GLsizei a2, const GLchar * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glPushDebugGroupKHR, (GLenum a0, GLuint a1, GLsizei a2, const GLchar * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glQueryCounter, (GLuint a0, GLenum a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glReadBuffer, (GLenum a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glReadPixels, (GLint a0, GLint a1, GLsizei a2, GLsizei a3, GLenum a4, GLenum a5, void * a6), (a0, a1, a2, a3, a4, a5, a6))
+GLPLATFORM_GL_VOID_FUNC(glReadnPixels, (GLint a0, GLint a1, GLsizei a2, GLsizei a3, GLenum a4, GLenum a5, GLsizei a6, void * a7), (a0, a1, a2, a3, a4, a5, a6, a7))
+GLPLATFORM_GL_VOID_FUNC(glReadnPixelsARB, (GLint a0, GLint a1, GLsizei a2, GLsizei a3, GLenum a4, GLenum a5, GLsizei a6, void * a7), (a0, a1, a2, a3, a4, a5, a6, a7))
+GLPLATFORM_GL_VOID_FUNC(glReadnPixelsKHR, (GLint a0, GLint a1, GLsizei a2, GLsizei a3, GLenum a4, GLenum a5, GLsizei a6, void * a7), (a0, a1, a2, a3, a4, a5, a6, a7))
+GLPLATFORM_GL_VOID_FUNC(glReleaseShaderCompiler, (void), ())
+GLPLATFORM_GL_VOID_FUNC(glRenderbufferStorage, (GLenum a0, GLenum a1, GLsizei a2, GLsizei a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glRenderbufferStorageMultisample, (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glResumeTransformFeedback, (void), ())
+GLPLATFORM_GL_VOID_FUNC(glSampleCoverage, (GLfloat a0, GLboolean a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glSampleMaski, (GLuint a0, GLbitfield a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glSamplerParameterIiv, (GLuint a0, GLenum a1, const GLint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glSamplerParameterIuiv, (GLuint a0, GLenum a1, const GLuint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glSamplerParameterf, (GLuint a0, GLenum a1, GLfloat a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glSamplerParameterfv, (GLuint a0, GLenum a1, const GLfloat * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glSamplerParameteri, (GLuint a0, GLenum a1, GLint a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glSamplerParameteriv, (GLuint a0, GLenum a1, const GLint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glScissor, (GLint a0, GLint a1, GLsizei a2, GLsizei a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glScissorArrayv, (GLuint a0, GLsizei a1, const GLint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glScissorIndexed, (GLuint a0, GLint a1, GLint a2, GLsizei a3, GLsizei a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glScissorIndexedv, (GLuint a0, const GLint * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glShaderBinary, (GLsizei a0, const GLuint * a1, GLenum a2, const void * a3, GLsizei a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glShaderSource, (GLuint a0, GLsizei a1, const GLchar *const* a2, const GLint * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glShaderStorageBlockBinding, (GLuint a0, GLuint a1, GLuint a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glStencilFunc, (GLenum a0, GLint a1, GLuint a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glStencilFuncSeparate, (GLenum a0, GLenum a1, GLint a2, GLuint a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glStencilMask, (GLuint a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glStencilMaskSeparate, (GLenum a0, GLuint a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glStencilOp, (GLenum a0, GLenum a1, GLenum a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glStencilOpSeparate, (GLenum a0, GLenum a1, GLenum a2, GLenum a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glTexBuffer, (GLenum a0, GLenum a1, GLuint a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glTexBufferRange, (GLenum a0, GLenum a1, GLuint a2, GLintptr a3, GLsizeiptr a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glTexImage1D, (GLenum a0, GLint a1, GLint a2, GLsizei a3, GLint a4, GLenum a5, GLenum a6, const void * a7), (a0, a1, a2, a3, a4, a5, a6, a7))
+GLPLATFORM_GL_VOID_FUNC(glTexImage2D, (GLenum a0, GLint a1, GLint a2, GLsizei a3, GLsizei a4, GLint a5, GLenum a6, GLenum a7, const void * a8), (a0, a1, a2, a3, a4, a5, a6, a7, a8))
+GLPLATFORM_GL_VOID_FUNC(glTexImage2DMultisample, (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLboolean a5), (a0, a1, a2, a3, a4, a5))
+GLPLATFORM_GL_VOID_FUNC(glTexImage3D, (GLenum a0, GLint a1, GLint a2, GLsizei a3, GLsizei a4, GLsizei a5, GLint a6, GLenum a7, GLenum a8, const void * a9), (a0, a1, a2, a3, a4, a5, a6, a7, a8, a9))
+GLPLATFORM_GL_VOID_FUNC(glTexImage3DMultisample, (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLboolean a6), (a0, a1, a2, a3, a4, a5, a6))
+GLPLATFORM_GL_VOID_FUNC(glTexPageCommitmentARB, (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLboolean a8), (a0, a1, a2, a3, a4, a5, a6, a7, a8))
+GLPLATFORM_GL_VOID_FUNC(glTexParameterIiv, (GLenum a0, GLenum a1, const GLint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glTexParameterIuiv, (GLenum a0, GLenum a1, const GLuint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glTexParameterf, (GLenum a0, GLenum a1, GLfloat a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glTexParameterfv, (GLenum a0, GLenum a1, const GLfloat * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glTexParameteri, (GLenum a0, GLenum a1, GLint a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glTexParameteriv, (GLenum a0, GLenum a1, const GLint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glTexStorage1D, (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glTexStorage2D, (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glTexStorage2DMultisample, (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLboolean a5), (a0, a1, a2, a3, a4, a5))
+GLPLATFORM_GL_VOID_FUNC(glTexStorage3D, (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5), (a0, a1, a2, a3, a4, a5))
+GLPLATFORM_GL_VOID_FUNC(glTexStorage3DMultisample, (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLboolean a6), (a0, a1, a2, a3, a4, a5, a6))
+GLPLATFORM_GL_VOID_FUNC(glTexSubImage1D, (GLenum a0, GLint a1, GLint a2, GLsizei a3, GLenum a4, GLenum a5, const void * a6), (a0, a1, a2, a3, a4, a5, a6))
+GLPLATFORM_GL_VOID_FUNC(glTexSubImage2D, (GLenum a0, GLint a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5, GLenum a6, GLenum a7, const void * a8), (a0, a1, a2, a3, a4, a5, a6, a7, a8))
+GLPLATFORM_GL_VOID_FUNC(glTexSubImage3D, (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLenum a9, const void * a10), (a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10))
+GLPLATFORM_GL_VOID_FUNC(glTextureBarrier, (void), ())
+GLPLATFORM_GL_VOID_FUNC(glTextureBuffer, (GLuint a0, GLenum a1, GLuint a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glTextureBufferRange, (GLuint a0, GLenum a1, GLuint a2, GLintptr a3, GLsizeiptr a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glTextureParameterIiv, (GLuint a0, GLenum a1, const GLint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glTextureParameterIuiv, (GLuint a0, GLenum a1, const GLuint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glTextureParameterf, (GLuint a0, GLenum a1, GLfloat a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glTextureParameterfv, (GLuint a0, GLenum a1, const GLfloat * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glTextureParameteri, (GLuint a0, GLenum a1, GLint a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glTextureParameteriv, (GLuint a0, GLenum a1, const GLint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glTextureStorage1D, (GLuint a0, GLsizei a1, GLenum a2, GLsizei a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glTextureStorage2D, (GLuint a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glTextureStorage2DMultisample, (GLuint a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLboolean a5), (a0, a1, a2, a3, a4, a5))
+GLPLATFORM_GL_VOID_FUNC(glTextureStorage3D, (GLuint a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5), (a0, a1, a2, a3, a4, a5))
+GLPLATFORM_GL_VOID_FUNC(glTextureStorage3DMultisample, (GLuint a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLboolean a6), (a0, a1, a2, a3, a4, a5, a6))
+GLPLATFORM_GL_VOID_FUNC(glTextureSubImage1D, (GLuint a0, GLint a1, GLint a2, GLsizei a3, GLenum a4, GLenum a5, const void * a6), (a0, a1, a2, a3, a4, a5, a6))
+GLPLATFORM_GL_VOID_FUNC(glTextureSubImage2D, (GLuint a0, GLint a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5, GLenum a6, GLenum a7, const void * a8), (a0, a1, a2, a3, a4, a5, a6, a7, a8))
+GLPLATFORM_GL_VOID_FUNC(glTextureSubImage3D, (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLenum a9, const void * a10), (a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10))
+GLPLATFORM_GL_VOID_FUNC(glTextureView, (GLuint a0, GLenum a1, GLuint a2, GLenum a3, GLuint a4, GLuint a5, GLuint a6, GLuint a7), (a0, a1, a2, a3, a4, a5, a6, a7))
+GLPLATFORM_GL_VOID_FUNC(glTransformFeedbackBufferBase, (GLuint a0, GLuint a1, GLuint a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glTransformFeedbackBufferRange, (GLuint a0, GLuint a1, GLuint a2, GLintptr a3, GLsizeiptr a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glTransformFeedbackVaryings, (GLuint a0, GLsizei a1, const GLchar *const* a2, GLenum a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glUniform1d, (GLint a0, GLdouble a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glUniform1dv, (GLint a0, GLsizei a1, const GLdouble * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glUniform1f, (GLint a0, GLfloat a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glUniform1fv, (GLint a0, GLsizei a1, const GLfloat * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glUniform1i, (GLint a0, GLint a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glUniform1iv, (GLint a0, GLsizei a1, const GLint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glUniform1ui, (GLint a0, GLuint a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glUniform1uiv, (GLint a0, GLsizei a1, const GLuint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glUniform2d, (GLint a0, GLdouble a1, GLdouble a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glUniform2dv, (GLint a0, GLsizei a1, const GLdouble * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glUniform2f, (GLint a0, GLfloat a1, GLfloat a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glUniform2fv, (GLint a0, GLsizei a1, const GLfloat * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glUniform2i, (GLint a0, GLint a1, GLint a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glUniform2iv, (GLint a0, GLsizei a1, const GLint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glUniform2ui, (GLint a0, GLuint a1, GLuint a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glUniform2uiv, (GLint a0, GLsizei a1, const GLuint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glUniform3d, (GLint a0, GLdouble a1, GLdouble a2, GLdouble a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glUniform3dv, (GLint a0, GLsizei a1, const GLdouble * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glUniform3f, (GLint a0, GLfloat a1, GLfloat a2, GLfloat a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glUniform3fv, (GLint a0, GLsizei a1, const GLfloat * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glUniform3i, (GLint a0, GLint a1, GLint a2, GLint a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glUniform3iv, (GLint a0, GLsizei a1, const GLint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glUniform3ui, (GLint a0, GLuint a1, GLuint a2, GLuint a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glUniform3uiv, (GLint a0, GLsizei a1, const GLuint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glUniform4d, (GLint a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glUniform4dv, (GLint a0, GLsizei a1, const GLdouble * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glUniform4f, (GLint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glUniform4fv, (GLint a0, GLsizei a1, const GLfloat * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glUniform4i, (GLint a0, GLint a1, GLint a2, GLint a3, GLint a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glUniform4iv, (GLint a0, GLsizei a1, const GLint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glUniform4ui, (GLint a0, GLuint a1, GLuint a2, GLuint a3, GLuint a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glUniform4uiv, (GLint a0, GLsizei a1, const GLuint * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glUniformBlockBinding, (GLuint a0, GLuint a1, GLuint a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glUniformHandleui64ARB, (GLint a0, GLuint64 a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glUniformHandleui64vARB, (GLint a0, GLsizei a1, const GLuint64 * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glUniformMatrix2dv, (GLint a0, GLsizei a1, GLboolean a2, const GLdouble * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glUniformMatrix2fv, (GLint a0, GLsizei a1, GLboolean a2, const GLfloat * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glUniformMatrix2x3dv, (GLint a0, GLsizei a1, GLboolean a2, const GLdouble * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glUniformMatrix2x3fv, (GLint a0, GLsizei a1, GLboolean a2, const GLfloat * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glUniformMatrix2x4dv, (GLint a0, GLsizei a1, GLboolean a2, const GLdouble * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glUniformMatrix2x4fv, (GLint a0, GLsizei a1, GLboolean a2, const GLfloat * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glUniformMatrix3dv, (GLint a0, GLsizei a1, GLboolean a2, const GLdouble * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glUniformMatrix3fv, (GLint a0, GLsizei a1, GLboolean a2, const GLfloat * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glUniformMatrix3x2dv, (GLint a0, GLsizei a1, GLboolean a2, const GLdouble * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glUniformMatrix3x2fv, (GLint a0, GLsizei a1, GLboolean a2, const GLfloat * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glUniformMatrix3x4dv, (GLint a0, GLsizei a1, GLboolean a2, const GLdouble * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glUniformMatrix3x4fv, (GLint a0, GLsizei a1, GLboolean a2, const GLfloat * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glUniformMatrix4dv, (GLint a0, GLsizei a1, GLboolean a2, const GLdouble * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glUniformMatrix4fv, (GLint a0, GLsizei a1, GLboolean a2, const GLfloat * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glUniformMatrix4x2dv, (GLint a0, GLsizei a1, GLboolean a2, const GLdouble * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glUniformMatrix4x2fv, (GLint a0, GLsizei a1, GLboolean a2, const GLfloat * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glUniformMatrix4x3dv, (GLint a0, GLsizei a1, GLboolean a2, const GLdouble * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glUniformMatrix4x3fv, (GLint a0, GLsizei a1, GLboolean a2, const GLfloat * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glUniformSubroutinesuiv, (GLenum a0, GLsizei a1, const GLuint * a2), (a0, a1, a2))
+GLPLATFORM_GL_FUNC(GLboolean, glUnmapBuffer, (GLenum a0), (a0))
+GLPLATFORM_GL_FUNC(GLboolean, glUnmapNamedBuffer, (GLuint a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glUseProgram, (GLuint a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glUseProgramStages, (GLuint a0, GLbitfield a1, GLuint a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glValidateProgram, (GLuint a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glValidateProgramPipeline, (GLuint a0), (a0))
+GLPLATFORM_GL_VOID_FUNC(glVertexArrayAttribBinding, (GLuint a0, GLuint a1, GLuint a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glVertexArrayAttribFormat, (GLuint a0, GLuint a1, GLint a2, GLenum a3, GLboolean a4, GLuint a5), (a0, a1, a2, a3, a4, a5))
+GLPLATFORM_GL_VOID_FUNC(glVertexArrayAttribIFormat, (GLuint a0, GLuint a1, GLint a2, GLenum a3, GLuint a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glVertexArrayAttribLFormat, (GLuint a0, GLuint a1, GLint a2, GLenum a3, GLuint a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glVertexArrayBindingDivisor, (GLuint a0, GLuint a1, GLuint a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glVertexArrayElementBuffer, (GLuint a0, GLuint a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexArrayVertexBuffer, (GLuint a0, GLuint a1, GLuint a2, GLintptr a3, GLsizei a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glVertexArrayVertexBuffers, (GLuint a0, GLuint a1, GLsizei a2, const GLuint * a3, const GLintptr * a4, const GLsizei * a5), (a0, a1, a2, a3, a4, a5))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttrib1d, (GLuint a0, GLdouble a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttrib1dv, (GLuint a0, const GLdouble * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttrib1f, (GLuint a0, GLfloat a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttrib1fv, (GLuint a0, const GLfloat * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttrib1s, (GLuint a0, GLshort a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttrib1sv, (GLuint a0, const GLshort * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttrib2d, (GLuint a0, GLdouble a1, GLdouble a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttrib2dv, (GLuint a0, const GLdouble * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttrib2f, (GLuint a0, GLfloat a1, GLfloat a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttrib2fv, (GLuint a0, const GLfloat * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttrib2s, (GLuint a0, GLshort a1, GLshort a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttrib2sv, (GLuint a0, const GLshort * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttrib3d, (GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttrib3dv, (GLuint a0, const GLdouble * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttrib3f, (GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttrib3fv, (GLuint a0, const GLfloat * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttrib3s, (GLuint a0, GLshort a1, GLshort a2, GLshort a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttrib3sv, (GLuint a0, const GLshort * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttrib4Nbv, (GLuint a0, const GLbyte * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttrib4Niv, (GLuint a0, const GLint * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttrib4Nsv, (GLuint a0, const GLshort * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttrib4Nub, (GLuint a0, GLubyte a1, GLubyte a2, GLubyte a3, GLubyte a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttrib4Nubv, (GLuint a0, const GLubyte * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttrib4Nuiv, (GLuint a0, const GLuint * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttrib4Nusv, (GLuint a0, const GLushort * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttrib4bv, (GLuint a0, const GLbyte * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttrib4d, (GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttrib4dv, (GLuint a0, const GLdouble * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttrib4f, (GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttrib4fv, (GLuint a0, const GLfloat * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttrib4iv, (GLuint a0, const GLint * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttrib4s, (GLuint a0, GLshort a1, GLshort a2, GLshort a3, GLshort a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttrib4sv, (GLuint a0, const GLshort * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttrib4ubv, (GLuint a0, const GLubyte * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttrib4uiv, (GLuint a0, const GLuint * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttrib4usv, (GLuint a0, const GLushort * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribBinding, (GLuint a0, GLuint a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribDivisor, (GLuint a0, GLuint a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribFormat, (GLuint a0, GLint a1, GLenum a2, GLboolean a3, GLuint a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribI1i, (GLuint a0, GLint a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribI1iv, (GLuint a0, const GLint * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribI1ui, (GLuint a0, GLuint a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribI1uiv, (GLuint a0, const GLuint * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribI2i, (GLuint a0, GLint a1, GLint a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribI2iv, (GLuint a0, const GLint * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribI2ui, (GLuint a0, GLuint a1, GLuint a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribI2uiv, (GLuint a0, const GLuint * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribI3i, (GLuint a0, GLint a1, GLint a2, GLint a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribI3iv, (GLuint a0, const GLint * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribI3ui, (GLuint a0, GLuint a1, GLuint a2, GLuint a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribI3uiv, (GLuint a0, const GLuint * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribI4bv, (GLuint a0, const GLbyte * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribI4i, (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribI4iv, (GLuint a0, const GLint * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribI4sv, (GLuint a0, const GLshort * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribI4ubv, (GLuint a0, const GLubyte * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribI4ui, (GLuint a0, GLuint a1, GLuint a2, GLuint a3, GLuint a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribI4uiv, (GLuint a0, const GLuint * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribI4usv, (GLuint a0, const GLushort * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribIFormat, (GLuint a0, GLint a1, GLenum a2, GLuint a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribIPointer, (GLuint a0, GLint a1, GLenum a2, GLsizei a3, const void * a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribL1d, (GLuint a0, GLdouble a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribL1dv, (GLuint a0, const GLdouble * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribL1ui64ARB, (GLuint a0, GLuint64EXT a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribL1ui64vARB, (GLuint a0, const GLuint64EXT * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribL2d, (GLuint a0, GLdouble a1, GLdouble a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribL2dv, (GLuint a0, const GLdouble * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribL3d, (GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribL3dv, (GLuint a0, const GLdouble * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribL4d, (GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribL4dv, (GLuint a0, const GLdouble * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribLFormat, (GLuint a0, GLint a1, GLenum a2, GLuint a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribLPointer, (GLuint a0, GLint a1, GLenum a2, GLsizei a3, const void * a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribP1ui, (GLuint a0, GLenum a1, GLboolean a2, GLuint a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribP1uiv, (GLuint a0, GLenum a1, GLboolean a2, const GLuint * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribP2ui, (GLuint a0, GLenum a1, GLboolean a2, GLuint a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribP2uiv, (GLuint a0, GLenum a1, GLboolean a2, const GLuint * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribP3ui, (GLuint a0, GLenum a1, GLboolean a2, GLuint a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribP3uiv, (GLuint a0, GLenum a1, GLboolean a2, const GLuint * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribP4ui, (GLuint a0, GLenum a1, GLboolean a2, GLuint a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribP4uiv, (GLuint a0, GLenum a1, GLboolean a2, const GLuint * a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glVertexAttribPointer, (GLuint a0, GLint a1, GLenum a2, GLboolean a3, GLsizei a4, const void * a5), (a0, a1, a2, a3, a4, a5))
+GLPLATFORM_GL_VOID_FUNC(glVertexBindingDivisor, (GLuint a0, GLuint a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glViewport, (GLint a0, GLint a1, GLsizei a2, GLsizei a3), (a0, a1, a2, a3))
+GLPLATFORM_GL_VOID_FUNC(glViewportArrayv, (GLuint a0, GLsizei a1, const GLfloat * a2), (a0, a1, a2))
+GLPLATFORM_GL_VOID_FUNC(glViewportIndexedf, (GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4), (a0, a1, a2, a3, a4))
+GLPLATFORM_GL_VOID_FUNC(glViewportIndexedfv, (GLuint a0, const GLfloat * a1), (a0, a1))
+GLPLATFORM_GL_VOID_FUNC(glWaitSync, (GLsync a0, GLbitfield a1, GLuint64 a2), (a0, a1, a2))
+
+GLPLATFORM_GL_EXTENSION(GL_ARB_ES2_compatibility)
+GLPLATFORM_GL_EXTENSION(GL_ARB_ES3_1_compatibility)
+GLPLATFORM_GL_EXTENSION(GL_ARB_ES3_compatibility)
+GLPLATFORM_GL_EXTENSION(GL_ARB_arrays_of_arrays)
+GLPLATFORM_GL_EXTENSION(GL_ARB_base_instance)
+GLPLATFORM_GL_EXTENSION(GL_ARB_bindless_texture)
+GLPLATFORM_GL_EXTENSION(GL_ARB_blend_func_extended)
+GLPLATFORM_GL_EXTENSION(GL_ARB_buffer_storage)
+GLPLATFORM_GL_EXTENSION(GL_ARB_cl_event)
+GLPLATFORM_GL_EXTENSION(GL_ARB_clear_buffer_object)
+GLPLATFORM_GL_EXTENSION(GL_ARB_clear_texture)
+GLPLATFORM_GL_EXTENSION(GL_ARB_clip_control)
+GLPLATFORM_GL_EXTENSION(GL_ARB_compressed_texture_pixel_storage)
+GLPLATFORM_GL_EXTENSION(GL_ARB_compute_shader)
+GLPLATFORM_GL_EXTENSION(GL_ARB_compute_variable_group_size)
+GLPLATFORM_GL_EXTENSION(GL_ARB_conditional_render_inverted)
+GLPLATFORM_GL_EXTENSION(GL_ARB_conservative_depth)
+GLPLATFORM_GL_EXTENSION(GL_ARB_copy_buffer)
+GLPLATFORM_GL_EXTENSION(GL_ARB_copy_image)
+GLPLATFORM_GL_EXTENSION(GL_ARB_cull_distance)
+GLPLATFORM_GL_EXTENSION(GL_ARB_debug_output)
+GLPLATFORM_GL_EXTENSION(GL_ARB_depth_buffer_float)
+GLPLATFORM_GL_EXTENSION(GL_ARB_depth_clamp)
+GLPLATFORM_GL_EXTENSION(GL_ARB_derivative_control)
+GLPLATFORM_GL_EXTENSION(GL_ARB_direct_state_access)
+GLPLATFORM_GL_EXTENSION(GL_ARB_draw_buffers_blend)
+GLPLATFORM_GL_EXTENSION(GL_ARB_draw_elements_base_vertex)
+GLPLATFORM_GL_EXTENSION(GL_ARB_draw_indirect)
+GLPLATFORM_GL_EXTENSION(GL_ARB_enhanced_layouts)
+GLPLATFORM_GL_EXTENSION(GL_ARB_explicit_attrib_location)
+GLPLATFORM_GL_EXTENSION(GL_ARB_explicit_uniform_location)
+GLPLATFORM_GL_EXTENSION(GL_ARB_fragment_coord_conventions)
+GLPLATFORM_GL_EXTENSION(GL_ARB_fragment_layer_viewport)
+GLPLATFORM_GL_EXTENSION(GL_ARB_framebuffer_no_attachments)
+GLPLATFORM_GL_EXTENSION(GL_ARB_framebuffer_object)
+GLPLATFORM_GL_EXTENSION(GL_ARB_framebuffer_sRGB)
+GLPLATFORM_GL_EXTENSION(GL_ARB_get_program_binary)
+GLPLATFORM_GL_EXTENSION(GL_ARB_get_texture_sub_image)
+GLPLATFORM_GL_EXTENSION(GL_ARB_gpu_shader5)
+GLPLATFORM_GL_EXTENSION(GL_ARB_gpu_shader_fp64)
+GLPLATFORM_GL_EXTENSION(GL_ARB_half_float_vertex)
+GLPLATFORM_GL_EXTENSION(GL_ARB_imaging)
+GLPLATFORM_GL_EXTENSION(GL_ARB_indirect_parameters)
+GLPLATFORM_GL_EXTENSION(GL_ARB_internalformat_query)
+GLPLATFORM_GL_EXTENSION(GL_ARB_internalformat_query2)
+GLPLATFORM_GL_EXTENSION(GL_ARB_invalidate_subdata)
+GLPLATFORM_GL_EXTENSION(GL_ARB_map_buffer_alignment)
+GLPLATFORM_GL_EXTENSION(GL_ARB_map_buffer_range)
+GLPLATFORM_GL_EXTENSION(GL_ARB_multi_bind)
+GLPLATFORM_GL_EXTENSION(GL_ARB_multi_draw_indirect)
+GLPLATFORM_GL_EXTENSION(GL_ARB_occlusion_query2)
+GLPLATFORM_GL_EXTENSION(GL_ARB_pipeline_statistics_query)
+GLPLATFORM_GL_EXTENSION(GL_ARB_program_interface_query)
+GLPLATFORM_GL_EXTENSION(GL_ARB_provoking_vertex)
+GLPLATFORM_GL_EXTENSION(GL_ARB_query_buffer_object)
+GLPLATFORM_GL_EXTENSION(GL_ARB_robust_buffer_access_behavior)
+GLPLATFORM_GL_EXTENSION(GL_ARB_robustness)
+GLPLATFORM_GL_EXTENSION(GL_ARB_robustness_isolation)
+GLPLATFORM_GL_EXTENSION(GL_ARB_sample_shading)
+GLPLATFORM_GL_EXTENSION(GL_ARB_sampler_objects)
+GLPLATFORM_GL_EXTENSION(GL_ARB_seamless_cube_map)
+GLPLATFORM_GL_EXTENSION(GL_ARB_seamless_cubemap_per_texture)
+GLPLATFORM_GL_EXTENSION(GL_ARB_separate_shader_objects)
+GLPLATFORM_GL_EXTENSION(GL_ARB_shader_atomic_counters)
+GLPLATFORM_GL_EXTENSION(GL_ARB_shader_bit_encoding)
+GLPLATFORM_GL_EXTENSION(GL_ARB_shader_draw_parameters)
+GLPLATFORM_GL_EXTENSION(GL_ARB_shader_group_vote)
+GLPLATFORM_GL_EXTENSION(GL_ARB_shader_image_load_store)
+GLPLATFORM_GL_EXTENSION(GL_ARB_shader_image_size)
+GLPLATFORM_GL_EXTENSION(GL_ARB_shader_precision)
+GLPLATFORM_GL_EXTENSION(GL_ARB_shader_stencil_export)
+GLPLATFORM_GL_EXTENSION(GL_ARB_shader_storage_buffer_object)
+GLPLATFORM_GL_EXTENSION(GL_ARB_shader_subroutine)
+GLPLATFORM_GL_EXTENSION(GL_ARB_shader_texture_image_samples)
+GLPLATFORM_GL_EXTENSION(GL_ARB_shading_language_420pack)
+GLPLATFORM_GL_EXTENSION(GL_ARB_shading_language_include)
+GLPLATFORM_GL_EXTENSION(GL_ARB_shading_language_packing)
+GLPLATFORM_GL_EXTENSION(GL_ARB_sparse_buffer)
+GLPLATFORM_GL_EXTENSION(GL_ARB_sparse_texture)
+GLPLATFORM_GL_EXTENSION(GL_ARB_stencil_texturing)
+GLPLATFORM_GL_EXTENSION(GL_ARB_sync)
+GLPLATFORM_GL_EXTENSION(GL_ARB_tessellation_shader)
+GLPLATFORM_GL_EXTENSION(GL_ARB_texture_barrier)
+GLPLATFORM_GL_EXTENSION(GL_ARB_texture_buffer_object_rgb32)
+GLPLATFORM_GL_EXTENSION(GL_ARB_texture_buffer_range)
+GLPLATFORM_GL_EXTENSION(GL_ARB_texture_compression_bptc)
+GLPLATFORM_GL_EXTENSION(GL_ARB_texture_compression_rgtc)
+GLPLATFORM_GL_EXTENSION(GL_ARB_texture_cube_map_array)
+GLPLATFORM_GL_EXTENSION(GL_ARB_texture_gather)
+GLPLATFORM_GL_EXTENSION(GL_ARB_texture_mirror_clamp_to_edge)
+GLPLATFORM_GL_EXTENSION(GL_ARB_texture_multisample)
+GLPLATFORM_GL_EXTENSION(GL_ARB_texture_query_levels)
+GLPLATFORM_GL_EXTENSION(GL_ARB_texture_query_lod)
+GLPLATFORM_GL_EXTENSION(GL_ARB_texture_rg)
+GLPLATFORM_GL_EXTENSION(GL_ARB_texture_rgb10_a2ui)
+GLPLATFORM_GL_EXTENSION(GL_ARB_texture_stencil8)
+GLPLATFORM_GL_EXTENSION(GL_ARB_texture_storage)
+GLPLATFORM_GL_EXTENSION(GL_ARB_texture_storage_multisample)
+GLPLATFORM_GL_EXTENSION(GL_ARB_texture_swizzle)
+GLPLATFORM_GL_EXTENSION(GL_ARB_texture_view)
+GLPLATFORM_GL_EXTENSION(GL_ARB_timer_query)
+GLPLATFORM_GL_EXTENSION(GL_ARB_transform_feedback2)
+GLPLATFORM_GL_EXTENSION(GL_ARB_transform_feedback3)
+GLPLATFORM_GL_EXTENSION(GL_ARB_transform_feedback_instanced)
+GLPLATFORM_GL_EXTENSION(GL_ARB_transform_feedback_overflow_query)
+GLPLATFORM_GL_EXTENSION(GL_ARB_uniform_buffer_object)
+GLPLATFORM_GL_EXTENSION(GL_ARB_vertex_array_bgra)
+GLPLATFORM_GL_EXTENSION(GL_ARB_vertex_array_object)
+GLPLATFORM_GL_EXTENSION(GL_ARB_vertex_attrib_64bit)
+GLPLATFORM_GL_EXTENSION(GL_ARB_vertex_attrib_binding)
+GLPLATFORM_GL_EXTENSION(GL_ARB_vertex_type_10f_11f_11f_rev)
+GLPLATFORM_GL_EXTENSION(GL_ARB_vertex_type_2_10_10_10_rev)
+GLPLATFORM_GL_EXTENSION(GL_ARB_viewport_array)
+GLPLATFORM_GL_EXTENSION(GL_KHR_context_flush_control)
+GLPLATFORM_GL_EXTENSION(GL_KHR_debug)
+GLPLATFORM_GL_EXTENSION(GL_KHR_no_error)
+GLPLATFORM_GL_EXTENSION(GL_KHR_robust_buffer_access_behavior)
+GLPLATFORM_GL_EXTENSION(GL_KHR_robustness)
+GLPLATFORM_GL_EXTENSION(GL_KHR_texture_compression_astc_hdr)
+GLPLATFORM_GL_EXTENSION(GL_KHR_texture_compression_astc_ldr)
+GLPLATFORM_GL_EXTENSION(GL_KHR_texture_compression_astc_sliced_3d)
+
+GLPLATFORM_GL_VOID_SIGNATURE(glActiveShaderProgram, (GLuint a0, GLuint a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glActiveTexture, (GLenum a0), (a0), "vi", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLenum)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glAttachShader, (GLuint a0, GLuint a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBeginConditionalRender, (GLuint a0, GLenum a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBeginQuery, (GLenum a0, GLuint a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBeginQueryIndexed, (GLenum a0, GLuint a1, GLuint a2), (a0, a1, a2), "viii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBeginTransformFeedback, (GLenum a0), (a0), "vi", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLenum)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBindAttribLocation, (GLuint a0, GLuint a1, const GLchar * a2), (a0, a1, a2), "viiS", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (const GLchar *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBindBuffer, (GLenum a0, GLuint a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBindBufferBase, (GLenum a0, GLuint a1, GLuint a2), (a0, a1, a2), "viii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBindBufferRange, (GLenum a0, GLuint a1, GLuint a2, GLintptr a3, GLsizeiptr a4), (a0, a1, a2, a3, a4), "viiill", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, l, a3), GLPLATFORM_GL_STORE(4, l, a4)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i), (GLintptr)GLPLATFORM_GL_LOAD(3, l), (GLsizeiptr)GLPLATFORM_GL_LOAD(4, l)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBindBuffersBase, (GLenum a0, GLuint a1, GLsizei a2, const GLuint * a3), (a0, a1, a2, a3), "viin4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (const GLuint *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBindBuffersRange, (GLenum a0, GLuint a1, GLsizei a2, const GLuint * a3, const GLintptr * a4, const GLsizeiptr * a5), (a0, a1, a2, a3, a4, a5), "viin488", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3), GLPLATFORM_GL_STORE(4, p, a4), GLPLATFORM_GL_STORE(5, p, a5)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (const GLuint *)GLPLATFORM_GL_LOAD(3, p), (const GLintptr *)GLPLATFORM_GL_LOAD(4, p), (const GLsizeiptr *)GLPLATFORM_GL_LOAD(5, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBindFragDataLocation, (GLuint a0, GLuint a1, const GLchar * a2), (a0, a1, a2), "viiS", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (const GLchar *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBindFragDataLocationIndexed, (GLuint a0, GLuint a1, GLuint a2, const GLchar * a3), (a0, a1, a2, a3), "viiiS", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i), (const GLchar *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBindFramebuffer, (GLenum a0, GLuint a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBindImageTexture, (GLuint a0, GLuint a1, GLint a2, GLboolean a3, GLint a4, GLenum a5, GLenum a6), (a0, a1, a2, a3, a4, a5, a6), "viiiiiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, i, a6)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLboolean)GLPLATFORM_GL_LOAD(3, i), (GLint)GLPLATFORM_GL_LOAD(4, i), (GLenum)GLPLATFORM_GL_LOAD(5, i), (GLenum)GLPLATFORM_GL_LOAD(6, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBindImageTextures, (GLuint a0, GLsizei a1, const GLuint * a2), (a0, a1, a2), "vin4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (const GLuint *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBindProgramPipeline, (GLuint a0), (a0), "vi", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLuint)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBindRenderbuffer, (GLenum a0, GLuint a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBindSampler, (GLuint a0, GLuint a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBindSamplers, (GLuint a0, GLsizei a1, const GLuint * a2), (a0, a1, a2), "vin4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (const GLuint *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBindTexture, (GLenum a0, GLuint a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBindTextureUnit, (GLuint a0, GLuint a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBindTextures, (GLuint a0, GLsizei a1, const GLuint * a2), (a0, a1, a2), "vin4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (const GLuint *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBindTransformFeedback, (GLenum a0, GLuint a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBindVertexArray, (GLuint a0), (a0), "vi", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLuint)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBindVertexBuffer, (GLuint a0, GLuint a1, GLintptr a2, GLsizei a3), (a0, a1, a2, a3), "viiln", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, l, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLintptr)GLPLATFORM_GL_LOAD(2, l), (GLsizei)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBindVertexBuffers, (GLuint a0, GLsizei a1, const GLuint * a2, const GLintptr * a3, const GLsizei * a4), (a0, a1, a2, a3, a4), "vin484", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2), GLPLATFORM_GL_STORE(3, p, a3), GLPLATFORM_GL_STORE(4, p, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (const GLuint *)GLPLATFORM_GL_LOAD(2, p), (const GLintptr *)GLPLATFORM_GL_LOAD(3, p), (const GLsizei *)GLPLATFORM_GL_LOAD(4, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBlendColor, (GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3), (a0, a1, a2, a3), "vffff", (GLPLATFORM_GL_STORE(0, f, a0), GLPLATFORM_GL_STORE(1, f, a1), GLPLATFORM_GL_STORE(2, f, a2), GLPLATFORM_GL_STORE(3, f, a3)), ((GLfloat)GLPLATFORM_GL_LOAD(0, f), (GLfloat)GLPLATFORM_GL_LOAD(1, f), (GLfloat)GLPLATFORM_GL_LOAD(2, f), (GLfloat)GLPLATFORM_GL_LOAD(3, f)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBlendEquation, (GLenum a0), (a0), "vi", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLenum)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBlendEquationSeparate, (GLenum a0, GLenum a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBlendEquationSeparatei, (GLuint a0, GLenum a1, GLenum a2), (a0, a1, a2), "viii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBlendEquationSeparateiARB, (GLuint a0, GLenum a1, GLenum a2), (a0, a1, a2), "viii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBlendEquationi, (GLuint a0, GLenum a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBlendEquationiARB, (GLuint a0, GLenum a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBlendFunc, (GLenum a0, GLenum a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBlendFuncSeparate, (GLenum a0, GLenum a1, GLenum a2, GLenum a3), (a0, a1, a2, a3), "viiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLenum)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBlendFuncSeparatei, (GLuint a0, GLenum a1, GLenum a2, GLenum a3, GLenum a4), (a0, a1, a2, a3, a4), "viiiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLenum)GLPLATFORM_GL_LOAD(3, i), (GLenum)GLPLATFORM_GL_LOAD(4, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBlendFuncSeparateiARB, (GLuint a0, GLenum a1, GLenum a2, GLenum a3, GLenum a4), (a0, a1, a2, a3, a4), "viiiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLenum)GLPLATFORM_GL_LOAD(3, i), (GLenum)GLPLATFORM_GL_LOAD(4, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBlendFunci, (GLuint a0, GLenum a1, GLenum a2), (a0, a1, a2), "viii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBlendFunciARB, (GLuint a0, GLenum a1, GLenum a2), (a0, a1, a2), "viii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBlitFramebuffer, (GLint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLint a7, GLbitfield a8, GLenum a9), (a0, a1, a2, a3, a4, a5, a6, a7, a8, a9), "viiiiiiiiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, i, a6), GLPLATFORM_GL_STORE(7, i, a7), GLPLATFORM_GL_STORE(8, i, a8), GLPLATFORM_GL_STORE(9, i, a9)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLint)GLPLATFORM_GL_LOAD(3, i), (GLint)GLPLATFORM_GL_LOAD(4, i), (GLint)GLPLATFORM_GL_LOAD(5, i), (GLint)GLPLATFORM_GL_LOAD(6, i), (GLint)GLPLATFORM_GL_LOAD(7, i), (GLbitfield)GLPLATFORM_GL_LOAD(8, i), (GLenum)GLPLATFORM_GL_LOAD(9, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBlitNamedFramebuffer, (GLuint a0, GLuint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLint a7, GLint a8, GLint a9, GLbitfield a10, GLenum a11), (a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11), "viiiiiiiiiiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, i, a6), GLPLATFORM_GL_STORE(7, i, a7), GLPLATFORM_GL_STORE(8, i, a8), GLPLATFORM_GL_STORE(9, i, a9), GLPLATFORM_GL_STORE(10, i, a10), GLPLATFORM_GL_STORE(11, i, a11)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLint)GLPLATFORM_GL_LOAD(3, i), (GLint)GLPLATFORM_GL_LOAD(4, i), (GLint)GLPLATFORM_GL_LOAD(5, i), (GLint)GLPLATFORM_GL_LOAD(6, i), (GLint)GLPLATFORM_GL_LOAD(7, i), (GLint)GLPLATFORM_GL_LOAD(8, i), (GLint)GLPLATFORM_GL_LOAD(9, i), (GLbitfield)GLPLATFORM_GL_LOAD(10, i), (GLenum)GLPLATFORM_GL_LOAD(11, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBufferData, (GLenum a0, GLsizeiptr a1, const void * a2, GLenum a3), (a0, a1, a2, a3), "vilpi", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, l, a1), GLPLATFORM_GL_STORE(2, p, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLsizeiptr)GLPLATFORM_GL_LOAD(1, l), (const void *)GLPLATFORM_GL_LOAD(2, p), (GLenum)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBufferPageCommitmentARB, (GLenum a0, GLintptr a1, GLsizeiptr a2, GLboolean a3), (a0, a1, a2, a3), "villi", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, l, a1), GLPLATFORM_GL_STORE(2, l, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLintptr)GLPLATFORM_GL_LOAD(1, l), (GLsizeiptr)GLPLATFORM_GL_LOAD(2, l), (GLboolean)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBufferStorage, (GLenum a0, GLsizeiptr a1, const void * a2, GLbitfield a3), (a0, a1, a2, a3), "vilpi", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, l, a1), GLPLATFORM_GL_STORE(2, p, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLsizeiptr)GLPLATFORM_GL_LOAD(1, l), (const void *)GLPLATFORM_GL_LOAD(2, p), (GLbitfield)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glBufferSubData, (GLenum a0, GLintptr a1, GLsizeiptr a2, const void * a3), (a0, a1, a2, a3), "villp", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, l, a1), GLPLATFORM_GL_STORE(2, l, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLintptr)GLPLATFORM_GL_LOAD(1, l), (GLsizeiptr)GLPLATFORM_GL_LOAD(2, l), (const void *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_SIGNATURE(GLenum, glCheckFramebufferStatus, (GLenum a0), (a0), "ii", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLenum)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_SIGNATURE(GLenum, glCheckNamedFramebufferStatus, (GLuint a0, GLenum a1), (a0, a1), "iii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glClampColor, (GLenum a0, GLenum a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glClear, (GLbitfield a0), (a0), "vi", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLbitfield)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glClearBufferData, (GLenum a0, GLenum a1, GLenum a2, GLenum a3, const void * a4), (a0, a1, a2, a3, a4), "viiiip", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, p, a4)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLenum)GLPLATFORM_GL_LOAD(3, i), (const void *)GLPLATFORM_GL_LOAD(4, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glClearBufferSubData, (GLenum a0, GLenum a1, GLintptr a2, GLsizeiptr a3, GLenum a4, GLenum a5, const void * a6), (a0, a1, a2, a3, a4, a5, a6), "viilliip", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, l, a2), GLPLATFORM_GL_STORE(3, l, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, p, a6)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLintptr)GLPLATFORM_GL_LOAD(2, l), (GLsizeiptr)GLPLATFORM_GL_LOAD(3, l), (GLenum)GLPLATFORM_GL_LOAD(4, i), (GLenum)GLPLATFORM_GL_LOAD(5, i), (const void *)GLPLATFORM_GL_LOAD(6, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glClearBufferfi, (GLenum a0, GLint a1, GLfloat a2, GLint a3), (a0, a1, a2, a3), "viifi", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, f, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLfloat)GLPLATFORM_GL_LOAD(2, f), (GLint)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glClearBufferfv, (GLenum a0, GLint a1, const GLfloat * a2), (a0, a1, a2), "vii4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (const GLfloat *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glClearBufferiv, (GLenum a0, GLint a1, const GLint * a2), (a0, a1, a2), "vii4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (const GLint *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glClearBufferuiv, (GLenum a0, GLint a1, const GLuint * a2), (a0, a1, a2), "vii4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (const GLuint *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glClearColor, (GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3), (a0, a1, a2, a3), "vffff", (GLPLATFORM_GL_STORE(0, f, a0), GLPLATFORM_GL_STORE(1, f, a1), GLPLATFORM_GL_STORE(2, f, a2), GLPLATFORM_GL_STORE(3, f, a3)), ((GLfloat)GLPLATFORM_GL_LOAD(0, f), (GLfloat)GLPLATFORM_GL_LOAD(1, f), (GLfloat)GLPLATFORM_GL_LOAD(2, f), (GLfloat)GLPLATFORM_GL_LOAD(3, f)))
+GLPLATFORM_GL_VOID_SIGNATURE(glClearDepth, (GLdouble a0), (a0), "vd", (GLPLATFORM_GL_STORE(0, d, a0)), ((GLdouble)GLPLATFORM_GL_LOAD(0, d)))
+GLPLATFORM_GL_VOID_SIGNATURE(glClearDepthf, (GLfloat a0), (a0), "vf", (GLPLATFORM_GL_STORE(0, f, a0)), ((GLfloat)GLPLATFORM_GL_LOAD(0, f)))
+GLPLATFORM_GL_VOID_SIGNATURE(glClearNamedBufferData, (GLuint a0, GLenum a1, GLenum a2, GLenum a3, const void * a4), (a0, a1, a2, a3, a4), "viiiip", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, p, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLenum)GLPLATFORM_GL_LOAD(3, i), (const void *)GLPLATFORM_GL_LOAD(4, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glClearNamedBufferSubData, (GLuint a0, GLenum a1, GLintptr a2, GLsizeiptr a3, GLenum a4, GLenum a5, const void * a6), (a0, a1, a2, a3, a4, a5, a6), "viilliip", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, l, a2), GLPLATFORM_GL_STORE(3, l, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, p, a6)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLintptr)GLPLATFORM_GL_LOAD(2, l), (GLsizeiptr)GLPLATFORM_GL_LOAD(3, l), (GLenum)GLPLATFORM_GL_LOAD(4, i), (GLenum)GLPLATFORM_GL_LOAD(5, i), (const void *)GLPLATFORM_GL_LOAD(6, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glClearNamedFramebufferfi, (GLuint a0, GLenum a1, GLint a2, GLfloat a3, GLint a4), (a0, a1, a2, a3, a4), "viiifi", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, f, a3), GLPLATFORM_GL_STORE(4, i, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLfloat)GLPLATFORM_GL_LOAD(3, f), (GLint)GLPLATFORM_GL_LOAD(4, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glClearNamedFramebufferfv, (GLuint a0, GLenum a1, GLint a2, const GLfloat * a3), (a0, a1, a2, a3), "viii4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (const GLfloat *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glClearNamedFramebufferiv, (GLuint a0, GLenum a1, GLint a2, const GLint * a3), (a0, a1, a2, a3), "viii4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (const GLint *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glClearNamedFramebufferuiv, (GLuint a0, GLenum a1, GLint a2, const GLuint * a3), (a0, a1, a2, a3), "viii4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (const GLuint *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glClearStencil, (GLint a0), (a0), "vi", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLint)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glClearTexImage, (GLuint a0, GLint a1, GLenum a2, GLenum a3, const void * a4), (a0, a1, a2, a3, a4), "viiiip", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, p, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLenum)GLPLATFORM_GL_LOAD(3, i), (const void *)GLPLATFORM_GL_LOAD(4, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glClearTexSubImage, (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLenum a9, const void * a10), (a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10), "viiiiinnniip", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, i, a6), GLPLATFORM_GL_STORE(7, i, a7), GLPLATFORM_GL_STORE(8, i, a8), GLPLATFORM_GL_STORE(9, i, a9), GLPLATFORM_GL_STORE(10, p, a10)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLint)GLPLATFORM_GL_LOAD(3, i), (GLint)GLPLATFORM_GL_LOAD(4, i), (GLsizei)GLPLATFORM_GL_LOAD(5, i), (GLsizei)GLPLATFORM_GL_LOAD(6, i), (GLsizei)GLPLATFORM_GL_LOAD(7, i), (GLenum)GLPLATFORM_GL_LOAD(8, i), (GLenum)GLPLATFORM_GL_LOAD(9, i), (const void *)GLPLATFORM_GL_LOAD(10, p)))
+GLPLATFORM_GL_SIGNATURE(GLenum, glClientWaitSync, (GLsync a0, GLbitfield a1, GLuint64 a2), (a0, a1, a2), "isil", (GLPLATFORM_GL_STORE(0, s, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, l, a2)), ((GLsync)GLPLATFORM_GL_LOAD(0, s), (GLbitfield)GLPLATFORM_GL_LOAD(1, i), (GLuint64)GLPLATFORM_GL_LOAD(2, l)))
+GLPLATFORM_GL_VOID_SIGNATURE(glClipControl, (GLenum a0, GLenum a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glColorMask, (GLboolean a0, GLboolean a1, GLboolean a2, GLboolean a3), (a0, a1, a2, a3), "viiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLboolean)GLPLATFORM_GL_LOAD(0, i), (GLboolean)GLPLATFORM_GL_LOAD(1, i), (GLboolean)GLPLATFORM_GL_LOAD(2, i), (GLboolean)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glColorMaski, (GLuint a0, GLboolean a1, GLboolean a2, GLboolean a3, GLboolean a4), (a0, a1, a2, a3, a4), "viiiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLboolean)GLPLATFORM_GL_LOAD(1, i), (GLboolean)GLPLATFORM_GL_LOAD(2, i), (GLboolean)GLPLATFORM_GL_LOAD(3, i), (GLboolean)GLPLATFORM_GL_LOAD(4, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glCompileShader, (GLuint a0), (a0), "vi", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLuint)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glCompileShaderIncludeARB, (GLuint a0, GLsizei a1, const GLchar *const* a2, const GLint * a3), (a0, a1, a2, a3), "vinC4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (const GLchar *const*)GLPLATFORM_GL_LOAD(2, p), (const GLint *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glCompressedTexImage1D, (GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLint a4, GLsizei a5, const void * a6), (a0, a1, a2, a3, a4, a5, a6), "viiininp", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, p, a6)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (GLint)GLPLATFORM_GL_LOAD(4, i), (GLsizei)GLPLATFORM_GL_LOAD(5, i), (const void *)GLPLATFORM_GL_LOAD(6, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glCompressedTexImage2D, (GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLsizei a4, GLint a5, GLsizei a6, const void * a7), (a0, a1, a2, a3, a4, a5, a6, a7), "viiinninp", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, i, a6), GLPLATFORM_GL_STORE(7, p, a7)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (GLsizei)GLPLATFORM_GL_LOAD(4, i), (GLint)GLPLATFORM_GL_LOAD(5, i), (GLsizei)GLPLATFORM_GL_LOAD(6, i), (const void *)GLPLATFORM_GL_LOAD(7, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glCompressedTexImage3D, (GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLint a6, GLsizei a7, const void * a8), (a0, a1, a2, a3, a4, a5, a6, a7, a8), "viiinnninp", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, i, a6), GLPLATFORM_GL_STORE(7, i, a7), GLPLATFORM_GL_STORE(8, p, a8)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (GLsizei)GLPLATFORM_GL_LOAD(4, i), (GLsizei)GLPLATFORM_GL_LOAD(5, i), (GLint)GLPLATFORM_GL_LOAD(6, i), (GLsizei)GLPLATFORM_GL_LOAD(7, i), (const void *)GLPLATFORM_GL_LOAD(8, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glCompressedTexSubImage1D, (GLenum a0, GLint a1, GLint a2, GLsizei a3, GLenum a4, GLsizei a5, const void * a6), (a0, a1, a2, a3, a4, a5, a6), "viiininp", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, p, a6)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (GLenum)GLPLATFORM_GL_LOAD(4, i), (GLsizei)GLPLATFORM_GL_LOAD(5, i), (const void *)GLPLATFORM_GL_LOAD(6, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glCompressedTexSubImage2D, (GLenum a0, GLint a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5, GLenum a6, GLsizei a7, const void * a8), (a0, a1, a2, a3, a4, a5, a6, a7, a8), "viiiinninp", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, i, a6), GLPLATFORM_GL_STORE(7, i, a7), GLPLATFORM_GL_STORE(8, p, a8)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLint)GLPLATFORM_GL_LOAD(3, i), (GLsizei)GLPLATFORM_GL_LOAD(4, i), (GLsizei)GLPLATFORM_GL_LOAD(5, i), (GLenum)GLPLATFORM_GL_LOAD(6, i), (GLsizei)GLPLATFORM_GL_LOAD(7, i), (const void *)GLPLATFORM_GL_LOAD(8, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glCompressedTexSubImage3D, (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLsizei a9, const void * a10), (a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10), "viiiiinnninp", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, i, a6), GLPLATFORM_GL_STORE(7, i, a7), GLPLATFORM_GL_STORE(8, i, a8), GLPLATFORM_GL_STORE(9, i, a9), GLPLATFORM_GL_STORE(10, p, a10)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLint)GLPLATFORM_GL_LOAD(3, i), (GLint)GLPLATFORM_GL_LOAD(4, i), (GLsizei)GLPLATFORM_GL_LOAD(5, i), (GLsizei)GLPLATFORM_GL_LOAD(6, i), (GLsizei)GLPLATFORM_GL_LOAD(7, i), (GLenum)GLPLATFORM_GL_LOAD(8, i), (GLsizei)GLPLATFORM_GL_LOAD(9, i), (const void *)GLPLATFORM_GL_LOAD(10, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glCompressedTextureSubImage1D, (GLuint a0, GLint a1, GLint a2, GLsizei a3, GLenum a4, GLsizei a5, const void * a6), (a0, a1, a2, a3, a4, a5, a6), "viiininp", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, p, a6)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (GLenum)GLPLATFORM_GL_LOAD(4, i), (GLsizei)GLPLATFORM_GL_LOAD(5, i), (const void *)GLPLATFORM_GL_LOAD(6, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glCompressedTextureSubImage2D, (GLuint a0, GLint a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5, GLenum a6, GLsizei a7, const void * a8), (a0, a1, a2, a3, a4, a5, a6, a7, a8), "viiiinninp", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, i, a6), GLPLATFORM_GL_STORE(7, i, a7), GLPLATFORM_GL_STORE(8, p, a8)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLint)GLPLATFORM_GL_LOAD(3, i), (GLsizei)GLPLATFORM_GL_LOAD(4, i), (GLsizei)GLPLATFORM_GL_LOAD(5, i), (GLenum)GLPLATFORM_GL_LOAD(6, i), (GLsizei)GLPLATFORM_GL_LOAD(7, i), (const void *)GLPLATFORM_GL_LOAD(8, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glCompressedTextureSubImage3D, (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLsizei a9, const void * a10), (a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10), "viiiiinnninp", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, i, a6), GLPLATFORM_GL_STORE(7, i, a7), GLPLATFORM_GL_STORE(8, i, a8), GLPLATFORM_GL_STORE(9, i, a9), GLPLATFORM_GL_STORE(10, p, a10)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLint)GLPLATFORM_GL_LOAD(3, i), (GLint)GLPLATFORM_GL_LOAD(4, i), (GLsizei)GLPLATFORM_GL_LOAD(5, i), (GLsizei)GLPLATFORM_GL_LOAD(6, i), (GLsizei)GLPLATFORM_GL_LOAD(7, i), (GLenum)GLPLATFORM_GL_LOAD(8, i), (GLsizei)GLPLATFORM_GL_LOAD(9, i), (const void *)GLPLATFORM_GL_LOAD(10, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glCopyBufferSubData, (GLenum a0, GLenum a1, GLintptr a2, GLintptr a3, GLsizeiptr a4), (a0, a1, a2, a3, a4), "viilll", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, l, a2), GLPLATFORM_GL_STORE(3, l, a3), GLPLATFORM_GL_STORE(4, l, a4)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLintptr)GLPLATFORM_GL_LOAD(2, l), (GLintptr)GLPLATFORM_GL_LOAD(3, l), (GLsizeiptr)GLPLATFORM_GL_LOAD(4, l)))
+GLPLATFORM_GL_VOID_SIGNATURE(glCopyImageSubData, (GLuint a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLint a5, GLuint a6, GLenum a7, GLint a8, GLint a9, GLint a10, GLint a11, GLsizei a12, GLsizei a13, GLsizei a14), (a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14), "viiiiiiiiiiiinnn", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, i, a6), GLPLATFORM_GL_STORE(7, i, a7), GLPLATFORM_GL_STORE(8, i, a8), GLPLATFORM_GL_STORE(9, i, a9), GLPLATFORM_GL_STORE(10, i, a10), GLPLATFORM_GL_STORE(11, i, a11), GLPLATFORM_GL_STORE(12, i, a12), GLPLATFORM_GL_STORE(13, i, a13), GLPLATFORM_GL_STORE(14, i, a14)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLint)GLPLATFORM_GL_LOAD(3, i), (GLint)GLPLATFORM_GL_LOAD(4, i), (GLint)GLPLATFORM_GL_LOAD(5, i), (GLuint)GLPLATFORM_GL_LOAD(6, i), (GLenum)GLPLATFORM_GL_LOAD(7, i), (GLint)GLPLATFORM_GL_LOAD(8, i), (GLint)GLPLATFORM_GL_LOAD(9, i), (GLint)GLPLATFORM_GL_LOAD(10, i), (GLint)GLPLATFORM_GL_LOAD(11, i), (GLsizei)GLPLATFORM_GL_LOAD(12, i), (GLsizei)GLPLATFORM_GL_LOAD(13, i), (GLsizei)GLPLATFORM_GL_LOAD(14, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glCopyNamedBufferSubData, (GLuint a0, GLuint a1, GLintptr a2, GLintptr a3, GLsizeiptr a4), (a0, a1, a2, a3, a4), "viilll", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, l, a2), GLPLATFORM_GL_STORE(3, l, a3), GLPLATFORM_GL_STORE(4, l, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLintptr)GLPLATFORM_GL_LOAD(2, l), (GLintptr)GLPLATFORM_GL_LOAD(3, l), (GLsizeiptr)GLPLATFORM_GL_LOAD(4, l)))
+GLPLATFORM_GL_VOID_SIGNATURE(glCopyTexImage1D, (GLenum a0, GLint a1, GLenum a2, GLint a3, GLint a4, GLsizei a5, GLint a6), (a0, a1, a2, a3, a4, a5, a6), "viiiiini", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, i, a6)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLint)GLPLATFORM_GL_LOAD(3, i), (GLint)GLPLATFORM_GL_LOAD(4, i), (GLsizei)GLPLATFORM_GL_LOAD(5, i), (GLint)GLPLATFORM_GL_LOAD(6, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glCopyTexImage2D, (GLenum a0, GLint a1, GLenum a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLint a7), (a0, a1, a2, a3, a4, a5, a6, a7), "viiiiinni", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, i, a6), GLPLATFORM_GL_STORE(7, i, a7)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLint)GLPLATFORM_GL_LOAD(3, i), (GLint)GLPLATFORM_GL_LOAD(4, i), (GLsizei)GLPLATFORM_GL_LOAD(5, i), (GLsizei)GLPLATFORM_GL_LOAD(6, i), (GLint)GLPLATFORM_GL_LOAD(7, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glCopyTexSubImage1D, (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5), (a0, a1, a2, a3, a4, a5), "viiiiin", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLint)GLPLATFORM_GL_LOAD(3, i), (GLint)GLPLATFORM_GL_LOAD(4, i), (GLsizei)GLPLATFORM_GL_LOAD(5, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glCopyTexSubImage2D, (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLsizei a6, GLsizei a7), (a0, a1, a2, a3, a4, a5, a6, a7), "viiiiiinn", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, i, a6), GLPLATFORM_GL_STORE(7, i, a7)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLint)GLPLATFORM_GL_LOAD(3, i), (GLint)GLPLATFORM_GL_LOAD(4, i), (GLint)GLPLATFORM_GL_LOAD(5, i), (GLsizei)GLPLATFORM_GL_LOAD(6, i), (GLsizei)GLPLATFORM_GL_LOAD(7, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glCopyTexSubImage3D, (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLsizei a7, GLsizei a8), (a0, a1, a2, a3, a4, a5, a6, a7, a8), "viiiiiiinn", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, i, a6), GLPLATFORM_GL_STORE(7, i, a7), GLPLATFORM_GL_STORE(8, i, a8)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLint)GLPLATFORM_GL_LOAD(3, i), (GLint)GLPLATFORM_GL_LOAD(4, i), (GLint)GLPLATFORM_GL_LOAD(5, i), (GLint)GLPLATFORM_GL_LOAD(6, i), (GLsizei)GLPLATFORM_GL_LOAD(7, i), (GLsizei)GLPLATFORM_GL_LOAD(8, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glCopyTextureSubImage1D, (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5), (a0, a1, a2, a3, a4, a5), "viiiiin", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLint)GLPLATFORM_GL_LOAD(3, i), (GLint)GLPLATFORM_GL_LOAD(4, i), (GLsizei)GLPLATFORM_GL_LOAD(5, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glCopyTextureSubImage2D, (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLsizei a6, GLsizei a7), (a0, a1, a2, a3, a4, a5, a6, a7), "viiiiiinn", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, i, a6), GLPLATFORM_GL_STORE(7, i, a7)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLint)GLPLATFORM_GL_LOAD(3, i), (GLint)GLPLATFORM_GL_LOAD(4, i), (GLint)GLPLATFORM_GL_LOAD(5, i), (GLsizei)GLPLATFORM_GL_LOAD(6, i), (GLsizei)GLPLATFORM_GL_LOAD(7, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glCopyTextureSubImage3D, (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLsizei a7, GLsizei a8), (a0, a1, a2, a3, a4, a5, a6, a7, a8), "viiiiiiinn", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, i, a6), GLPLATFORM_GL_STORE(7, i, a7), GLPLATFORM_GL_STORE(8, i, a8)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLint)GLPLATFORM_GL_LOAD(3, i), (GLint)GLPLATFORM_GL_LOAD(4, i), (GLint)GLPLATFORM_GL_LOAD(5, i), (GLint)GLPLATFORM_GL_LOAD(6, i), (GLsizei)GLPLATFORM_GL_LOAD(7, i), (GLsizei)GLPLATFORM_GL_LOAD(8, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glCreateBuffers, (GLsizei a0, GLuint * a1), (a0, a1), "vno", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, o, a1)), ((GLsizei)GLPLATFORM_GL_LOAD(0, i), (GLuint *)GLPLATFORM_GL_LOAD(1, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glCreateFramebuffers, (GLsizei a0, GLuint * a1), (a0, a1), "vno", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, o, a1)), ((GLsizei)GLPLATFORM_GL_LOAD(0, i), (GLuint *)GLPLATFORM_GL_LOAD(1, o)))
+GLPLATFORM_GL_SIGNATURE(GLuint, glCreateProgram, (void), (), "i", ((void)0), ())
+GLPLATFORM_GL_VOID_SIGNATURE(glCreateProgramPipelines, (GLsizei a0, GLuint * a1), (a0, a1), "vno", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, o, a1)), ((GLsizei)GLPLATFORM_GL_LOAD(0, i), (GLuint *)GLPLATFORM_GL_LOAD(1, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glCreateQueries, (GLenum a0, GLsizei a1, GLuint * a2), (a0, a1, a2), "vino", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLuint *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glCreateRenderbuffers, (GLsizei a0, GLuint * a1), (a0, a1), "vno", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, o, a1)), ((GLsizei)GLPLATFORM_GL_LOAD(0, i), (GLuint *)GLPLATFORM_GL_LOAD(1, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glCreateSamplers, (GLsizei a0, GLuint * a1), (a0, a1), "vno", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, o, a1)), ((GLsizei)GLPLATFORM_GL_LOAD(0, i), (GLuint *)GLPLATFORM_GL_LOAD(1, o)))
+GLPLATFORM_GL_SIGNATURE(GLuint, glCreateShader, (GLenum a0), (a0), "ii", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLenum)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_SIGNATURE(GLuint, glCreateShaderProgramv, (GLenum a0, GLsizei a1, const GLchar *const* a2), (a0, a1, a2), "iinC", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (const GLchar *const*)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_SIGNATURE(GLsync, glCreateSyncFromCLeventARB, (struct _cl_context * a0, struct _cl_event * a1, GLbitfield a2), (a0, a1, a2), "sxxi", (GLPLATFORM_GL_STORE(0, x, a0), GLPLATFORM_GL_STORE(1, x, a1), GLPLATFORM_GL_STORE(2, i, a2)), ((struct _cl_context *)GLPLATFORM_GL_LOAD(0, x), (struct _cl_event *)GLPLATFORM_GL_LOAD(1, x), (GLbitfield)GLPLATFORM_GL_LOAD(2, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glCreateTextures, (GLenum a0, GLsizei a1, GLuint * a2), (a0, a1, a2), "vino", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLuint *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glCreateTransformFeedbacks, (GLsizei a0, GLuint * a1), (a0, a1), "vno", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, o, a1)), ((GLsizei)GLPLATFORM_GL_LOAD(0, i), (GLuint *)GLPLATFORM_GL_LOAD(1, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glCreateVertexArrays, (GLsizei a0, GLuint * a1), (a0, a1), "vno", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, o, a1)), ((GLsizei)GLPLATFORM_GL_LOAD(0, i), (GLuint *)GLPLATFORM_GL_LOAD(1, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glCullFace, (GLenum a0), (a0), "vi", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLenum)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDebugMessageCallback, (GLDEBUGPROC a0, const void * a1), (a0, a1), "vxp", (GLPLATFORM_GL_STORE(0, x, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLDEBUGPROC)GLPLATFORM_GL_LOAD(0, x), (const void *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDebugMessageCallbackARB, (GLDEBUGPROCARB a0, const void * a1), (a0, a1), "vxp", (GLPLATFORM_GL_STORE(0, x, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLDEBUGPROCARB)GLPLATFORM_GL_LOAD(0, x), (const void *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDebugMessageCallbackKHR, (GLDEBUGPROCKHR a0, const void * a1), (a0, a1), "vxp", (GLPLATFORM_GL_STORE(0, x, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLDEBUGPROCKHR)GLPLATFORM_GL_LOAD(0, x), (const void *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDebugMessageControl, (GLenum a0, GLenum a1, GLenum a2, GLsizei a3, const GLuint * a4, GLboolean a5), (a0, a1, a2, a3, a4, a5), "viiin4i", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, p, a4), GLPLATFORM_GL_STORE(5, i, a5)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (const GLuint *)GLPLATFORM_GL_LOAD(4, p), (GLboolean)GLPLATFORM_GL_LOAD(5, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDebugMessageControlARB, (GLenum a0, GLenum a1, GLenum a2, GLsizei a3, const GLuint * a4, GLboolean a5), (a0, a1, a2, a3, a4, a5), "viiin4i", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, p, a4), GLPLATFORM_GL_STORE(5, i, a5)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (const GLuint *)GLPLATFORM_GL_LOAD(4, p), (GLboolean)GLPLATFORM_GL_LOAD(5, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDebugMessageControlKHR, (GLenum a0, GLenum a1, GLenum a2, GLsizei a3, const GLuint * a4, GLboolean a5), (a0, a1, a2, a3, a4, a5), "viiin4i", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, p, a4), GLPLATFORM_GL_STORE(5, i, a5)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (const GLuint *)GLPLATFORM_GL_LOAD(4, p), (GLboolean)GLPLATFORM_GL_LOAD(5, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDebugMessageInsert, (GLenum a0, GLenum a1, GLuint a2, GLenum a3, GLsizei a4, const GLchar * a5), (a0, a1, a2, a3, a4, a5), "viiiinS", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, p, a5)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i), (GLenum)GLPLATFORM_GL_LOAD(3, i), (GLsizei)GLPLATFORM_GL_LOAD(4, i), (const GLchar *)GLPLATFORM_GL_LOAD(5, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDebugMessageInsertARB, (GLenum a0, GLenum a1, GLuint a2, GLenum a3, GLsizei a4, const GLchar * a5), (a0, a1, a2, a3, a4, a5), "viiiinS", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, p, a5)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i), (GLenum)GLPLATFORM_GL_LOAD(3, i), (GLsizei)GLPLATFORM_GL_LOAD(4, i), (const GLchar *)GLPLATFORM_GL_LOAD(5, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDebugMessageInsertKHR, (GLenum a0, GLenum a1, GLuint a2, GLenum a3, GLsizei a4, const GLchar * a5), (a0, a1, a2, a3, a4, a5), "viiiinS", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, p, a5)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i), (GLenum)GLPLATFORM_GL_LOAD(3, i), (GLsizei)GLPLATFORM_GL_LOAD(4, i), (const GLchar *)GLPLATFORM_GL_LOAD(5, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDeleteBuffers, (GLsizei a0, const GLuint * a1), (a0, a1), "vn4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLsizei)GLPLATFORM_GL_LOAD(0, i), (const GLuint *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDeleteFramebuffers, (GLsizei a0, const GLuint * a1), (a0, a1), "vn4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLsizei)GLPLATFORM_GL_LOAD(0, i), (const GLuint *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDeleteNamedStringARB, (GLint a0, const GLchar * a1), (a0, a1), "viS", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (const GLchar *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDeleteProgram, (GLuint a0), (a0), "vi", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLuint)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDeleteProgramPipelines, (GLsizei a0, const GLuint * a1), (a0, a1), "vn4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLsizei)GLPLATFORM_GL_LOAD(0, i), (const GLuint *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDeleteQueries, (GLsizei a0, const GLuint * a1), (a0, a1), "vn4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLsizei)GLPLATFORM_GL_LOAD(0, i), (const GLuint *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDeleteRenderbuffers, (GLsizei a0, const GLuint * a1), (a0, a1), "vn4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLsizei)GLPLATFORM_GL_LOAD(0, i), (const GLuint *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDeleteSamplers, (GLsizei a0, const GLuint * a1), (a0, a1), "vn4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLsizei)GLPLATFORM_GL_LOAD(0, i), (const GLuint *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDeleteShader, (GLuint a0), (a0), "vi", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLuint)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDeleteSync, (GLsync a0), (a0), "vs", (GLPLATFORM_GL_STORE(0, s, a0)), ((GLsync)GLPLATFORM_GL_LOAD(0, s)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDeleteTextures, (GLsizei a0, const GLuint * a1), (a0, a1), "vn4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLsizei)GLPLATFORM_GL_LOAD(0, i), (const GLuint *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDeleteTransformFeedbacks, (GLsizei a0, const GLuint * a1), (a0, a1), "vn4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLsizei)GLPLATFORM_GL_LOAD(0, i), (const GLuint *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDeleteVertexArrays, (GLsizei a0, const GLuint * a1), (a0, a1), "vn4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLsizei)GLPLATFORM_GL_LOAD(0, i), (const GLuint *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDepthFunc, (GLenum a0), (a0), "vi", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLenum)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDepthMask, (GLboolean a0), (a0), "vi", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLboolean)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDepthRange, (GLdouble a0, GLdouble a1), (a0, a1), "vdd", (GLPLATFORM_GL_STORE(0, d, a0), GLPLATFORM_GL_STORE(1, d, a1)), ((GLdouble)GLPLATFORM_GL_LOAD(0, d), (GLdouble)GLPLATFORM_GL_LOAD(1, d)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDepthRangeArrayv, (GLuint a0, GLsizei a1, const GLdouble * a2), (a0, a1, a2), "vin8", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (const GLdouble *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDepthRangeIndexed, (GLuint a0, GLdouble a1, GLdouble a2), (a0, a1, a2), "vidd", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, d, a1), GLPLATFORM_GL_STORE(2, d, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLdouble)GLPLATFORM_GL_LOAD(1, d), (GLdouble)GLPLATFORM_GL_LOAD(2, d)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDepthRangef, (GLfloat a0, GLfloat a1), (a0, a1), "vff", (GLPLATFORM_GL_STORE(0, f, a0), GLPLATFORM_GL_STORE(1, f, a1)), ((GLfloat)GLPLATFORM_GL_LOAD(0, f), (GLfloat)GLPLATFORM_GL_LOAD(1, f)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDetachShader, (GLuint a0, GLuint a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDisable, (GLenum a0), (a0), "vi", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLenum)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDisableVertexArrayAttrib, (GLuint a0, GLuint a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDisableVertexAttribArray, (GLuint a0), (a0), "vi", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLuint)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDisablei, (GLenum a0, GLuint a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDispatchCompute, (GLuint a0, GLuint a1, GLuint a2), (a0, a1, a2), "viii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDispatchComputeGroupSizeARB, (GLuint a0, GLuint a1, GLuint a2, GLuint a3, GLuint a4, GLuint a5), (a0, a1, a2, a3, a4, a5), "viiiiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i), (GLuint)GLPLATFORM_GL_LOAD(3, i), (GLuint)GLPLATFORM_GL_LOAD(4, i), (GLuint)GLPLATFORM_GL_LOAD(5, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDispatchComputeIndirect, (GLintptr a0), (a0), "vl", (GLPLATFORM_GL_STORE(0, l, a0)), ((GLintptr)GLPLATFORM_GL_LOAD(0, l)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDrawArrays, (GLenum a0, GLint a1, GLsizei a2), (a0, a1, a2), "viin", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDrawArraysIndirect, (GLenum a0, const void * a1), (a0, a1), "vip", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (const void *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDrawArraysInstanced, (GLenum a0, GLint a1, GLsizei a2, GLsizei a3), (a0, a1, a2, a3), "viinn", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDrawArraysInstancedBaseInstance, (GLenum a0, GLint a1, GLsizei a2, GLsizei a3, GLuint a4), (a0, a1, a2, a3, a4), "viinni", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (GLuint)GLPLATFORM_GL_LOAD(4, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDrawBuffer, (GLenum a0), (a0), "vi", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLenum)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDrawBuffers, (GLsizei a0, const GLenum * a1), (a0, a1), "vn4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLsizei)GLPLATFORM_GL_LOAD(0, i), (const GLenum *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDrawElements, (GLenum a0, GLsizei a1, GLenum a2, const void * a3), (a0, a1, a2, a3), "vinip", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (const void *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDrawElementsBaseVertex, (GLenum a0, GLsizei a1, GLenum a2, const void * a3, GLint a4), (a0, a1, a2, a3, a4), "vinipi", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3), GLPLATFORM_GL_STORE(4, i, a4)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (const void *)GLPLATFORM_GL_LOAD(3, p), (GLint)GLPLATFORM_GL_LOAD(4, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDrawElementsIndirect, (GLenum a0, GLenum a1, const void * a2), (a0, a1, a2), "viip", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (const void *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDrawElementsInstanced, (GLenum a0, GLsizei a1, GLenum a2, const void * a3, GLsizei a4), (a0, a1, a2, a3, a4), "vinipn", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3), GLPLATFORM_GL_STORE(4, i, a4)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (const void *)GLPLATFORM_GL_LOAD(3, p), (GLsizei)GLPLATFORM_GL_LOAD(4, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDrawElementsInstancedBaseInstance, (GLenum a0, GLsizei a1, GLenum a2, const void * a3, GLsizei a4, GLuint a5), (a0, a1, a2, a3, a4, a5), "vinipni", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (const void *)GLPLATFORM_GL_LOAD(3, p), (GLsizei)GLPLATFORM_GL_LOAD(4, i), (GLuint)GLPLATFORM_GL_LOAD(5, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDrawElementsInstancedBaseVertex, (GLenum a0, GLsizei a1, GLenum a2, const void * a3, GLsizei a4, GLint a5), (a0, a1, a2, a3, a4, a5), "vinipni", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (const void *)GLPLATFORM_GL_LOAD(3, p), (GLsizei)GLPLATFORM_GL_LOAD(4, i), (GLint)GLPLATFORM_GL_LOAD(5, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDrawElementsInstancedBaseVertexBaseInstance, (GLenum a0, GLsizei a1, GLenum a2, const void * a3, GLsizei a4, GLint a5, GLuint a6), (a0, a1, a2, a3, a4, a5, a6), "vinipnii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, i, a6)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (const void *)GLPLATFORM_GL_LOAD(3, p), (GLsizei)GLPLATFORM_GL_LOAD(4, i), (GLint)GLPLATFORM_GL_LOAD(5, i), (GLuint)GLPLATFORM_GL_LOAD(6, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDrawRangeElements, (GLenum a0, GLuint a1, GLuint a2, GLsizei a3, GLenum a4, const void * a5), (a0, a1, a2, a3, a4, a5), "viiinip", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, p, a5)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (GLenum)GLPLATFORM_GL_LOAD(4, i), (const void *)GLPLATFORM_GL_LOAD(5, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDrawRangeElementsBaseVertex, (GLenum a0, GLuint a1, GLuint a2, GLsizei a3, GLenum a4, const void * a5, GLint a6), (a0, a1, a2, a3, a4, a5, a6), "viiinipi", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, p, a5), GLPLATFORM_GL_STORE(6, i, a6)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (GLenum)GLPLATFORM_GL_LOAD(4, i), (const void *)GLPLATFORM_GL_LOAD(5, p), (GLint)GLPLATFORM_GL_LOAD(6, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDrawTransformFeedback, (GLenum a0, GLuint a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDrawTransformFeedbackInstanced, (GLenum a0, GLuint a1, GLsizei a2), (a0, a1, a2), "viin", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDrawTransformFeedbackStream, (GLenum a0, GLuint a1, GLuint a2), (a0, a1, a2), "viii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glDrawTransformFeedbackStreamInstanced, (GLenum a0, GLuint a1, GLuint a2, GLsizei a3), (a0, a1, a2, a3), "viiin", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glEnable, (GLenum a0), (a0), "vi", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLenum)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glEnableVertexArrayAttrib, (GLuint a0, GLuint a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glEnableVertexAttribArray, (GLuint a0), (a0), "vi", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLuint)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glEnablei, (GLenum a0, GLuint a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glEndConditionalRender, (void), (), "v", ((void)0), ())
+GLPLATFORM_GL_VOID_SIGNATURE(glEndQuery, (GLenum a0), (a0), "vi", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLenum)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glEndQueryIndexed, (GLenum a0, GLuint a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glEndTransformFeedback, (void), (), "v", ((void)0), ())
+GLPLATFORM_GL_SIGNATURE(GLsync, glFenceSync, (GLenum a0, GLbitfield a1), (a0, a1), "sii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLbitfield)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glFinish, (void), (), "v", ((void)0), ())
+GLPLATFORM_GL_VOID_SIGNATURE(glFlush, (void), (), "v", ((void)0), ())
+GLPLATFORM_GL_VOID_SIGNATURE(glFlushMappedBufferRange, (GLenum a0, GLintptr a1, GLsizeiptr a2), (a0, a1, a2), "vill", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, l, a1), GLPLATFORM_GL_STORE(2, l, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLintptr)GLPLATFORM_GL_LOAD(1, l), (GLsizeiptr)GLPLATFORM_GL_LOAD(2, l)))
+GLPLATFORM_GL_VOID_SIGNATURE(glFlushMappedNamedBufferRange, (GLuint a0, GLintptr a1, GLsizeiptr a2), (a0, a1, a2), "vill", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, l, a1), GLPLATFORM_GL_STORE(2, l, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLintptr)GLPLATFORM_GL_LOAD(1, l), (GLsizeiptr)GLPLATFORM_GL_LOAD(2, l)))
+GLPLATFORM_GL_VOID_SIGNATURE(glFramebufferParameteri, (GLenum a0, GLenum a1, GLint a2), (a0, a1, a2), "viii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glFramebufferRenderbuffer, (GLenum a0, GLenum a1, GLenum a2, GLuint a3), (a0, a1, a2, a3), "viiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLuint)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glFramebufferTexture, (GLenum a0, GLenum a1, GLuint a2, GLint a3), (a0, a1, a2, a3), "viiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i), (GLint)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glFramebufferTexture1D, (GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4), (a0, a1, a2, a3, a4), "viiiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLuint)GLPLATFORM_GL_LOAD(3, i), (GLint)GLPLATFORM_GL_LOAD(4, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glFramebufferTexture2D, (GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4), (a0, a1, a2, a3, a4), "viiiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLuint)GLPLATFORM_GL_LOAD(3, i), (GLint)GLPLATFORM_GL_LOAD(4, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glFramebufferTexture3D, (GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4, GLint a5), (a0, a1, a2, a3, a4, a5), "viiiiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLuint)GLPLATFORM_GL_LOAD(3, i), (GLint)GLPLATFORM_GL_LOAD(4, i), (GLint)GLPLATFORM_GL_LOAD(5, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glFramebufferTextureLayer, (GLenum a0, GLenum a1, GLuint a2, GLint a3, GLint a4), (a0, a1, a2, a3, a4), "viiiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i), (GLint)GLPLATFORM_GL_LOAD(3, i), (GLint)GLPLATFORM_GL_LOAD(4, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glFrontFace, (GLenum a0), (a0), "vi", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLenum)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGenBuffers, (GLsizei a0, GLuint * a1), (a0, a1), "vno", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, o, a1)), ((GLsizei)GLPLATFORM_GL_LOAD(0, i), (GLuint *)GLPLATFORM_GL_LOAD(1, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGenFramebuffers, (GLsizei a0, GLuint * a1), (a0, a1), "vno", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, o, a1)), ((GLsizei)GLPLATFORM_GL_LOAD(0, i), (GLuint *)GLPLATFORM_GL_LOAD(1, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGenProgramPipelines, (GLsizei a0, GLuint * a1), (a0, a1), "vno", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, o, a1)), ((GLsizei)GLPLATFORM_GL_LOAD(0, i), (GLuint *)GLPLATFORM_GL_LOAD(1, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGenQueries, (GLsizei a0, GLuint * a1), (a0, a1), "vno", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, o, a1)), ((GLsizei)GLPLATFORM_GL_LOAD(0, i), (GLuint *)GLPLATFORM_GL_LOAD(1, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGenRenderbuffers, (GLsizei a0, GLuint * a1), (a0, a1), "vno", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, o, a1)), ((GLsizei)GLPLATFORM_GL_LOAD(0, i), (GLuint *)GLPLATFORM_GL_LOAD(1, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGenSamplers, (GLsizei a0, GLuint * a1), (a0, a1), "vno", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, o, a1)), ((GLsizei)GLPLATFORM_GL_LOAD(0, i), (GLuint *)GLPLATFORM_GL_LOAD(1, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGenTextures, (GLsizei a0, GLuint * a1), (a0, a1), "vno", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, o, a1)), ((GLsizei)GLPLATFORM_GL_LOAD(0, i), (GLuint *)GLPLATFORM_GL_LOAD(1, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGenTransformFeedbacks, (GLsizei a0, GLuint * a1), (a0, a1), "vno", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, o, a1)), ((GLsizei)GLPLATFORM_GL_LOAD(0, i), (GLuint *)GLPLATFORM_GL_LOAD(1, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGenVertexArrays, (GLsizei a0, GLuint * a1), (a0, a1), "vno", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, o, a1)), ((GLsizei)GLPLATFORM_GL_LOAD(0, i), (GLuint *)GLPLATFORM_GL_LOAD(1, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGenerateMipmap, (GLenum a0), (a0), "vi", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLenum)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGenerateTextureMipmap, (GLuint a0), (a0), "vi", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLuint)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetActiveAtomicCounterBufferiv, (GLuint a0, GLuint a1, GLenum a2, GLint * a3), (a0, a1, a2, a3), "viiio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLint *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetActiveAttrib, (GLuint a0, GLuint a1, GLsizei a2, GLsizei * a3, GLint * a4, GLenum * a5, GLchar * a6), (a0, a1, a2, a3, a4, a5, a6), "viinoooo", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3), GLPLATFORM_GL_STORE(4, o, a4), GLPLATFORM_GL_STORE(5, o, a5), GLPLATFORM_GL_STORE(6, o, a6)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLsizei *)GLPLATFORM_GL_LOAD(3, o), (GLint *)GLPLATFORM_GL_LOAD(4, o), (GLenum *)GLPLATFORM_GL_LOAD(5, o), (GLchar *)GLPLATFORM_GL_LOAD(6, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetActiveSubroutineName, (GLuint a0, GLenum a1, GLuint a2, GLsizei a3, GLsizei * a4, GLchar * a5), (a0, a1, a2, a3, a4, a5), "viiinoo", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, o, a4), GLPLATFORM_GL_STORE(5, o, a5)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (GLsizei *)GLPLATFORM_GL_LOAD(4, o), (GLchar *)GLPLATFORM_GL_LOAD(5, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetActiveSubroutineUniformName, (GLuint a0, GLenum a1, GLuint a2, GLsizei a3, GLsizei * a4, GLchar * a5), (a0, a1, a2, a3, a4, a5), "viiinoo", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, o, a4), GLPLATFORM_GL_STORE(5, o, a5)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (GLsizei *)GLPLATFORM_GL_LOAD(4, o), (GLchar *)GLPLATFORM_GL_LOAD(5, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetActiveSubroutineUniformiv, (GLuint a0, GLenum a1, GLuint a2, GLenum a3, GLint * a4), (a0, a1, a2, a3, a4), "viiiio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, o, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i), (GLenum)GLPLATFORM_GL_LOAD(3, i), (GLint *)GLPLATFORM_GL_LOAD(4, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetActiveUniform, (GLuint a0, GLuint a1, GLsizei a2, GLsizei * a3, GLint * a4, GLenum * a5, GLchar * a6), (a0, a1, a2, a3, a4, a5, a6), "viinoooo", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3), GLPLATFORM_GL_STORE(4, o, a4), GLPLATFORM_GL_STORE(5, o, a5), GLPLATFORM_GL_STORE(6, o, a6)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLsizei *)GLPLATFORM_GL_LOAD(3, o), (GLint *)GLPLATFORM_GL_LOAD(4, o), (GLenum *)GLPLATFORM_GL_LOAD(5, o), (GLchar *)GLPLATFORM_GL_LOAD(6, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetActiveUniformBlockName, (GLuint a0, GLuint a1, GLsizei a2, GLsizei * a3, GLchar * a4), (a0, a1, a2, a3, a4), "viinoo", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3), GLPLATFORM_GL_STORE(4, o, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLsizei *)GLPLATFORM_GL_LOAD(3, o), (GLchar *)GLPLATFORM_GL_LOAD(4, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetActiveUniformBlockiv, (GLuint a0, GLuint a1, GLenum a2, GLint * a3), (a0, a1, a2, a3), "viiio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLint *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetActiveUniformName, (GLuint a0, GLuint a1, GLsizei a2, GLsizei * a3, GLchar * a4), (a0, a1, a2, a3, a4), "viinoo", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3), GLPLATFORM_GL_STORE(4, o, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLsizei *)GLPLATFORM_GL_LOAD(3, o), (GLchar *)GLPLATFORM_GL_LOAD(4, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetActiveUniformsiv, (GLuint a0, GLsizei a1, const GLuint * a2, GLenum a3, GLint * a4), (a0, a1, a2, a3, a4), "vin4io", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, o, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (const GLuint *)GLPLATFORM_GL_LOAD(2, p), (GLenum)GLPLATFORM_GL_LOAD(3, i), (GLint *)GLPLATFORM_GL_LOAD(4, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetAttachedShaders, (GLuint a0, GLsizei a1, GLsizei * a2, GLuint * a3), (a0, a1, a2, a3), "vinoo", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLsizei *)GLPLATFORM_GL_LOAD(2, o), (GLuint *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_SIGNATURE(GLint, glGetAttribLocation, (GLuint a0, const GLchar * a1), (a0, a1), "iiS", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLchar *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetBooleani_v, (GLenum a0, GLuint a1, GLboolean * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLboolean *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetBooleanv, (GLenum a0, GLboolean * a1), (a0, a1), "vio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, o, a1)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLboolean *)GLPLATFORM_GL_LOAD(1, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetBufferParameteri64v, (GLenum a0, GLenum a1, GLint64 * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLint64 *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetBufferParameteriv, (GLenum a0, GLenum a1, GLint * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLint *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetBufferPointerv, (GLenum a0, GLenum a1, void ** a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (void **)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetBufferSubData, (GLenum a0, GLintptr a1, GLsizeiptr a2, void * a3), (a0, a1, a2, a3), "villo", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, l, a1), GLPLATFORM_GL_STORE(2, l, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLintptr)GLPLATFORM_GL_LOAD(1, l), (GLsizeiptr)GLPLATFORM_GL_LOAD(2, l), (void *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetCompressedTexImage, (GLenum a0, GLint a1, void * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (void *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetCompressedTextureImage, (GLuint a0, GLint a1, GLsizei a2, void * a3), (a0, a1, a2, a3), "viino", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (void *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetCompressedTextureSubImage, (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLsizei a8, void * a9), (a0, a1, a2, a3, a4, a5, a6, a7, a8, a9), "viiiiinnnno", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, i, a6), GLPLATFORM_GL_STORE(7, i, a7), GLPLATFORM_GL_STORE(8, i, a8), GLPLATFORM_GL_STORE(9, o, a9)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLint)GLPLATFORM_GL_LOAD(3, i), (GLint)GLPLATFORM_GL_LOAD(4, i), (GLsizei)GLPLATFORM_GL_LOAD(5, i), (GLsizei)GLPLATFORM_GL_LOAD(6, i), (GLsizei)GLPLATFORM_GL_LOAD(7, i), (GLsizei)GLPLATFORM_GL_LOAD(8, i), (void *)GLPLATFORM_GL_LOAD(9, o)))
+GLPLATFORM_GL_SIGNATURE(GLuint, glGetDebugMessageLog, (GLuint a0, GLsizei a1, GLenum * a2, GLenum * a3, GLuint * a4, GLenum * a5, GLsizei * a6, GLchar * a7), (a0, a1, a2, a3, a4, a5, a6, a7), "iinoooooo", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2), GLPLATFORM_GL_STORE(3, o, a3), GLPLATFORM_GL_STORE(4, o, a4), GLPLATFORM_GL_STORE(5, o, a5), GLPLATFORM_GL_STORE(6, o, a6), GLPLATFORM_GL_STORE(7, o, a7)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLenum *)GLPLATFORM_GL_LOAD(2, o), (GLenum *)GLPLATFORM_GL_LOAD(3, o), (GLuint *)GLPLATFORM_GL_LOAD(4, o), (GLenum *)GLPLATFORM_GL_LOAD(5, o), (GLsizei *)GLPLATFORM_GL_LOAD(6, o), (GLchar *)GLPLATFORM_GL_LOAD(7, o)))
+GLPLATFORM_GL_SIGNATURE(GLuint, glGetDebugMessageLogARB, (GLuint a0, GLsizei a1, GLenum * a2, GLenum * a3, GLuint * a4, GLenum * a5, GLsizei * a6, GLchar * a7), (a0, a1, a2, a3, a4, a5, a6, a7), "iinoooooo", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2), GLPLATFORM_GL_STORE(3, o, a3), GLPLATFORM_GL_STORE(4, o, a4), GLPLATFORM_GL_STORE(5, o, a5), GLPLATFORM_GL_STORE(6, o, a6), GLPLATFORM_GL_STORE(7, o, a7)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLenum *)GLPLATFORM_GL_LOAD(2, o), (GLenum *)GLPLATFORM_GL_LOAD(3, o), (GLuint *)GLPLATFORM_GL_LOAD(4, o), (GLenum *)GLPLATFORM_GL_LOAD(5, o), (GLsizei *)GLPLATFORM_GL_LOAD(6, o), (GLchar *)GLPLATFORM_GL_LOAD(7, o)))
+GLPLATFORM_GL_SIGNATURE(GLuint, glGetDebugMessageLogKHR, (GLuint a0, GLsizei a1, GLenum * a2, GLenum * a3, GLuint * a4, GLenum * a5, GLsizei * a6, GLchar * a7), (a0, a1, a2, a3, a4, a5, a6, a7), "iinoooooo", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2), GLPLATFORM_GL_STORE(3, o, a3), GLPLATFORM_GL_STORE(4, o, a4), GLPLATFORM_GL_STORE(5, o, a5), GLPLATFORM_GL_STORE(6, o, a6), GLPLATFORM_GL_STORE(7, o, a7)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLenum *)GLPLATFORM_GL_LOAD(2, o), (GLenum *)GLPLATFORM_GL_LOAD(3, o), (GLuint *)GLPLATFORM_GL_LOAD(4, o), (GLenum *)GLPLATFORM_GL_LOAD(5, o), (GLsizei *)GLPLATFORM_GL_LOAD(6, o), (GLchar *)GLPLATFORM_GL_LOAD(7, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetDoublei_v, (GLenum a0, GLuint a1, GLdouble * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLdouble *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetDoublev, (GLenum a0, GLdouble * a1), (a0, a1), "vio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, o, a1)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLdouble *)GLPLATFORM_GL_LOAD(1, o)))
+GLPLATFORM_GL_SIGNATURE(GLenum, glGetError, (void), (), "i", ((void)0), ())
+GLPLATFORM_GL_VOID_SIGNATURE(glGetFloati_v, (GLenum a0, GLuint a1, GLfloat * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLfloat *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetFloatv, (GLenum a0, GLfloat * a1), (a0, a1), "vio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, o, a1)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLfloat *)GLPLATFORM_GL_LOAD(1, o)))
+GLPLATFORM_GL_SIGNATURE(GLint, glGetFragDataIndex, (GLuint a0, const GLchar * a1), (a0, a1), "iiS", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLchar *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_SIGNATURE(GLint, glGetFragDataLocation, (GLuint a0, const GLchar * a1), (a0, a1), "iiS", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLchar *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetFramebufferAttachmentParameteriv, (GLenum a0, GLenum a1, GLenum a2, GLint * a3), (a0, a1, a2, a3), "viiio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLint *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetFramebufferParameteriv, (GLenum a0, GLenum a1, GLint * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLint *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_SIGNATURE(GLenum, glGetGraphicsResetStatus, (void), (), "i", ((void)0), ())
+GLPLATFORM_GL_SIGNATURE(GLenum, glGetGraphicsResetStatusARB, (void), (), "i", ((void)0), ())
+GLPLATFORM_GL_SIGNATURE(GLenum, glGetGraphicsResetStatusKHR, (void), (), "i", ((void)0), ())
+GLPLATFORM_GL_SIGNATURE(GLuint64, glGetImageHandleARB, (GLuint a0, GLint a1, GLboolean a2, GLint a3, GLenum a4), (a0, a1, a2, a3, a4), "liiiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLboolean)GLPLATFORM_GL_LOAD(2, i), (GLint)GLPLATFORM_GL_LOAD(3, i), (GLenum)GLPLATFORM_GL_LOAD(4, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetInteger64i_v, (GLenum a0, GLuint a1, GLint64 * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLint64 *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetInteger64v, (GLenum a0, GLint64 * a1), (a0, a1), "vio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, o, a1)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint64 *)GLPLATFORM_GL_LOAD(1, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetIntegeri_v, (GLenum a0, GLuint a1, GLint * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLint *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetIntegerv, (GLenum a0, GLint * a1), (a0, a1), "vio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, o, a1)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint *)GLPLATFORM_GL_LOAD(1, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetInternalformati64v, (GLenum a0, GLenum a1, GLenum a2, GLsizei a3, GLint64 * a4), (a0, a1, a2, a3, a4), "viiino", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, o, a4)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (GLint64 *)GLPLATFORM_GL_LOAD(4, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetInternalformativ, (GLenum a0, GLenum a1, GLenum a2, GLsizei a3, GLint * a4), (a0, a1, a2, a3, a4), "viiino", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, o, a4)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (GLint *)GLPLATFORM_GL_LOAD(4, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetMultisamplefv, (GLenum a0, GLuint a1, GLfloat * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLfloat *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetNamedBufferParameteri64v, (GLuint a0, GLenum a1, GLint64 * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLint64 *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetNamedBufferParameteriv, (GLuint a0, GLenum a1, GLint * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLint *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetNamedBufferPointerv, (GLuint a0, GLenum a1, void ** a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (void **)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetNamedBufferSubData, (GLuint a0, GLintptr a1, GLsizeiptr a2, void * a3), (a0, a1, a2, a3), "villo", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, l, a1), GLPLATFORM_GL_STORE(2, l, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLintptr)GLPLATFORM_GL_LOAD(1, l), (GLsizeiptr)GLPLATFORM_GL_LOAD(2, l), (void *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetNamedFramebufferAttachmentParameteriv, (GLuint a0, GLenum a1, GLenum a2, GLint * a3), (a0, a1, a2, a3), "viiio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLint *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetNamedFramebufferParameteriv, (GLuint a0, GLenum a1, GLint * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLint *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetNamedRenderbufferParameteriv, (GLuint a0, GLenum a1, GLint * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLint *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetNamedStringARB, (GLint a0, const GLchar * a1, GLsizei a2, GLint * a3, GLchar * a4), (a0, a1, a2, a3, a4), "viSnoo", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3), GLPLATFORM_GL_STORE(4, o, a4)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (const GLchar *)GLPLATFORM_GL_LOAD(1, p), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLint *)GLPLATFORM_GL_LOAD(3, o), (GLchar *)GLPLATFORM_GL_LOAD(4, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetNamedStringivARB, (GLint a0, const GLchar * a1, GLenum a2, GLint * a3), (a0, a1, a2, a3), "viSio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (const GLchar *)GLPLATFORM_GL_LOAD(1, p), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLint *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetObjectLabel, (GLenum a0, GLuint a1, GLsizei a2, GLsizei * a3, GLchar * a4), (a0, a1, a2, a3, a4), "viinoo", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3), GLPLATFORM_GL_STORE(4, o, a4)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLsizei *)GLPLATFORM_GL_LOAD(3, o), (GLchar *)GLPLATFORM_GL_LOAD(4, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetObjectLabelKHR, (GLenum a0, GLuint a1, GLsizei a2, GLsizei * a3, GLchar * a4), (a0, a1, a2, a3, a4), "viinoo", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3), GLPLATFORM_GL_STORE(4, o, a4)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLsizei *)GLPLATFORM_GL_LOAD(3, o), (GLchar *)GLPLATFORM_GL_LOAD(4, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetObjectPtrLabel, (const void * a0, GLsizei a1, GLsizei * a2, GLchar * a3), (a0, a1, a2, a3), "vpnoo", (GLPLATFORM_GL_STORE(0, p, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((const void *)GLPLATFORM_GL_LOAD(0, p), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLsizei *)GLPLATFORM_GL_LOAD(2, o), (GLchar *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetObjectPtrLabelKHR, (const void * a0, GLsizei a1, GLsizei * a2, GLchar * a3), (a0, a1, a2, a3), "vpnoo", (GLPLATFORM_GL_STORE(0, p, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((const void *)GLPLATFORM_GL_LOAD(0, p), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLsizei *)GLPLATFORM_GL_LOAD(2, o), (GLchar *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetPointerv, (GLenum a0, void ** a1), (a0, a1), "vio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, o, a1)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (void **)GLPLATFORM_GL_LOAD(1, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetPointervKHR, (GLenum a0, void ** a1), (a0, a1), "vio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, o, a1)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (void **)GLPLATFORM_GL_LOAD(1, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetProgramBinary, (GLuint a0, GLsizei a1, GLsizei * a2, GLenum * a3, void * a4), (a0, a1, a2, a3, a4), "vinooo", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2), GLPLATFORM_GL_STORE(3, o, a3), GLPLATFORM_GL_STORE(4, o, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLsizei *)GLPLATFORM_GL_LOAD(2, o), (GLenum *)GLPLATFORM_GL_LOAD(3, o), (void *)GLPLATFORM_GL_LOAD(4, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetProgramInfoLog, (GLuint a0, GLsizei a1, GLsizei * a2, GLchar * a3), (a0, a1, a2, a3), "vinoo", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLsizei *)GLPLATFORM_GL_LOAD(2, o), (GLchar *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetProgramInterfaceiv, (GLuint a0, GLenum a1, GLenum a2, GLint * a3), (a0, a1, a2, a3), "viiio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLint *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetProgramPipelineInfoLog, (GLuint a0, GLsizei a1, GLsizei * a2, GLchar * a3), (a0, a1, a2, a3), "vinoo", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLsizei *)GLPLATFORM_GL_LOAD(2, o), (GLchar *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetProgramPipelineiv, (GLuint a0, GLenum a1, GLint * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLint *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_SIGNATURE(GLuint, glGetProgramResourceIndex, (GLuint a0, GLenum a1, const GLchar * a2), (a0, a1, a2), "iiiS", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (const GLchar *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_SIGNATURE(GLint, glGetProgramResourceLocation, (GLuint a0, GLenum a1, const GLchar * a2), (a0, a1, a2), "iiiS", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (const GLchar *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_SIGNATURE(GLint, glGetProgramResourceLocationIndex, (GLuint a0, GLenum a1, const GLchar * a2), (a0, a1, a2), "iiiS", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (const GLchar *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetProgramResourceName, (GLuint a0, GLenum a1, GLuint a2, GLsizei a3, GLsizei * a4, GLchar * a5), (a0, a1, a2, a3, a4, a5), "viiinoo", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, o, a4), GLPLATFORM_GL_STORE(5, o, a5)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (GLsizei *)GLPLATFORM_GL_LOAD(4, o), (GLchar *)GLPLATFORM_GL_LOAD(5, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetProgramResourceiv, (GLuint a0, GLenum a1, GLuint a2, GLsizei a3, const GLenum * a4, GLsizei a5, GLsizei * a6, GLint * a7), (a0, a1, a2, a3, a4, a5, a6, a7), "viiin4noo", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, p, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, o, a6), GLPLATFORM_GL_STORE(7, o, a7)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (const GLenum *)GLPLATFORM_GL_LOAD(4, p), (GLsizei)GLPLATFORM_GL_LOAD(5, i), (GLsizei *)GLPLATFORM_GL_LOAD(6, o), (GLint *)GLPLATFORM_GL_LOAD(7, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetProgramStageiv, (GLuint a0, GLenum a1, GLenum a2, GLint * a3), (a0, a1, a2, a3), "viiio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLint *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetProgramiv, (GLuint a0, GLenum a1, GLint * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLint *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetQueryBufferObjecti64v, (GLuint a0, GLuint a1, GLenum a2, GLintptr a3), (a0, a1, a2, a3), "viiil", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, l, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLintptr)GLPLATFORM_GL_LOAD(3, l)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetQueryBufferObjectiv, (GLuint a0, GLuint a1, GLenum a2, GLintptr a3), (a0, a1, a2, a3), "viiil", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, l, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLintptr)GLPLATFORM_GL_LOAD(3, l)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetQueryBufferObjectui64v, (GLuint a0, GLuint a1, GLenum a2, GLintptr a3), (a0, a1, a2, a3), "viiil", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, l, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLintptr)GLPLATFORM_GL_LOAD(3, l)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetQueryBufferObjectuiv, (GLuint a0, GLuint a1, GLenum a2, GLintptr a3), (a0, a1, a2, a3), "viiil", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, l, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLintptr)GLPLATFORM_GL_LOAD(3, l)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetQueryIndexediv, (GLenum a0, GLuint a1, GLenum a2, GLint * a3), (a0, a1, a2, a3), "viiio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLint *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetQueryObjecti64v, (GLuint a0, GLenum a1, GLint64 * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLint64 *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetQueryObjectiv, (GLuint a0, GLenum a1, GLint * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLint *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetQueryObjectui64v, (GLuint a0, GLenum a1, GLuint64 * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLuint64 *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetQueryObjectuiv, (GLuint a0, GLenum a1, GLuint * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLuint *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetQueryiv, (GLenum a0, GLenum a1, GLint * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLint *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetRenderbufferParameteriv, (GLenum a0, GLenum a1, GLint * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLint *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetSamplerParameterIiv, (GLuint a0, GLenum a1, GLint * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLint *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetSamplerParameterIuiv, (GLuint a0, GLenum a1, GLuint * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLuint *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetSamplerParameterfv, (GLuint a0, GLenum a1, GLfloat * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLfloat *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetSamplerParameteriv, (GLuint a0, GLenum a1, GLint * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLint *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetShaderInfoLog, (GLuint a0, GLsizei a1, GLsizei * a2, GLchar * a3), (a0, a1, a2, a3), "vinoo", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLsizei *)GLPLATFORM_GL_LOAD(2, o), (GLchar *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetShaderPrecisionFormat, (GLenum a0, GLenum a1, GLint * a2, GLint * a3), (a0, a1, a2, a3), "viioo", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLint *)GLPLATFORM_GL_LOAD(2, o), (GLint *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetShaderSource, (GLuint a0, GLsizei a1, GLsizei * a2, GLchar * a3), (a0, a1, a2, a3), "vinoo", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLsizei *)GLPLATFORM_GL_LOAD(2, o), (GLchar *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetShaderiv, (GLuint a0, GLenum a1, GLint * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLint *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_SIGNATURE(const GLubyte *, glGetString, (GLenum a0), (a0), "pi", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLenum)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_SIGNATURE(const GLubyte *, glGetStringi, (GLenum a0, GLuint a1), (a0, a1), "pii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_SIGNATURE(GLuint, glGetSubroutineIndex, (GLuint a0, GLenum a1, const GLchar * a2), (a0, a1, a2), "iiiS", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (const GLchar *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_SIGNATURE(GLint, glGetSubroutineUniformLocation, (GLuint a0, GLenum a1, const GLchar * a2), (a0, a1, a2), "iiiS", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (const GLchar *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetSynciv, (GLsync a0, GLenum a1, GLsizei a2, GLsizei * a3, GLint * a4), (a0, a1, a2, a3, a4), "vsinoo", (GLPLATFORM_GL_STORE(0, s, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3), GLPLATFORM_GL_STORE(4, o, a4)), ((GLsync)GLPLATFORM_GL_LOAD(0, s), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLsizei *)GLPLATFORM_GL_LOAD(3, o), (GLint *)GLPLATFORM_GL_LOAD(4, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetTexImage, (GLenum a0, GLint a1, GLenum a2, GLenum a3, void * a4), (a0, a1, a2, a3, a4), "viiiio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, o, a4)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLenum)GLPLATFORM_GL_LOAD(3, i), (void *)GLPLATFORM_GL_LOAD(4, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetTexLevelParameterfv, (GLenum a0, GLint a1, GLenum a2, GLfloat * a3), (a0, a1, a2, a3), "viiio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLfloat *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetTexLevelParameteriv, (GLenum a0, GLint a1, GLenum a2, GLint * a3), (a0, a1, a2, a3), "viiio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLint *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetTexParameterIiv, (GLenum a0, GLenum a1, GLint * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLint *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetTexParameterIuiv, (GLenum a0, GLenum a1, GLuint * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLuint *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetTexParameterfv, (GLenum a0, GLenum a1, GLfloat * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLfloat *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetTexParameteriv, (GLenum a0, GLenum a1, GLint * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLint *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_SIGNATURE(GLuint64, glGetTextureHandleARB, (GLuint a0), (a0), "li", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLuint)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetTextureImage, (GLuint a0, GLint a1, GLenum a2, GLenum a3, GLsizei a4, void * a5), (a0, a1, a2, a3, a4, a5), "viiiino", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, o, a5)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLenum)GLPLATFORM_GL_LOAD(3, i), (GLsizei)GLPLATFORM_GL_LOAD(4, i), (void *)GLPLATFORM_GL_LOAD(5, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetTextureLevelParameterfv, (GLuint a0, GLint a1, GLenum a2, GLfloat * a3), (a0, a1, a2, a3), "viiio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLfloat *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetTextureLevelParameteriv, (GLuint a0, GLint a1, GLenum a2, GLint * a3), (a0, a1, a2, a3), "viiio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLint *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetTextureParameterIiv, (GLuint a0, GLenum a1, GLint * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLint *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetTextureParameterIuiv, (GLuint a0, GLenum a1, GLuint * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLuint *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetTextureParameterfv, (GLuint a0, GLenum a1, GLfloat * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLfloat *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetTextureParameteriv, (GLuint a0, GLenum a1, GLint * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLint *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_SIGNATURE(GLuint64, glGetTextureSamplerHandleARB, (GLuint a0, GLuint a1), (a0, a1), "lii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetTextureSubImage, (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLenum a9, GLsizei a10, void * a11), (a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11), "viiiiinnniino", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, i, a6), GLPLATFORM_GL_STORE(7, i, a7), GLPLATFORM_GL_STORE(8, i, a8), GLPLATFORM_GL_STORE(9, i, a9), GLPLATFORM_GL_STORE(10, i, a10), GLPLATFORM_GL_STORE(11, o, a11)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLint)GLPLATFORM_GL_LOAD(3, i), (GLint)GLPLATFORM_GL_LOAD(4, i), (GLsizei)GLPLATFORM_GL_LOAD(5, i), (GLsizei)GLPLATFORM_GL_LOAD(6, i), (GLsizei)GLPLATFORM_GL_LOAD(7, i), (GLenum)GLPLATFORM_GL_LOAD(8, i), (GLenum)GLPLATFORM_GL_LOAD(9, i), (GLsizei)GLPLATFORM_GL_LOAD(10, i), (void *)GLPLATFORM_GL_LOAD(11, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetTransformFeedbackVarying, (GLuint a0, GLuint a1, GLsizei a2, GLsizei * a3, GLsizei * a4, GLenum * a5, GLchar * a6), (a0, a1, a2, a3, a4, a5, a6), "viinoooo", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3), GLPLATFORM_GL_STORE(4, o, a4), GLPLATFORM_GL_STORE(5, o, a5), GLPLATFORM_GL_STORE(6, o, a6)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLsizei *)GLPLATFORM_GL_LOAD(3, o), (GLsizei *)GLPLATFORM_GL_LOAD(4, o), (GLenum *)GLPLATFORM_GL_LOAD(5, o), (GLchar *)GLPLATFORM_GL_LOAD(6, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetTransformFeedbacki64_v, (GLuint a0, GLenum a1, GLuint a2, GLint64 * a3), (a0, a1, a2, a3), "viiio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i), (GLint64 *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetTransformFeedbacki_v, (GLuint a0, GLenum a1, GLuint a2, GLint * a3), (a0, a1, a2, a3), "viiio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i), (GLint *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetTransformFeedbackiv, (GLuint a0, GLenum a1, GLint * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLint *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_SIGNATURE(GLuint, glGetUniformBlockIndex, (GLuint a0, const GLchar * a1), (a0, a1), "iiS", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLchar *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetUniformIndices, (GLuint a0, GLsizei a1, const GLchar *const* a2, GLuint * a3), (a0, a1, a2, a3), "vinCo", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (const GLchar *const*)GLPLATFORM_GL_LOAD(2, p), (GLuint *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_SIGNATURE(GLint, glGetUniformLocation, (GLuint a0, const GLchar * a1), (a0, a1), "iiS", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLchar *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetUniformSubroutineuiv, (GLenum a0, GLint a1, GLuint * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLuint *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetUniformdv, (GLuint a0, GLint a1, GLdouble * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLdouble *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetUniformfv, (GLuint a0, GLint a1, GLfloat * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLfloat *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetUniformiv, (GLuint a0, GLint a1, GLint * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetUniformuiv, (GLuint a0, GLint a1, GLuint * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLuint *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetVertexArrayIndexed64iv, (GLuint a0, GLuint a1, GLenum a2, GLint64 * a3), (a0, a1, a2, a3), "viiio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLint64 *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetVertexArrayIndexediv, (GLuint a0, GLuint a1, GLenum a2, GLint * a3), (a0, a1, a2, a3), "viiio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLint *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetVertexArrayiv, (GLuint a0, GLenum a1, GLint * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLint *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetVertexAttribIiv, (GLuint a0, GLenum a1, GLint * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLint *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetVertexAttribIuiv, (GLuint a0, GLenum a1, GLuint * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLuint *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetVertexAttribLdv, (GLuint a0, GLenum a1, GLdouble * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLdouble *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetVertexAttribLui64vARB, (GLuint a0, GLenum a1, GLuint64EXT * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLuint64EXT *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetVertexAttribPointerv, (GLuint a0, GLenum a1, void ** a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (void **)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetVertexAttribdv, (GLuint a0, GLenum a1, GLdouble * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLdouble *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetVertexAttribfv, (GLuint a0, GLenum a1, GLfloat * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLfloat *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetVertexAttribiv, (GLuint a0, GLenum a1, GLint * a2), (a0, a1, a2), "viio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, o, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLint *)GLPLATFORM_GL_LOAD(2, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetnCompressedTexImage, (GLenum a0, GLint a1, GLsizei a2, void * a3), (a0, a1, a2, a3), "viino", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (void *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetnCompressedTexImageARB, (GLenum a0, GLint a1, GLsizei a2, void * a3), (a0, a1, a2, a3), "viino", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (void *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetnTexImage, (GLenum a0, GLint a1, GLenum a2, GLenum a3, GLsizei a4, void * a5), (a0, a1, a2, a3, a4, a5), "viiiino", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, o, a5)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLenum)GLPLATFORM_GL_LOAD(3, i), (GLsizei)GLPLATFORM_GL_LOAD(4, i), (void *)GLPLATFORM_GL_LOAD(5, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetnTexImageARB, (GLenum a0, GLint a1, GLenum a2, GLenum a3, GLsizei a4, void * a5), (a0, a1, a2, a3, a4, a5), "viiiino", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, o, a5)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLenum)GLPLATFORM_GL_LOAD(3, i), (GLsizei)GLPLATFORM_GL_LOAD(4, i), (void *)GLPLATFORM_GL_LOAD(5, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetnUniformdv, (GLuint a0, GLint a1, GLsizei a2, GLdouble * a3), (a0, a1, a2, a3), "viino", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLdouble *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetnUniformdvARB, (GLuint a0, GLint a1, GLsizei a2, GLdouble * a3), (a0, a1, a2, a3), "viino", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLdouble *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetnUniformfv, (GLuint a0, GLint a1, GLsizei a2, GLfloat * a3), (a0, a1, a2, a3), "viino", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLfloat *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetnUniformfvARB, (GLuint a0, GLint a1, GLsizei a2, GLfloat * a3), (a0, a1, a2, a3), "viino", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLfloat *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetnUniformfvKHR, (GLuint a0, GLint a1, GLsizei a2, GLfloat * a3), (a0, a1, a2, a3), "viino", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLfloat *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetnUniformiv, (GLuint a0, GLint a1, GLsizei a2, GLint * a3), (a0, a1, a2, a3), "viino", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLint *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetnUniformivARB, (GLuint a0, GLint a1, GLsizei a2, GLint * a3), (a0, a1, a2, a3), "viino", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLint *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetnUniformivKHR, (GLuint a0, GLint a1, GLsizei a2, GLint * a3), (a0, a1, a2, a3), "viino", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLint *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetnUniformuiv, (GLuint a0, GLint a1, GLsizei a2, GLuint * a3), (a0, a1, a2, a3), "viino", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLuint *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetnUniformuivARB, (GLuint a0, GLint a1, GLsizei a2, GLuint * a3), (a0, a1, a2, a3), "viino", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLuint *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glGetnUniformuivKHR, (GLuint a0, GLint a1, GLsizei a2, GLuint * a3), (a0, a1, a2, a3), "viino", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, o, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLuint *)GLPLATFORM_GL_LOAD(3, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glHint, (GLenum a0, GLenum a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glInvalidateBufferData, (GLuint a0), (a0), "vi", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLuint)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glInvalidateBufferSubData, (GLuint a0, GLintptr a1, GLsizeiptr a2), (a0, a1, a2), "vill", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, l, a1), GLPLATFORM_GL_STORE(2, l, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLintptr)GLPLATFORM_GL_LOAD(1, l), (GLsizeiptr)GLPLATFORM_GL_LOAD(2, l)))
+GLPLATFORM_GL_VOID_SIGNATURE(glInvalidateFramebuffer, (GLenum a0, GLsizei a1, const GLenum * a2), (a0, a1, a2), "vin4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (const GLenum *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glInvalidateNamedFramebufferData, (GLuint a0, GLsizei a1, const GLenum * a2), (a0, a1, a2), "vin4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (const GLenum *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glInvalidateNamedFramebufferSubData, (GLuint a0, GLsizei a1, const GLenum * a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6), (a0, a1, a2, a3, a4, a5, a6), "vin4iinn", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, i, a6)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (const GLenum *)GLPLATFORM_GL_LOAD(2, p), (GLint)GLPLATFORM_GL_LOAD(3, i), (GLint)GLPLATFORM_GL_LOAD(4, i), (GLsizei)GLPLATFORM_GL_LOAD(5, i), (GLsizei)GLPLATFORM_GL_LOAD(6, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glInvalidateSubFramebuffer, (GLenum a0, GLsizei a1, const GLenum * a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6), (a0, a1, a2, a3, a4, a5, a6), "vin4iinn", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, i, a6)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (const GLenum *)GLPLATFORM_GL_LOAD(2, p), (GLint)GLPLATFORM_GL_LOAD(3, i), (GLint)GLPLATFORM_GL_LOAD(4, i), (GLsizei)GLPLATFORM_GL_LOAD(5, i), (GLsizei)GLPLATFORM_GL_LOAD(6, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glInvalidateTexImage, (GLuint a0, GLint a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glInvalidateTexSubImage, (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7), (a0, a1, a2, a3, a4, a5, a6, a7), "viiiiinnn", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, i, a6), GLPLATFORM_GL_STORE(7, i, a7)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLint)GLPLATFORM_GL_LOAD(3, i), (GLint)GLPLATFORM_GL_LOAD(4, i), (GLsizei)GLPLATFORM_GL_LOAD(5, i), (GLsizei)GLPLATFORM_GL_LOAD(6, i), (GLsizei)GLPLATFORM_GL_LOAD(7, i)))
+GLPLATFORM_GL_SIGNATURE(GLboolean, glIsBuffer, (GLuint a0), (a0), "ii", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLuint)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_SIGNATURE(GLboolean, glIsEnabled, (GLenum a0), (a0), "ii", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLenum)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_SIGNATURE(GLboolean, glIsEnabledi, (GLenum a0, GLuint a1), (a0, a1), "iii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_SIGNATURE(GLboolean, glIsFramebuffer, (GLuint a0), (a0), "ii", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLuint)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_SIGNATURE(GLboolean, glIsImageHandleResidentARB, (GLuint64 a0), (a0), "il", (GLPLATFORM_GL_STORE(0, l, a0)), ((GLuint64)GLPLATFORM_GL_LOAD(0, l)))
+GLPLATFORM_GL_SIGNATURE(GLboolean, glIsNamedStringARB, (GLint a0, const GLchar * a1), (a0, a1), "iiS", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (const GLchar *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_SIGNATURE(GLboolean, glIsProgram, (GLuint a0), (a0), "ii", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLuint)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_SIGNATURE(GLboolean, glIsProgramPipeline, (GLuint a0), (a0), "ii", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLuint)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_SIGNATURE(GLboolean, glIsQuery, (GLuint a0), (a0), "ii", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLuint)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_SIGNATURE(GLboolean, glIsRenderbuffer, (GLuint a0), (a0), "ii", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLuint)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_SIGNATURE(GLboolean, glIsSampler, (GLuint a0), (a0), "ii", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLuint)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_SIGNATURE(GLboolean, glIsShader, (GLuint a0), (a0), "ii", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLuint)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_SIGNATURE(GLboolean, glIsSync, (GLsync a0), (a0), "is", (GLPLATFORM_GL_STORE(0, s, a0)), ((GLsync)GLPLATFORM_GL_LOAD(0, s)))
+GLPLATFORM_GL_SIGNATURE(GLboolean, glIsTexture, (GLuint a0), (a0), "ii", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLuint)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_SIGNATURE(GLboolean, glIsTextureHandleResidentARB, (GLuint64 a0), (a0), "il", (GLPLATFORM_GL_STORE(0, l, a0)), ((GLuint64)GLPLATFORM_GL_LOAD(0, l)))
+GLPLATFORM_GL_SIGNATURE(GLboolean, glIsTransformFeedback, (GLuint a0), (a0), "ii", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLuint)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_SIGNATURE(GLboolean, glIsVertexArray, (GLuint a0), (a0), "ii", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLuint)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glLineWidth, (GLfloat a0), (a0), "vf", (GLPLATFORM_GL_STORE(0, f, a0)), ((GLfloat)GLPLATFORM_GL_LOAD(0, f)))
+GLPLATFORM_GL_VOID_SIGNATURE(glLinkProgram, (GLuint a0), (a0), "vi", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLuint)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glLogicOp, (GLenum a0), (a0), "vi", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLenum)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glMakeImageHandleNonResidentARB, (GLuint64 a0), (a0), "vl", (GLPLATFORM_GL_STORE(0, l, a0)), ((GLuint64)GLPLATFORM_GL_LOAD(0, l)))
+GLPLATFORM_GL_VOID_SIGNATURE(glMakeImageHandleResidentARB, (GLuint64 a0, GLenum a1), (a0, a1), "vli", (GLPLATFORM_GL_STORE(0, l, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLuint64)GLPLATFORM_GL_LOAD(0, l), (GLenum)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glMakeTextureHandleNonResidentARB, (GLuint64 a0), (a0), "vl", (GLPLATFORM_GL_STORE(0, l, a0)), ((GLuint64)GLPLATFORM_GL_LOAD(0, l)))
+GLPLATFORM_GL_VOID_SIGNATURE(glMakeTextureHandleResidentARB, (GLuint64 a0), (a0), "vl", (GLPLATFORM_GL_STORE(0, l, a0)), ((GLuint64)GLPLATFORM_GL_LOAD(0, l)))
+GLPLATFORM_GL_SIGNATURE(void *, glMapBuffer, (GLenum a0, GLenum a1), (a0, a1), "pii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_SIGNATURE(void *, glMapBufferRange, (GLenum a0, GLintptr a1, GLsizeiptr a2, GLbitfield a3), (a0, a1, a2, a3), "pilli", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, l, a1), GLPLATFORM_GL_STORE(2, l, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLintptr)GLPLATFORM_GL_LOAD(1, l), (GLsizeiptr)GLPLATFORM_GL_LOAD(2, l), (GLbitfield)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_SIGNATURE(void *, glMapNamedBuffer, (GLuint a0, GLenum a1), (a0, a1), "pii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_SIGNATURE(void *, glMapNamedBufferRange, (GLuint a0, GLintptr a1, GLsizeiptr a2, GLbitfield a3), (a0, a1, a2, a3), "pilli", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, l, a1), GLPLATFORM_GL_STORE(2, l, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLintptr)GLPLATFORM_GL_LOAD(1, l), (GLsizeiptr)GLPLATFORM_GL_LOAD(2, l), (GLbitfield)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glMemoryBarrier, (GLbitfield a0), (a0), "vi", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLbitfield)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glMemoryBarrierByRegion, (GLbitfield a0), (a0), "vi", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLbitfield)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glMinSampleShading, (GLfloat a0), (a0), "vf", (GLPLATFORM_GL_STORE(0, f, a0)), ((GLfloat)GLPLATFORM_GL_LOAD(0, f)))
+GLPLATFORM_GL_VOID_SIGNATURE(glMinSampleShadingARB, (GLfloat a0), (a0), "vf", (GLPLATFORM_GL_STORE(0, f, a0)), ((GLfloat)GLPLATFORM_GL_LOAD(0, f)))
+GLPLATFORM_GL_VOID_SIGNATURE(glMultiDrawArrays, (GLenum a0, const GLint * a1, const GLsizei * a2, GLsizei a3), (a0, a1, a2, a3), "vi44n", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1), GLPLATFORM_GL_STORE(2, p, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (const GLint *)GLPLATFORM_GL_LOAD(1, p), (const GLsizei *)GLPLATFORM_GL_LOAD(2, p), (GLsizei)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glMultiDrawArraysIndirect, (GLenum a0, const void * a1, GLsizei a2, GLsizei a3), (a0, a1, a2, a3), "vipnn", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (const void *)GLPLATFORM_GL_LOAD(1, p), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glMultiDrawArraysIndirectCountARB, (GLenum a0, GLintptr a1, GLintptr a2, GLsizei a3, GLsizei a4), (a0, a1, a2, a3, a4), "villnn", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, l, a1), GLPLATFORM_GL_STORE(2, l, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLintptr)GLPLATFORM_GL_LOAD(1, l), (GLintptr)GLPLATFORM_GL_LOAD(2, l), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (GLsizei)GLPLATFORM_GL_LOAD(4, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glMultiDrawElements, (GLenum a0, const GLsizei * a1, GLenum a2, const void *const* a3, GLsizei a4), (a0, a1, a2, a3, a4), "vi4iXn", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, x, a3), GLPLATFORM_GL_STORE(4, i, a4)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (const GLsizei *)GLPLATFORM_GL_LOAD(1, p), (GLenum)GLPLATFORM_GL_LOAD(2, i), (const void *const*)GLPLATFORM_GL_LOAD(3, x), (GLsizei)GLPLATFORM_GL_LOAD(4, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glMultiDrawElementsBaseVertex, (GLenum a0, const GLsizei * a1, GLenum a2, const void *const* a3, GLsizei a4, const GLint * a5), (a0, a1, a2, a3, a4, a5), "vi4iXn4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, x, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, p, a5)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (const GLsizei *)GLPLATFORM_GL_LOAD(1, p), (GLenum)GLPLATFORM_GL_LOAD(2, i), (const void *const*)GLPLATFORM_GL_LOAD(3, x), (GLsizei)GLPLATFORM_GL_LOAD(4, i), (const GLint *)GLPLATFORM_GL_LOAD(5, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glMultiDrawElementsIndirect, (GLenum a0, GLenum a1, const void * a2, GLsizei a3, GLsizei a4), (a0, a1, a2, a3, a4), "viipnn", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (const void *)GLPLATFORM_GL_LOAD(2, p), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (GLsizei)GLPLATFORM_GL_LOAD(4, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glMultiDrawElementsIndirectCountARB, (GLenum a0, GLenum a1, GLintptr a2, GLintptr a3, GLsizei a4, GLsizei a5), (a0, a1, a2, a3, a4, a5), "viillnn", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, l, a2), GLPLATFORM_GL_STORE(3, l, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLintptr)GLPLATFORM_GL_LOAD(2, l), (GLintptr)GLPLATFORM_GL_LOAD(3, l), (GLsizei)GLPLATFORM_GL_LOAD(4, i), (GLsizei)GLPLATFORM_GL_LOAD(5, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glNamedBufferData, (GLuint a0, GLsizeiptr a1, const void * a2, GLenum a3), (a0, a1, a2, a3), "vilpi", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, l, a1), GLPLATFORM_GL_STORE(2, p, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLsizeiptr)GLPLATFORM_GL_LOAD(1, l), (const void *)GLPLATFORM_GL_LOAD(2, p), (GLenum)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glNamedBufferPageCommitmentARB, (GLuint a0, GLintptr a1, GLsizeiptr a2, GLboolean a3), (a0, a1, a2, a3), "villi", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, l, a1), GLPLATFORM_GL_STORE(2, l, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLintptr)GLPLATFORM_GL_LOAD(1, l), (GLsizeiptr)GLPLATFORM_GL_LOAD(2, l), (GLboolean)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glNamedBufferPageCommitmentEXT, (GLuint a0, GLintptr a1, GLsizeiptr a2, GLboolean a3), (a0, a1, a2, a3), "villi", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, l, a1), GLPLATFORM_GL_STORE(2, l, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLintptr)GLPLATFORM_GL_LOAD(1, l), (GLsizeiptr)GLPLATFORM_GL_LOAD(2, l), (GLboolean)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glNamedBufferStorage, (GLuint a0, GLsizeiptr a1, const void * a2, GLbitfield a3), (a0, a1, a2, a3), "vilpi", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, l, a1), GLPLATFORM_GL_STORE(2, p, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLsizeiptr)GLPLATFORM_GL_LOAD(1, l), (const void *)GLPLATFORM_GL_LOAD(2, p), (GLbitfield)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glNamedBufferSubData, (GLuint a0, GLintptr a1, GLsizeiptr a2, const void * a3), (a0, a1, a2, a3), "villp", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, l, a1), GLPLATFORM_GL_STORE(2, l, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLintptr)GLPLATFORM_GL_LOAD(1, l), (GLsizeiptr)GLPLATFORM_GL_LOAD(2, l), (const void *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glNamedFramebufferDrawBuffer, (GLuint a0, GLenum a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glNamedFramebufferDrawBuffers, (GLuint a0, GLsizei a1, const GLenum * a2), (a0, a1, a2), "vin4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (const GLenum *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glNamedFramebufferParameteri, (GLuint a0, GLenum a1, GLint a2), (a0, a1, a2), "viii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glNamedFramebufferReadBuffer, (GLuint a0, GLenum a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glNamedFramebufferRenderbuffer, (GLuint a0, GLenum a1, GLenum a2, GLuint a3), (a0, a1, a2, a3), "viiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLuint)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glNamedFramebufferTexture, (GLuint a0, GLenum a1, GLuint a2, GLint a3), (a0, a1, a2, a3), "viiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i), (GLint)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glNamedFramebufferTextureLayer, (GLuint a0, GLenum a1, GLuint a2, GLint a3, GLint a4), (a0, a1, a2, a3, a4), "viiiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i), (GLint)GLPLATFORM_GL_LOAD(3, i), (GLint)GLPLATFORM_GL_LOAD(4, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glNamedRenderbufferStorage, (GLuint a0, GLenum a1, GLsizei a2, GLsizei a3), (a0, a1, a2, a3), "viinn", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glNamedRenderbufferStorageMultisample, (GLuint a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4), (a0, a1, a2, a3, a4), "vininn", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (GLsizei)GLPLATFORM_GL_LOAD(4, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glNamedStringARB, (GLenum a0, GLint a1, const GLchar * a2, GLint a3, const GLchar * a4), (a0, a1, a2, a3, a4), "viiSiS", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, p, a4)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (const GLchar *)GLPLATFORM_GL_LOAD(2, p), (GLint)GLPLATFORM_GL_LOAD(3, i), (const GLchar *)GLPLATFORM_GL_LOAD(4, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glObjectLabel, (GLenum a0, GLuint a1, GLsizei a2, const GLchar * a3), (a0, a1, a2, a3), "viinS", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (const GLchar *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glObjectLabelKHR, (GLenum a0, GLuint a1, GLsizei a2, const GLchar * a3), (a0, a1, a2, a3), "viinS", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (const GLchar *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glObjectPtrLabel, (const void * a0, GLsizei a1, const GLchar * a2), (a0, a1, a2), "vpnS", (GLPLATFORM_GL_STORE(0, p, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((const void *)GLPLATFORM_GL_LOAD(0, p), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (const GLchar *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glObjectPtrLabelKHR, (const void * a0, GLsizei a1, const GLchar * a2), (a0, a1, a2), "vpnS", (GLPLATFORM_GL_STORE(0, p, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((const void *)GLPLATFORM_GL_LOAD(0, p), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (const GLchar *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glPatchParameterfv, (GLenum a0, const GLfloat * a1), (a0, a1), "vi4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (const GLfloat *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glPatchParameteri, (GLenum a0, GLint a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glPauseTransformFeedback, (void), (), "v", ((void)0), ())
+GLPLATFORM_GL_VOID_SIGNATURE(glPixelStoref, (GLenum a0, GLfloat a1), (a0, a1), "vif", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, f, a1)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLfloat)GLPLATFORM_GL_LOAD(1, f)))
+GLPLATFORM_GL_VOID_SIGNATURE(glPixelStorei, (GLenum a0, GLint a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glPointParameterf, (GLenum a0, GLfloat a1), (a0, a1), "vif", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, f, a1)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLfloat)GLPLATFORM_GL_LOAD(1, f)))
+GLPLATFORM_GL_VOID_SIGNATURE(glPointParameterfv, (GLenum a0, const GLfloat * a1), (a0, a1), "vi4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (const GLfloat *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glPointParameteri, (GLenum a0, GLint a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glPointParameteriv, (GLenum a0, const GLint * a1), (a0, a1), "vi4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (const GLint *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glPointSize, (GLfloat a0), (a0), "vf", (GLPLATFORM_GL_STORE(0, f, a0)), ((GLfloat)GLPLATFORM_GL_LOAD(0, f)))
+GLPLATFORM_GL_VOID_SIGNATURE(glPolygonMode, (GLenum a0, GLenum a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glPolygonOffset, (GLfloat a0, GLfloat a1), (a0, a1), "vff", (GLPLATFORM_GL_STORE(0, f, a0), GLPLATFORM_GL_STORE(1, f, a1)), ((GLfloat)GLPLATFORM_GL_LOAD(0, f), (GLfloat)GLPLATFORM_GL_LOAD(1, f)))
+GLPLATFORM_GL_VOID_SIGNATURE(glPopDebugGroup, (void), (), "v", ((void)0), ())
+GLPLATFORM_GL_VOID_SIGNATURE(glPopDebugGroupKHR, (void), (), "v", ((void)0), ())
+GLPLATFORM_GL_VOID_SIGNATURE(glPrimitiveRestartIndex, (GLuint a0), (a0), "vi", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLuint)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramBinary, (GLuint a0, GLenum a1, const void * a2, GLsizei a3), (a0, a1, a2, a3), "viipn", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (const void *)GLPLATFORM_GL_LOAD(2, p), (GLsizei)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramParameteri, (GLuint a0, GLenum a1, GLint a2), (a0, a1, a2), "viii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniform1d, (GLuint a0, GLint a1, GLdouble a2), (a0, a1, a2), "viid", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, d, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLdouble)GLPLATFORM_GL_LOAD(2, d)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniform1dv, (GLuint a0, GLint a1, GLsizei a2, const GLdouble * a3), (a0, a1, a2, a3), "viin8", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (const GLdouble *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniform1f, (GLuint a0, GLint a1, GLfloat a2), (a0, a1, a2), "viif", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, f, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLfloat)GLPLATFORM_GL_LOAD(2, f)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniform1fv, (GLuint a0, GLint a1, GLsizei a2, const GLfloat * a3), (a0, a1, a2, a3), "viin4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (const GLfloat *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniform1i, (GLuint a0, GLint a1, GLint a2), (a0, a1, a2), "viii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniform1iv, (GLuint a0, GLint a1, GLsizei a2, const GLint * a3), (a0, a1, a2, a3), "viin4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (const GLint *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniform1ui, (GLuint a0, GLint a1, GLuint a2), (a0, a1, a2), "viii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniform1uiv, (GLuint a0, GLint a1, GLsizei a2, const GLuint * a3), (a0, a1, a2, a3), "viin4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (const GLuint *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniform2d, (GLuint a0, GLint a1, GLdouble a2, GLdouble a3), (a0, a1, a2, a3), "viidd", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, d, a2), GLPLATFORM_GL_STORE(3, d, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLdouble)GLPLATFORM_GL_LOAD(2, d), (GLdouble)GLPLATFORM_GL_LOAD(3, d)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniform2dv, (GLuint a0, GLint a1, GLsizei a2, const GLdouble * a3), (a0, a1, a2, a3), "viin8", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (const GLdouble *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniform2f, (GLuint a0, GLint a1, GLfloat a2, GLfloat a3), (a0, a1, a2, a3), "viiff", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, f, a2), GLPLATFORM_GL_STORE(3, f, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLfloat)GLPLATFORM_GL_LOAD(2, f), (GLfloat)GLPLATFORM_GL_LOAD(3, f)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniform2fv, (GLuint a0, GLint a1, GLsizei a2, const GLfloat * a3), (a0, a1, a2, a3), "viin4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (const GLfloat *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniform2i, (GLuint a0, GLint a1, GLint a2, GLint a3), (a0, a1, a2, a3), "viiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLint)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniform2iv, (GLuint a0, GLint a1, GLsizei a2, const GLint * a3), (a0, a1, a2, a3), "viin4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (const GLint *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniform2ui, (GLuint a0, GLint a1, GLuint a2, GLuint a3), (a0, a1, a2, a3), "viiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i), (GLuint)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniform2uiv, (GLuint a0, GLint a1, GLsizei a2, const GLuint * a3), (a0, a1, a2, a3), "viin4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (const GLuint *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniform3d, (GLuint a0, GLint a1, GLdouble a2, GLdouble a3, GLdouble a4), (a0, a1, a2, a3, a4), "viiddd", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, d, a2), GLPLATFORM_GL_STORE(3, d, a3), GLPLATFORM_GL_STORE(4, d, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLdouble)GLPLATFORM_GL_LOAD(2, d), (GLdouble)GLPLATFORM_GL_LOAD(3, d), (GLdouble)GLPLATFORM_GL_LOAD(4, d)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniform3dv, (GLuint a0, GLint a1, GLsizei a2, const GLdouble * a3), (a0, a1, a2, a3), "viin8", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (const GLdouble *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniform3f, (GLuint a0, GLint a1, GLfloat a2, GLfloat a3, GLfloat a4), (a0, a1, a2, a3, a4), "viifff", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, f, a2), GLPLATFORM_GL_STORE(3, f, a3), GLPLATFORM_GL_STORE(4, f, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLfloat)GLPLATFORM_GL_LOAD(2, f), (GLfloat)GLPLATFORM_GL_LOAD(3, f), (GLfloat)GLPLATFORM_GL_LOAD(4, f)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniform3fv, (GLuint a0, GLint a1, GLsizei a2, const GLfloat * a3), (a0, a1, a2, a3), "viin4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (const GLfloat *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniform3i, (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4), (a0, a1, a2, a3, a4), "viiiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLint)GLPLATFORM_GL_LOAD(3, i), (GLint)GLPLATFORM_GL_LOAD(4, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniform3iv, (GLuint a0, GLint a1, GLsizei a2, const GLint * a3), (a0, a1, a2, a3), "viin4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (const GLint *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniform3ui, (GLuint a0, GLint a1, GLuint a2, GLuint a3, GLuint a4), (a0, a1, a2, a3, a4), "viiiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i), (GLuint)GLPLATFORM_GL_LOAD(3, i), (GLuint)GLPLATFORM_GL_LOAD(4, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniform3uiv, (GLuint a0, GLint a1, GLsizei a2, const GLuint * a3), (a0, a1, a2, a3), "viin4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (const GLuint *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniform4d, (GLuint a0, GLint a1, GLdouble a2, GLdouble a3, GLdouble a4, GLdouble a5), (a0, a1, a2, a3, a4, a5), "viidddd", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, d, a2), GLPLATFORM_GL_STORE(3, d, a3), GLPLATFORM_GL_STORE(4, d, a4), GLPLATFORM_GL_STORE(5, d, a5)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLdouble)GLPLATFORM_GL_LOAD(2, d), (GLdouble)GLPLATFORM_GL_LOAD(3, d), (GLdouble)GLPLATFORM_GL_LOAD(4, d), (GLdouble)GLPLATFORM_GL_LOAD(5, d)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniform4dv, (GLuint a0, GLint a1, GLsizei a2, const GLdouble * a3), (a0, a1, a2, a3), "viin8", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (const GLdouble *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniform4f, (GLuint a0, GLint a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5), (a0, a1, a2, a3, a4, a5), "viiffff", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, f, a2), GLPLATFORM_GL_STORE(3, f, a3), GLPLATFORM_GL_STORE(4, f, a4), GLPLATFORM_GL_STORE(5, f, a5)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLfloat)GLPLATFORM_GL_LOAD(2, f), (GLfloat)GLPLATFORM_GL_LOAD(3, f), (GLfloat)GLPLATFORM_GL_LOAD(4, f), (GLfloat)GLPLATFORM_GL_LOAD(5, f)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniform4fv, (GLuint a0, GLint a1, GLsizei a2, const GLfloat * a3), (a0, a1, a2, a3), "viin4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (const GLfloat *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniform4i, (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5), (a0, a1, a2, a3, a4, a5), "viiiiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLint)GLPLATFORM_GL_LOAD(3, i), (GLint)GLPLATFORM_GL_LOAD(4, i), (GLint)GLPLATFORM_GL_LOAD(5, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniform4iv, (GLuint a0, GLint a1, GLsizei a2, const GLint * a3), (a0, a1, a2, a3), "viin4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (const GLint *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniform4ui, (GLuint a0, GLint a1, GLuint a2, GLuint a3, GLuint a4, GLuint a5), (a0, a1, a2, a3, a4, a5), "viiiiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i), (GLuint)GLPLATFORM_GL_LOAD(3, i), (GLuint)GLPLATFORM_GL_LOAD(4, i), (GLuint)GLPLATFORM_GL_LOAD(5, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniform4uiv, (GLuint a0, GLint a1, GLsizei a2, const GLuint * a3), (a0, a1, a2, a3), "viin4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (const GLuint *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniformHandleui64ARB, (GLuint a0, GLint a1, GLuint64 a2), (a0, a1, a2), "viil", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, l, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLuint64)GLPLATFORM_GL_LOAD(2, l)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniformHandleui64vARB, (GLuint a0, GLint a1, GLsizei a2, const GLuint64 * a3), (a0, a1, a2, a3), "viin8", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (const GLuint64 *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniformMatrix2dv, (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble * a4), (a0, a1, a2, a3, a4), "viini8", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, p, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLboolean)GLPLATFORM_GL_LOAD(3, i), (const GLdouble *)GLPLATFORM_GL_LOAD(4, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniformMatrix2fv, (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat * a4), (a0, a1, a2, a3, a4), "viini4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, p, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLboolean)GLPLATFORM_GL_LOAD(3, i), (const GLfloat *)GLPLATFORM_GL_LOAD(4, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniformMatrix2x3dv, (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble * a4), (a0, a1, a2, a3, a4), "viini8", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, p, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLboolean)GLPLATFORM_GL_LOAD(3, i), (const GLdouble *)GLPLATFORM_GL_LOAD(4, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniformMatrix2x3fv, (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat * a4), (a0, a1, a2, a3, a4), "viini4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, p, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLboolean)GLPLATFORM_GL_LOAD(3, i), (const GLfloat *)GLPLATFORM_GL_LOAD(4, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniformMatrix2x4dv, (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble * a4), (a0, a1, a2, a3, a4), "viini8", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, p, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLboolean)GLPLATFORM_GL_LOAD(3, i), (const GLdouble *)GLPLATFORM_GL_LOAD(4, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniformMatrix2x4fv, (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat * a4), (a0, a1, a2, a3, a4), "viini4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, p, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLboolean)GLPLATFORM_GL_LOAD(3, i), (const GLfloat *)GLPLATFORM_GL_LOAD(4, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniformMatrix3dv, (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble * a4), (a0, a1, a2, a3, a4), "viini8", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, p, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLboolean)GLPLATFORM_GL_LOAD(3, i), (const GLdouble *)GLPLATFORM_GL_LOAD(4, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniformMatrix3fv, (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat * a4), (a0, a1, a2, a3, a4), "viini4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, p, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLboolean)GLPLATFORM_GL_LOAD(3, i), (const GLfloat *)GLPLATFORM_GL_LOAD(4, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniformMatrix3x2dv, (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble * a4), (a0, a1, a2, a3, a4), "viini8", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, p, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLboolean)GLPLATFORM_GL_LOAD(3, i), (const GLdouble *)GLPLATFORM_GL_LOAD(4, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniformMatrix3x2fv, (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat * a4), (a0, a1, a2, a3, a4), "viini4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, p, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLboolean)GLPLATFORM_GL_LOAD(3, i), (const GLfloat *)GLPLATFORM_GL_LOAD(4, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniformMatrix3x4dv, (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble * a4), (a0, a1, a2, a3, a4), "viini8", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, p, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLboolean)GLPLATFORM_GL_LOAD(3, i), (const GLdouble *)GLPLATFORM_GL_LOAD(4, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniformMatrix3x4fv, (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat * a4), (a0, a1, a2, a3, a4), "viini4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, p, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLboolean)GLPLATFORM_GL_LOAD(3, i), (const GLfloat *)GLPLATFORM_GL_LOAD(4, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniformMatrix4dv, (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble * a4), (a0, a1, a2, a3, a4), "viini8", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, p, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLboolean)GLPLATFORM_GL_LOAD(3, i), (const GLdouble *)GLPLATFORM_GL_LOAD(4, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniformMatrix4fv, (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat * a4), (a0, a1, a2, a3, a4), "viini4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, p, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLboolean)GLPLATFORM_GL_LOAD(3, i), (const GLfloat *)GLPLATFORM_GL_LOAD(4, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniformMatrix4x2dv, (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble * a4), (a0, a1, a2, a3, a4), "viini8", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, p, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLboolean)GLPLATFORM_GL_LOAD(3, i), (const GLdouble *)GLPLATFORM_GL_LOAD(4, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniformMatrix4x2fv, (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat * a4), (a0, a1, a2, a3, a4), "viini4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, p, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLboolean)GLPLATFORM_GL_LOAD(3, i), (const GLfloat *)GLPLATFORM_GL_LOAD(4, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniformMatrix4x3dv, (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble * a4), (a0, a1, a2, a3, a4), "viini8", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, p, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLboolean)GLPLATFORM_GL_LOAD(3, i), (const GLdouble *)GLPLATFORM_GL_LOAD(4, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProgramUniformMatrix4x3fv, (GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat * a4), (a0, a1, a2, a3, a4), "viini4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, p, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLboolean)GLPLATFORM_GL_LOAD(3, i), (const GLfloat *)GLPLATFORM_GL_LOAD(4, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glProvokingVertex, (GLenum a0), (a0), "vi", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLenum)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glPushDebugGroup, (GLenum a0, GLuint a1, GLsizei a2, const GLchar * a3), (a0, a1, a2, a3), "viinS", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (const GLchar *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glPushDebugGroupKHR, (GLenum a0, GLuint a1, GLsizei a2, const GLchar * a3), (a0, a1, a2, a3), "viinS", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (const GLchar *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glQueryCounter, (GLuint a0, GLenum a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glReadBuffer, (GLenum a0), (a0), "vi", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLenum)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glReadPixels, (GLint a0, GLint a1, GLsizei a2, GLsizei a3, GLenum a4, GLenum a5, void * a6), (a0, a1, a2, a3, a4, a5, a6), "viinniio", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, o, a6)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (GLenum)GLPLATFORM_GL_LOAD(4, i), (GLenum)GLPLATFORM_GL_LOAD(5, i), (void *)GLPLATFORM_GL_LOAD(6, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glReadnPixels, (GLint a0, GLint a1, GLsizei a2, GLsizei a3, GLenum a4, GLenum a5, GLsizei a6, void * a7), (a0, a1, a2, a3, a4, a5, a6, a7), "viinniino", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, i, a6), GLPLATFORM_GL_STORE(7, o, a7)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (GLenum)GLPLATFORM_GL_LOAD(4, i), (GLenum)GLPLATFORM_GL_LOAD(5, i), (GLsizei)GLPLATFORM_GL_LOAD(6, i), (void *)GLPLATFORM_GL_LOAD(7, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glReadnPixelsARB, (GLint a0, GLint a1, GLsizei a2, GLsizei a3, GLenum a4, GLenum a5, GLsizei a6, void * a7), (a0, a1, a2, a3, a4, a5, a6, a7), "viinniino", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, i, a6), GLPLATFORM_GL_STORE(7, o, a7)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (GLenum)GLPLATFORM_GL_LOAD(4, i), (GLenum)GLPLATFORM_GL_LOAD(5, i), (GLsizei)GLPLATFORM_GL_LOAD(6, i), (void *)GLPLATFORM_GL_LOAD(7, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glReadnPixelsKHR, (GLint a0, GLint a1, GLsizei a2, GLsizei a3, GLenum a4, GLenum a5, GLsizei a6, void * a7), (a0, a1, a2, a3, a4, a5, a6, a7), "viinniino", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, i, a6), GLPLATFORM_GL_STORE(7, o, a7)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (GLenum)GLPLATFORM_GL_LOAD(4, i), (GLenum)GLPLATFORM_GL_LOAD(5, i), (GLsizei)GLPLATFORM_GL_LOAD(6, i), (void *)GLPLATFORM_GL_LOAD(7, o)))
+GLPLATFORM_GL_VOID_SIGNATURE(glReleaseShaderCompiler, (void), (), "v", ((void)0), ())
+GLPLATFORM_GL_VOID_SIGNATURE(glRenderbufferStorage, (GLenum a0, GLenum a1, GLsizei a2, GLsizei a3), (a0, a1, a2, a3), "viinn", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glRenderbufferStorageMultisample, (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4), (a0, a1, a2, a3, a4), "vininn", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (GLsizei)GLPLATFORM_GL_LOAD(4, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glResumeTransformFeedback, (void), (), "v", ((void)0), ())
+GLPLATFORM_GL_VOID_SIGNATURE(glSampleCoverage, (GLfloat a0, GLboolean a1), (a0, a1), "vfi", (GLPLATFORM_GL_STORE(0, f, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLfloat)GLPLATFORM_GL_LOAD(0, f), (GLboolean)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glSampleMaski, (GLuint a0, GLbitfield a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLbitfield)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glSamplerParameterIiv, (GLuint a0, GLenum a1, const GLint * a2), (a0, a1, a2), "vii4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (const GLint *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glSamplerParameterIuiv, (GLuint a0, GLenum a1, const GLuint * a2), (a0, a1, a2), "vii4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (const GLuint *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glSamplerParameterf, (GLuint a0, GLenum a1, GLfloat a2), (a0, a1, a2), "viif", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, f, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLfloat)GLPLATFORM_GL_LOAD(2, f)))
+GLPLATFORM_GL_VOID_SIGNATURE(glSamplerParameterfv, (GLuint a0, GLenum a1, const GLfloat * a2), (a0, a1, a2), "vii4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (const GLfloat *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glSamplerParameteri, (GLuint a0, GLenum a1, GLint a2), (a0, a1, a2), "viii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glSamplerParameteriv, (GLuint a0, GLenum a1, const GLint * a2), (a0, a1, a2), "vii4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (const GLint *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glScissor, (GLint a0, GLint a1, GLsizei a2, GLsizei a3), (a0, a1, a2, a3), "viinn", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glScissorArrayv, (GLuint a0, GLsizei a1, const GLint * a2), (a0, a1, a2), "vin4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (const GLint *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glScissorIndexed, (GLuint a0, GLint a1, GLint a2, GLsizei a3, GLsizei a4), (a0, a1, a2, a3, a4), "viiinn", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (GLsizei)GLPLATFORM_GL_LOAD(4, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glScissorIndexedv, (GLuint a0, const GLint * a1), (a0, a1), "vi4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLint *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glShaderBinary, (GLsizei a0, const GLuint * a1, GLenum a2, const void * a3, GLsizei a4), (a0, a1, a2, a3, a4), "vn4ipn", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3), GLPLATFORM_GL_STORE(4, i, a4)), ((GLsizei)GLPLATFORM_GL_LOAD(0, i), (const GLuint *)GLPLATFORM_GL_LOAD(1, p), (GLenum)GLPLATFORM_GL_LOAD(2, i), (const void *)GLPLATFORM_GL_LOAD(3, p), (GLsizei)GLPLATFORM_GL_LOAD(4, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glShaderSource, (GLuint a0, GLsizei a1, const GLchar *const* a2, const GLint * a3), (a0, a1, a2, a3), "vinC4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (const GLchar *const*)GLPLATFORM_GL_LOAD(2, p), (const GLint *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glShaderStorageBlockBinding, (GLuint a0, GLuint a1, GLuint a2), (a0, a1, a2), "viii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glStencilFunc, (GLenum a0, GLint a1, GLuint a2), (a0, a1, a2), "viii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glStencilFuncSeparate, (GLenum a0, GLenum a1, GLint a2, GLuint a3), (a0, a1, a2, a3), "viiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLuint)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glStencilMask, (GLuint a0), (a0), "vi", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLuint)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glStencilMaskSeparate, (GLenum a0, GLuint a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glStencilOp, (GLenum a0, GLenum a1, GLenum a2), (a0, a1, a2), "viii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glStencilOpSeparate, (GLenum a0, GLenum a1, GLenum a2, GLenum a3), (a0, a1, a2, a3), "viiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLenum)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTexBuffer, (GLenum a0, GLenum a1, GLuint a2), (a0, a1, a2), "viii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTexBufferRange, (GLenum a0, GLenum a1, GLuint a2, GLintptr a3, GLsizeiptr a4), (a0, a1, a2, a3, a4), "viiill", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, l, a3), GLPLATFORM_GL_STORE(4, l, a4)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i), (GLintptr)GLPLATFORM_GL_LOAD(3, l), (GLsizeiptr)GLPLATFORM_GL_LOAD(4, l)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTexImage1D, (GLenum a0, GLint a1, GLint a2, GLsizei a3, GLint a4, GLenum a5, GLenum a6, const void * a7), (a0, a1, a2, a3, a4, a5, a6, a7), "viiiniiip", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, i, a6), GLPLATFORM_GL_STORE(7, p, a7)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (GLint)GLPLATFORM_GL_LOAD(4, i), (GLenum)GLPLATFORM_GL_LOAD(5, i), (GLenum)GLPLATFORM_GL_LOAD(6, i), (const void *)GLPLATFORM_GL_LOAD(7, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTexImage2D, (GLenum a0, GLint a1, GLint a2, GLsizei a3, GLsizei a4, GLint a5, GLenum a6, GLenum a7, const void * a8), (a0, a1, a2, a3, a4, a5, a6, a7, a8), "viiinniiip", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, i, a6), GLPLATFORM_GL_STORE(7, i, a7), GLPLATFORM_GL_STORE(8, p, a8)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (GLsizei)GLPLATFORM_GL_LOAD(4, i), (GLint)GLPLATFORM_GL_LOAD(5, i), (GLenum)GLPLATFORM_GL_LOAD(6, i), (GLenum)GLPLATFORM_GL_LOAD(7, i), (const void *)GLPLATFORM_GL_LOAD(8, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTexImage2DMultisample, (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLboolean a5), (a0, a1, a2, a3, a4, a5), "vininni", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (GLsizei)GLPLATFORM_GL_LOAD(4, i), (GLboolean)GLPLATFORM_GL_LOAD(5, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTexImage3D, (GLenum a0, GLint a1, GLint a2, GLsizei a3, GLsizei a4, GLsizei a5, GLint a6, GLenum a7, GLenum a8, const void * a9), (a0, a1, a2, a3, a4, a5, a6, a7, a8, a9), "viiinnniiip", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, i, a6), GLPLATFORM_GL_STORE(7, i, a7), GLPLATFORM_GL_STORE(8, i, a8), GLPLATFORM_GL_STORE(9, p, a9)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (GLsizei)GLPLATFORM_GL_LOAD(4, i), (GLsizei)GLPLATFORM_GL_LOAD(5, i), (GLint)GLPLATFORM_GL_LOAD(6, i), (GLenum)GLPLATFORM_GL_LOAD(7, i), (GLenum)GLPLATFORM_GL_LOAD(8, i), (const void *)GLPLATFORM_GL_LOAD(9, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTexImage3DMultisample, (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLboolean a6), (a0, a1, a2, a3, a4, a5, a6), "vininnni", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, i, a6)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (GLsizei)GLPLATFORM_GL_LOAD(4, i), (GLsizei)GLPLATFORM_GL_LOAD(5, i), (GLboolean)GLPLATFORM_GL_LOAD(6, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTexPageCommitmentARB, (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLboolean a8), (a0, a1, a2, a3, a4, a5, a6, a7, a8), "viiiiinnni", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, i, a6), GLPLATFORM_GL_STORE(7, i, a7), GLPLATFORM_GL_STORE(8, i, a8)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLint)GLPLATFORM_GL_LOAD(3, i), (GLint)GLPLATFORM_GL_LOAD(4, i), (GLsizei)GLPLATFORM_GL_LOAD(5, i), (GLsizei)GLPLATFORM_GL_LOAD(6, i), (GLsizei)GLPLATFORM_GL_LOAD(7, i), (GLboolean)GLPLATFORM_GL_LOAD(8, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTexParameterIiv, (GLenum a0, GLenum a1, const GLint * a2), (a0, a1, a2), "vii4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (const GLint *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTexParameterIuiv, (GLenum a0, GLenum a1, const GLuint * a2), (a0, a1, a2), "vii4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (const GLuint *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTexParameterf, (GLenum a0, GLenum a1, GLfloat a2), (a0, a1, a2), "viif", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, f, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLfloat)GLPLATFORM_GL_LOAD(2, f)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTexParameterfv, (GLenum a0, GLenum a1, const GLfloat * a2), (a0, a1, a2), "vii4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (const GLfloat *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTexParameteri, (GLenum a0, GLenum a1, GLint a2), (a0, a1, a2), "viii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTexParameteriv, (GLenum a0, GLenum a1, const GLint * a2), (a0, a1, a2), "vii4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (const GLint *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTexStorage1D, (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3), (a0, a1, a2, a3), "vinin", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTexStorage2D, (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4), (a0, a1, a2, a3, a4), "vininn", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (GLsizei)GLPLATFORM_GL_LOAD(4, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTexStorage2DMultisample, (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLboolean a5), (a0, a1, a2, a3, a4, a5), "vininni", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (GLsizei)GLPLATFORM_GL_LOAD(4, i), (GLboolean)GLPLATFORM_GL_LOAD(5, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTexStorage3D, (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5), (a0, a1, a2, a3, a4, a5), "vininnn", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (GLsizei)GLPLATFORM_GL_LOAD(4, i), (GLsizei)GLPLATFORM_GL_LOAD(5, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTexStorage3DMultisample, (GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLboolean a6), (a0, a1, a2, a3, a4, a5, a6), "vininnni", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, i, a6)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (GLsizei)GLPLATFORM_GL_LOAD(4, i), (GLsizei)GLPLATFORM_GL_LOAD(5, i), (GLboolean)GLPLATFORM_GL_LOAD(6, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTexSubImage1D, (GLenum a0, GLint a1, GLint a2, GLsizei a3, GLenum a4, GLenum a5, const void * a6), (a0, a1, a2, a3, a4, a5, a6), "viiiniip", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, p, a6)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (GLenum)GLPLATFORM_GL_LOAD(4, i), (GLenum)GLPLATFORM_GL_LOAD(5, i), (const void *)GLPLATFORM_GL_LOAD(6, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTexSubImage2D, (GLenum a0, GLint a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5, GLenum a6, GLenum a7, const void * a8), (a0, a1, a2, a3, a4, a5, a6, a7, a8), "viiiinniip", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, i, a6), GLPLATFORM_GL_STORE(7, i, a7), GLPLATFORM_GL_STORE(8, p, a8)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLint)GLPLATFORM_GL_LOAD(3, i), (GLsizei)GLPLATFORM_GL_LOAD(4, i), (GLsizei)GLPLATFORM_GL_LOAD(5, i), (GLenum)GLPLATFORM_GL_LOAD(6, i), (GLenum)GLPLATFORM_GL_LOAD(7, i), (const void *)GLPLATFORM_GL_LOAD(8, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTexSubImage3D, (GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLenum a9, const void * a10), (a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10), "viiiiinnniip", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, i, a6), GLPLATFORM_GL_STORE(7, i, a7), GLPLATFORM_GL_STORE(8, i, a8), GLPLATFORM_GL_STORE(9, i, a9), GLPLATFORM_GL_STORE(10, p, a10)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLint)GLPLATFORM_GL_LOAD(3, i), (GLint)GLPLATFORM_GL_LOAD(4, i), (GLsizei)GLPLATFORM_GL_LOAD(5, i), (GLsizei)GLPLATFORM_GL_LOAD(6, i), (GLsizei)GLPLATFORM_GL_LOAD(7, i), (GLenum)GLPLATFORM_GL_LOAD(8, i), (GLenum)GLPLATFORM_GL_LOAD(9, i), (const void *)GLPLATFORM_GL_LOAD(10, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTextureBarrier, (void), (), "v", ((void)0), ())
+GLPLATFORM_GL_VOID_SIGNATURE(glTextureBuffer, (GLuint a0, GLenum a1, GLuint a2), (a0, a1, a2), "viii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTextureBufferRange, (GLuint a0, GLenum a1, GLuint a2, GLintptr a3, GLsizeiptr a4), (a0, a1, a2, a3, a4), "viiill", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, l, a3), GLPLATFORM_GL_STORE(4, l, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i), (GLintptr)GLPLATFORM_GL_LOAD(3, l), (GLsizeiptr)GLPLATFORM_GL_LOAD(4, l)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTextureParameterIiv, (GLuint a0, GLenum a1, const GLint * a2), (a0, a1, a2), "vii4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (const GLint *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTextureParameterIuiv, (GLuint a0, GLenum a1, const GLuint * a2), (a0, a1, a2), "vii4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (const GLuint *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTextureParameterf, (GLuint a0, GLenum a1, GLfloat a2), (a0, a1, a2), "viif", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, f, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLfloat)GLPLATFORM_GL_LOAD(2, f)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTextureParameterfv, (GLuint a0, GLenum a1, const GLfloat * a2), (a0, a1, a2), "vii4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (const GLfloat *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTextureParameteri, (GLuint a0, GLenum a1, GLint a2), (a0, a1, a2), "viii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTextureParameteriv, (GLuint a0, GLenum a1, const GLint * a2), (a0, a1, a2), "vii4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (const GLint *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTextureStorage1D, (GLuint a0, GLsizei a1, GLenum a2, GLsizei a3), (a0, a1, a2, a3), "vinin", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTextureStorage2D, (GLuint a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4), (a0, a1, a2, a3, a4), "vininn", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (GLsizei)GLPLATFORM_GL_LOAD(4, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTextureStorage2DMultisample, (GLuint a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLboolean a5), (a0, a1, a2, a3, a4, a5), "vininni", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (GLsizei)GLPLATFORM_GL_LOAD(4, i), (GLboolean)GLPLATFORM_GL_LOAD(5, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTextureStorage3D, (GLuint a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5), (a0, a1, a2, a3, a4, a5), "vininnn", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (GLsizei)GLPLATFORM_GL_LOAD(4, i), (GLsizei)GLPLATFORM_GL_LOAD(5, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTextureStorage3DMultisample, (GLuint a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLboolean a6), (a0, a1, a2, a3, a4, a5, a6), "vininnni", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, i, a6)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (GLsizei)GLPLATFORM_GL_LOAD(4, i), (GLsizei)GLPLATFORM_GL_LOAD(5, i), (GLboolean)GLPLATFORM_GL_LOAD(6, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTextureSubImage1D, (GLuint a0, GLint a1, GLint a2, GLsizei a3, GLenum a4, GLenum a5, const void * a6), (a0, a1, a2, a3, a4, a5, a6), "viiiniip", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, p, a6)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (GLenum)GLPLATFORM_GL_LOAD(4, i), (GLenum)GLPLATFORM_GL_LOAD(5, i), (const void *)GLPLATFORM_GL_LOAD(6, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTextureSubImage2D, (GLuint a0, GLint a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5, GLenum a6, GLenum a7, const void * a8), (a0, a1, a2, a3, a4, a5, a6, a7, a8), "viiiinniip", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, i, a6), GLPLATFORM_GL_STORE(7, i, a7), GLPLATFORM_GL_STORE(8, p, a8)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLint)GLPLATFORM_GL_LOAD(3, i), (GLsizei)GLPLATFORM_GL_LOAD(4, i), (GLsizei)GLPLATFORM_GL_LOAD(5, i), (GLenum)GLPLATFORM_GL_LOAD(6, i), (GLenum)GLPLATFORM_GL_LOAD(7, i), (const void *)GLPLATFORM_GL_LOAD(8, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTextureSubImage3D, (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLenum a9, const void * a10), (a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10), "viiiiinnniip", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, i, a6), GLPLATFORM_GL_STORE(7, i, a7), GLPLATFORM_GL_STORE(8, i, a8), GLPLATFORM_GL_STORE(9, i, a9), GLPLATFORM_GL_STORE(10, p, a10)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLint)GLPLATFORM_GL_LOAD(3, i), (GLint)GLPLATFORM_GL_LOAD(4, i), (GLsizei)GLPLATFORM_GL_LOAD(5, i), (GLsizei)GLPLATFORM_GL_LOAD(6, i), (GLsizei)GLPLATFORM_GL_LOAD(7, i), (GLenum)GLPLATFORM_GL_LOAD(8, i), (GLenum)GLPLATFORM_GL_LOAD(9, i), (const void *)GLPLATFORM_GL_LOAD(10, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTextureView, (GLuint a0, GLenum a1, GLuint a2, GLenum a3, GLuint a4, GLuint a5, GLuint a6, GLuint a7), (a0, a1, a2, a3, a4, a5, a6, a7), "viiiiiiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5), GLPLATFORM_GL_STORE(6, i, a6), GLPLATFORM_GL_STORE(7, i, a7)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i), (GLenum)GLPLATFORM_GL_LOAD(3, i), (GLuint)GLPLATFORM_GL_LOAD(4, i), (GLuint)GLPLATFORM_GL_LOAD(5, i), (GLuint)GLPLATFORM_GL_LOAD(6, i), (GLuint)GLPLATFORM_GL_LOAD(7, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTransformFeedbackBufferBase, (GLuint a0, GLuint a1, GLuint a2), (a0, a1, a2), "viii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTransformFeedbackBufferRange, (GLuint a0, GLuint a1, GLuint a2, GLintptr a3, GLsizeiptr a4), (a0, a1, a2, a3, a4), "viiill", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, l, a3), GLPLATFORM_GL_STORE(4, l, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i), (GLintptr)GLPLATFORM_GL_LOAD(3, l), (GLsizeiptr)GLPLATFORM_GL_LOAD(4, l)))
+GLPLATFORM_GL_VOID_SIGNATURE(glTransformFeedbackVaryings, (GLuint a0, GLsizei a1, const GLchar *const* a2, GLenum a3), (a0, a1, a2, a3), "vinCi", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (const GLchar *const*)GLPLATFORM_GL_LOAD(2, p), (GLenum)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniform1d, (GLint a0, GLdouble a1), (a0, a1), "vid", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, d, a1)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLdouble)GLPLATFORM_GL_LOAD(1, d)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniform1dv, (GLint a0, GLsizei a1, const GLdouble * a2), (a0, a1, a2), "vin8", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (const GLdouble *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniform1f, (GLint a0, GLfloat a1), (a0, a1), "vif", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, f, a1)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLfloat)GLPLATFORM_GL_LOAD(1, f)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniform1fv, (GLint a0, GLsizei a1, const GLfloat * a2), (a0, a1, a2), "vin4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (const GLfloat *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniform1i, (GLint a0, GLint a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniform1iv, (GLint a0, GLsizei a1, const GLint * a2), (a0, a1, a2), "vin4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (const GLint *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniform1ui, (GLint a0, GLuint a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniform1uiv, (GLint a0, GLsizei a1, const GLuint * a2), (a0, a1, a2), "vin4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (const GLuint *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniform2d, (GLint a0, GLdouble a1, GLdouble a2), (a0, a1, a2), "vidd", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, d, a1), GLPLATFORM_GL_STORE(2, d, a2)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLdouble)GLPLATFORM_GL_LOAD(1, d), (GLdouble)GLPLATFORM_GL_LOAD(2, d)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniform2dv, (GLint a0, GLsizei a1, const GLdouble * a2), (a0, a1, a2), "vin8", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (const GLdouble *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniform2f, (GLint a0, GLfloat a1, GLfloat a2), (a0, a1, a2), "viff", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, f, a1), GLPLATFORM_GL_STORE(2, f, a2)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLfloat)GLPLATFORM_GL_LOAD(1, f), (GLfloat)GLPLATFORM_GL_LOAD(2, f)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniform2fv, (GLint a0, GLsizei a1, const GLfloat * a2), (a0, a1, a2), "vin4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (const GLfloat *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniform2i, (GLint a0, GLint a1, GLint a2), (a0, a1, a2), "viii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniform2iv, (GLint a0, GLsizei a1, const GLint * a2), (a0, a1, a2), "vin4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (const GLint *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniform2ui, (GLint a0, GLuint a1, GLuint a2), (a0, a1, a2), "viii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniform2uiv, (GLint a0, GLsizei a1, const GLuint * a2), (a0, a1, a2), "vin4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (const GLuint *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniform3d, (GLint a0, GLdouble a1, GLdouble a2, GLdouble a3), (a0, a1, a2, a3), "viddd", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, d, a1), GLPLATFORM_GL_STORE(2, d, a2), GLPLATFORM_GL_STORE(3, d, a3)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLdouble)GLPLATFORM_GL_LOAD(1, d), (GLdouble)GLPLATFORM_GL_LOAD(2, d), (GLdouble)GLPLATFORM_GL_LOAD(3, d)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniform3dv, (GLint a0, GLsizei a1, const GLdouble * a2), (a0, a1, a2), "vin8", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (const GLdouble *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniform3f, (GLint a0, GLfloat a1, GLfloat a2, GLfloat a3), (a0, a1, a2, a3), "vifff", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, f, a1), GLPLATFORM_GL_STORE(2, f, a2), GLPLATFORM_GL_STORE(3, f, a3)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLfloat)GLPLATFORM_GL_LOAD(1, f), (GLfloat)GLPLATFORM_GL_LOAD(2, f), (GLfloat)GLPLATFORM_GL_LOAD(3, f)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniform3fv, (GLint a0, GLsizei a1, const GLfloat * a2), (a0, a1, a2), "vin4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (const GLfloat *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniform3i, (GLint a0, GLint a1, GLint a2, GLint a3), (a0, a1, a2, a3), "viiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLint)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniform3iv, (GLint a0, GLsizei a1, const GLint * a2), (a0, a1, a2), "vin4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (const GLint *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniform3ui, (GLint a0, GLuint a1, GLuint a2, GLuint a3), (a0, a1, a2, a3), "viiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i), (GLuint)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniform3uiv, (GLint a0, GLsizei a1, const GLuint * a2), (a0, a1, a2), "vin4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (const GLuint *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniform4d, (GLint a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4), (a0, a1, a2, a3, a4), "vidddd", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, d, a1), GLPLATFORM_GL_STORE(2, d, a2), GLPLATFORM_GL_STORE(3, d, a3), GLPLATFORM_GL_STORE(4, d, a4)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLdouble)GLPLATFORM_GL_LOAD(1, d), (GLdouble)GLPLATFORM_GL_LOAD(2, d), (GLdouble)GLPLATFORM_GL_LOAD(3, d), (GLdouble)GLPLATFORM_GL_LOAD(4, d)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniform4dv, (GLint a0, GLsizei a1, const GLdouble * a2), (a0, a1, a2), "vin8", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (const GLdouble *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniform4f, (GLint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4), (a0, a1, a2, a3, a4), "viffff", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, f, a1), GLPLATFORM_GL_STORE(2, f, a2), GLPLATFORM_GL_STORE(3, f, a3), GLPLATFORM_GL_STORE(4, f, a4)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLfloat)GLPLATFORM_GL_LOAD(1, f), (GLfloat)GLPLATFORM_GL_LOAD(2, f), (GLfloat)GLPLATFORM_GL_LOAD(3, f), (GLfloat)GLPLATFORM_GL_LOAD(4, f)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniform4fv, (GLint a0, GLsizei a1, const GLfloat * a2), (a0, a1, a2), "vin4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (const GLfloat *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniform4i, (GLint a0, GLint a1, GLint a2, GLint a3, GLint a4), (a0, a1, a2, a3, a4), "viiiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLint)GLPLATFORM_GL_LOAD(3, i), (GLint)GLPLATFORM_GL_LOAD(4, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniform4iv, (GLint a0, GLsizei a1, const GLint * a2), (a0, a1, a2), "vin4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (const GLint *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniform4ui, (GLint a0, GLuint a1, GLuint a2, GLuint a3, GLuint a4), (a0, a1, a2, a3, a4), "viiiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i), (GLuint)GLPLATFORM_GL_LOAD(3, i), (GLuint)GLPLATFORM_GL_LOAD(4, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniform4uiv, (GLint a0, GLsizei a1, const GLuint * a2), (a0, a1, a2), "vin4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (const GLuint *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniformBlockBinding, (GLuint a0, GLuint a1, GLuint a2), (a0, a1, a2), "viii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniformHandleui64ARB, (GLint a0, GLuint64 a1), (a0, a1), "vil", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, l, a1)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLuint64)GLPLATFORM_GL_LOAD(1, l)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniformHandleui64vARB, (GLint a0, GLsizei a1, const GLuint64 * a2), (a0, a1, a2), "vin8", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (const GLuint64 *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniformMatrix2dv, (GLint a0, GLsizei a1, GLboolean a2, const GLdouble * a3), (a0, a1, a2, a3), "vini8", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLboolean)GLPLATFORM_GL_LOAD(2, i), (const GLdouble *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniformMatrix2fv, (GLint a0, GLsizei a1, GLboolean a2, const GLfloat * a3), (a0, a1, a2, a3), "vini4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLboolean)GLPLATFORM_GL_LOAD(2, i), (const GLfloat *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniformMatrix2x3dv, (GLint a0, GLsizei a1, GLboolean a2, const GLdouble * a3), (a0, a1, a2, a3), "vini8", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLboolean)GLPLATFORM_GL_LOAD(2, i), (const GLdouble *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniformMatrix2x3fv, (GLint a0, GLsizei a1, GLboolean a2, const GLfloat * a3), (a0, a1, a2, a3), "vini4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLboolean)GLPLATFORM_GL_LOAD(2, i), (const GLfloat *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniformMatrix2x4dv, (GLint a0, GLsizei a1, GLboolean a2, const GLdouble * a3), (a0, a1, a2, a3), "vini8", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLboolean)GLPLATFORM_GL_LOAD(2, i), (const GLdouble *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniformMatrix2x4fv, (GLint a0, GLsizei a1, GLboolean a2, const GLfloat * a3), (a0, a1, a2, a3), "vini4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLboolean)GLPLATFORM_GL_LOAD(2, i), (const GLfloat *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniformMatrix3dv, (GLint a0, GLsizei a1, GLboolean a2, const GLdouble * a3), (a0, a1, a2, a3), "vini8", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLboolean)GLPLATFORM_GL_LOAD(2, i), (const GLdouble *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniformMatrix3fv, (GLint a0, GLsizei a1, GLboolean a2, const GLfloat * a3), (a0, a1, a2, a3), "vini4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLboolean)GLPLATFORM_GL_LOAD(2, i), (const GLfloat *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniformMatrix3x2dv, (GLint a0, GLsizei a1, GLboolean a2, const GLdouble * a3), (a0, a1, a2, a3), "vini8", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLboolean)GLPLATFORM_GL_LOAD(2, i), (const GLdouble *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniformMatrix3x2fv, (GLint a0, GLsizei a1, GLboolean a2, const GLfloat * a3), (a0, a1, a2, a3), "vini4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLboolean)GLPLATFORM_GL_LOAD(2, i), (const GLfloat *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniformMatrix3x4dv, (GLint a0, GLsizei a1, GLboolean a2, const GLdouble * a3), (a0, a1, a2, a3), "vini8", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLboolean)GLPLATFORM_GL_LOAD(2, i), (const GLdouble *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniformMatrix3x4fv, (GLint a0, GLsizei a1, GLboolean a2, const GLfloat * a3), (a0, a1, a2, a3), "vini4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLboolean)GLPLATFORM_GL_LOAD(2, i), (const GLfloat *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniformMatrix4dv, (GLint a0, GLsizei a1, GLboolean a2, const GLdouble * a3), (a0, a1, a2, a3), "vini8", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLboolean)GLPLATFORM_GL_LOAD(2, i), (const GLdouble *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniformMatrix4fv, (GLint a0, GLsizei a1, GLboolean a2, const GLfloat * a3), (a0, a1, a2, a3), "vini4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLboolean)GLPLATFORM_GL_LOAD(2, i), (const GLfloat *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniformMatrix4x2dv, (GLint a0, GLsizei a1, GLboolean a2, const GLdouble * a3), (a0, a1, a2, a3), "vini8", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLboolean)GLPLATFORM_GL_LOAD(2, i), (const GLdouble *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniformMatrix4x2fv, (GLint a0, GLsizei a1, GLboolean a2, const GLfloat * a3), (a0, a1, a2, a3), "vini4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLboolean)GLPLATFORM_GL_LOAD(2, i), (const GLfloat *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniformMatrix4x3dv, (GLint a0, GLsizei a1, GLboolean a2, const GLdouble * a3), (a0, a1, a2, a3), "vini8", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLboolean)GLPLATFORM_GL_LOAD(2, i), (const GLdouble *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniformMatrix4x3fv, (GLint a0, GLsizei a1, GLboolean a2, const GLfloat * a3), (a0, a1, a2, a3), "vini4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (GLboolean)GLPLATFORM_GL_LOAD(2, i), (const GLfloat *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUniformSubroutinesuiv, (GLenum a0, GLsizei a1, const GLuint * a2), (a0, a1, a2), "vin4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLenum)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (const GLuint *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_SIGNATURE(GLboolean, glUnmapBuffer, (GLenum a0), (a0), "ii", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLenum)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_SIGNATURE(GLboolean, glUnmapNamedBuffer, (GLuint a0), (a0), "ii", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLuint)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUseProgram, (GLuint a0), (a0), "vi", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLuint)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glUseProgramStages, (GLuint a0, GLbitfield a1, GLuint a2), (a0, a1, a2), "viii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLbitfield)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glValidateProgram, (GLuint a0), (a0), "vi", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLuint)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glValidateProgramPipeline, (GLuint a0), (a0), "vi", (GLPLATFORM_GL_STORE(0, i, a0)), ((GLuint)GLPLATFORM_GL_LOAD(0, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexArrayAttribBinding, (GLuint a0, GLuint a1, GLuint a2), (a0, a1, a2), "viii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexArrayAttribFormat, (GLuint a0, GLuint a1, GLint a2, GLenum a3, GLboolean a4, GLuint a5), (a0, a1, a2, a3, a4, a5), "viiiiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, i, a5)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLenum)GLPLATFORM_GL_LOAD(3, i), (GLboolean)GLPLATFORM_GL_LOAD(4, i), (GLuint)GLPLATFORM_GL_LOAD(5, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexArrayAttribIFormat, (GLuint a0, GLuint a1, GLint a2, GLenum a3, GLuint a4), (a0, a1, a2, a3, a4), "viiiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLenum)GLPLATFORM_GL_LOAD(3, i), (GLuint)GLPLATFORM_GL_LOAD(4, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexArrayAttribLFormat, (GLuint a0, GLuint a1, GLint a2, GLenum a3, GLuint a4), (a0, a1, a2, a3, a4), "viiiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLenum)GLPLATFORM_GL_LOAD(3, i), (GLuint)GLPLATFORM_GL_LOAD(4, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexArrayBindingDivisor, (GLuint a0, GLuint a1, GLuint a2), (a0, a1, a2), "viii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexArrayElementBuffer, (GLuint a0, GLuint a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexArrayVertexBuffer, (GLuint a0, GLuint a1, GLuint a2, GLintptr a3, GLsizei a4), (a0, a1, a2, a3, a4), "viiiln", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, l, a3), GLPLATFORM_GL_STORE(4, i, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i), (GLintptr)GLPLATFORM_GL_LOAD(3, l), (GLsizei)GLPLATFORM_GL_LOAD(4, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexArrayVertexBuffers, (GLuint a0, GLuint a1, GLsizei a2, const GLuint * a3, const GLintptr * a4, const GLsizei * a5), (a0, a1, a2, a3, a4, a5), "viin484", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3), GLPLATFORM_GL_STORE(4, p, a4), GLPLATFORM_GL_STORE(5, p, a5)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (const GLuint *)GLPLATFORM_GL_LOAD(3, p), (const GLintptr *)GLPLATFORM_GL_LOAD(4, p), (const GLsizei *)GLPLATFORM_GL_LOAD(5, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttrib1d, (GLuint a0, GLdouble a1), (a0, a1), "vid", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, d, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLdouble)GLPLATFORM_GL_LOAD(1, d)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttrib1dv, (GLuint a0, const GLdouble * a1), (a0, a1), "vi8", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLdouble *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttrib1f, (GLuint a0, GLfloat a1), (a0, a1), "vif", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, f, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLfloat)GLPLATFORM_GL_LOAD(1, f)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttrib1fv, (GLuint a0, const GLfloat * a1), (a0, a1), "vi4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLfloat *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttrib1s, (GLuint a0, GLshort a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLshort)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttrib1sv, (GLuint a0, const GLshort * a1), (a0, a1), "vi2", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLshort *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttrib2d, (GLuint a0, GLdouble a1, GLdouble a2), (a0, a1, a2), "vidd", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, d, a1), GLPLATFORM_GL_STORE(2, d, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLdouble)GLPLATFORM_GL_LOAD(1, d), (GLdouble)GLPLATFORM_GL_LOAD(2, d)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttrib2dv, (GLuint a0, const GLdouble * a1), (a0, a1), "vi8", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLdouble *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttrib2f, (GLuint a0, GLfloat a1, GLfloat a2), (a0, a1, a2), "viff", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, f, a1), GLPLATFORM_GL_STORE(2, f, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLfloat)GLPLATFORM_GL_LOAD(1, f), (GLfloat)GLPLATFORM_GL_LOAD(2, f)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttrib2fv, (GLuint a0, const GLfloat * a1), (a0, a1), "vi4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLfloat *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttrib2s, (GLuint a0, GLshort a1, GLshort a2), (a0, a1, a2), "viii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLshort)GLPLATFORM_GL_LOAD(1, i), (GLshort)GLPLATFORM_GL_LOAD(2, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttrib2sv, (GLuint a0, const GLshort * a1), (a0, a1), "vi2", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLshort *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttrib3d, (GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3), (a0, a1, a2, a3), "viddd", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, d, a1), GLPLATFORM_GL_STORE(2, d, a2), GLPLATFORM_GL_STORE(3, d, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLdouble)GLPLATFORM_GL_LOAD(1, d), (GLdouble)GLPLATFORM_GL_LOAD(2, d), (GLdouble)GLPLATFORM_GL_LOAD(3, d)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttrib3dv, (GLuint a0, const GLdouble * a1), (a0, a1), "vi8", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLdouble *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttrib3f, (GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3), (a0, a1, a2, a3), "vifff", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, f, a1), GLPLATFORM_GL_STORE(2, f, a2), GLPLATFORM_GL_STORE(3, f, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLfloat)GLPLATFORM_GL_LOAD(1, f), (GLfloat)GLPLATFORM_GL_LOAD(2, f), (GLfloat)GLPLATFORM_GL_LOAD(3, f)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttrib3fv, (GLuint a0, const GLfloat * a1), (a0, a1), "vi4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLfloat *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttrib3s, (GLuint a0, GLshort a1, GLshort a2, GLshort a3), (a0, a1, a2, a3), "viiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLshort)GLPLATFORM_GL_LOAD(1, i), (GLshort)GLPLATFORM_GL_LOAD(2, i), (GLshort)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttrib3sv, (GLuint a0, const GLshort * a1), (a0, a1), "vi2", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLshort *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttrib4Nbv, (GLuint a0, const GLbyte * a1), (a0, a1), "vi1", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLbyte *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttrib4Niv, (GLuint a0, const GLint * a1), (a0, a1), "vi4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLint *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttrib4Nsv, (GLuint a0, const GLshort * a1), (a0, a1), "vi2", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLshort *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttrib4Nub, (GLuint a0, GLubyte a1, GLubyte a2, GLubyte a3, GLubyte a4), (a0, a1, a2, a3, a4), "viiiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLubyte)GLPLATFORM_GL_LOAD(1, i), (GLubyte)GLPLATFORM_GL_LOAD(2, i), (GLubyte)GLPLATFORM_GL_LOAD(3, i), (GLubyte)GLPLATFORM_GL_LOAD(4, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttrib4Nubv, (GLuint a0, const GLubyte * a1), (a0, a1), "vi1", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLubyte *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttrib4Nuiv, (GLuint a0, const GLuint * a1), (a0, a1), "vi4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLuint *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttrib4Nusv, (GLuint a0, const GLushort * a1), (a0, a1), "vi2", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLushort *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttrib4bv, (GLuint a0, const GLbyte * a1), (a0, a1), "vi1", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLbyte *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttrib4d, (GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4), (a0, a1, a2, a3, a4), "vidddd", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, d, a1), GLPLATFORM_GL_STORE(2, d, a2), GLPLATFORM_GL_STORE(3, d, a3), GLPLATFORM_GL_STORE(4, d, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLdouble)GLPLATFORM_GL_LOAD(1, d), (GLdouble)GLPLATFORM_GL_LOAD(2, d), (GLdouble)GLPLATFORM_GL_LOAD(3, d), (GLdouble)GLPLATFORM_GL_LOAD(4, d)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttrib4dv, (GLuint a0, const GLdouble * a1), (a0, a1), "vi8", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLdouble *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttrib4f, (GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4), (a0, a1, a2, a3, a4), "viffff", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, f, a1), GLPLATFORM_GL_STORE(2, f, a2), GLPLATFORM_GL_STORE(3, f, a3), GLPLATFORM_GL_STORE(4, f, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLfloat)GLPLATFORM_GL_LOAD(1, f), (GLfloat)GLPLATFORM_GL_LOAD(2, f), (GLfloat)GLPLATFORM_GL_LOAD(3, f), (GLfloat)GLPLATFORM_GL_LOAD(4, f)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttrib4fv, (GLuint a0, const GLfloat * a1), (a0, a1), "vi4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLfloat *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttrib4iv, (GLuint a0, const GLint * a1), (a0, a1), "vi4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLint *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttrib4s, (GLuint a0, GLshort a1, GLshort a2, GLshort a3, GLshort a4), (a0, a1, a2, a3, a4), "viiiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLshort)GLPLATFORM_GL_LOAD(1, i), (GLshort)GLPLATFORM_GL_LOAD(2, i), (GLshort)GLPLATFORM_GL_LOAD(3, i), (GLshort)GLPLATFORM_GL_LOAD(4, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttrib4sv, (GLuint a0, const GLshort * a1), (a0, a1), "vi2", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLshort *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttrib4ubv, (GLuint a0, const GLubyte * a1), (a0, a1), "vi1", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLubyte *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttrib4uiv, (GLuint a0, const GLuint * a1), (a0, a1), "vi4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLuint *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttrib4usv, (GLuint a0, const GLushort * a1), (a0, a1), "vi2", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLushort *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribBinding, (GLuint a0, GLuint a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribDivisor, (GLuint a0, GLuint a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribFormat, (GLuint a0, GLint a1, GLenum a2, GLboolean a3, GLuint a4), (a0, a1, a2, a3, a4), "viiiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLboolean)GLPLATFORM_GL_LOAD(3, i), (GLuint)GLPLATFORM_GL_LOAD(4, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribI1i, (GLuint a0, GLint a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribI1iv, (GLuint a0, const GLint * a1), (a0, a1), "vi4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLint *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribI1ui, (GLuint a0, GLuint a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribI1uiv, (GLuint a0, const GLuint * a1), (a0, a1), "vi4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLuint *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribI2i, (GLuint a0, GLint a1, GLint a2), (a0, a1, a2), "viii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribI2iv, (GLuint a0, const GLint * a1), (a0, a1), "vi4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLint *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribI2ui, (GLuint a0, GLuint a1, GLuint a2), (a0, a1, a2), "viii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribI2uiv, (GLuint a0, const GLuint * a1), (a0, a1), "vi4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLuint *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribI3i, (GLuint a0, GLint a1, GLint a2, GLint a3), (a0, a1, a2, a3), "viiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLint)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribI3iv, (GLuint a0, const GLint * a1), (a0, a1), "vi4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLint *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribI3ui, (GLuint a0, GLuint a1, GLuint a2, GLuint a3), (a0, a1, a2, a3), "viiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i), (GLuint)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribI3uiv, (GLuint a0, const GLuint * a1), (a0, a1), "vi4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLuint *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribI4bv, (GLuint a0, const GLbyte * a1), (a0, a1), "vi1", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLbyte *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribI4i, (GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4), (a0, a1, a2, a3, a4), "viiiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLint)GLPLATFORM_GL_LOAD(2, i), (GLint)GLPLATFORM_GL_LOAD(3, i), (GLint)GLPLATFORM_GL_LOAD(4, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribI4iv, (GLuint a0, const GLint * a1), (a0, a1), "vi4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLint *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribI4sv, (GLuint a0, const GLshort * a1), (a0, a1), "vi2", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLshort *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribI4ubv, (GLuint a0, const GLubyte * a1), (a0, a1), "vi1", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLubyte *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribI4ui, (GLuint a0, GLuint a1, GLuint a2, GLuint a3, GLuint a4), (a0, a1, a2, a3, a4), "viiiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i), (GLuint)GLPLATFORM_GL_LOAD(2, i), (GLuint)GLPLATFORM_GL_LOAD(3, i), (GLuint)GLPLATFORM_GL_LOAD(4, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribI4uiv, (GLuint a0, const GLuint * a1), (a0, a1), "vi4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLuint *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribI4usv, (GLuint a0, const GLushort * a1), (a0, a1), "vi2", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLushort *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribIFormat, (GLuint a0, GLint a1, GLenum a2, GLuint a3), (a0, a1, a2, a3), "viiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLuint)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribIPointer, (GLuint a0, GLint a1, GLenum a2, GLsizei a3, const void * a4), (a0, a1, a2, a3, a4), "viiinp", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, p, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (const void *)GLPLATFORM_GL_LOAD(4, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribL1d, (GLuint a0, GLdouble a1), (a0, a1), "vid", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, d, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLdouble)GLPLATFORM_GL_LOAD(1, d)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribL1dv, (GLuint a0, const GLdouble * a1), (a0, a1), "vi8", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLdouble *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribL1ui64ARB, (GLuint a0, GLuint64EXT a1), (a0, a1), "vil", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, l, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint64EXT)GLPLATFORM_GL_LOAD(1, l)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribL1ui64vARB, (GLuint a0, const GLuint64EXT * a1), (a0, a1), "vi8", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLuint64EXT *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribL2d, (GLuint a0, GLdouble a1, GLdouble a2), (a0, a1, a2), "vidd", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, d, a1), GLPLATFORM_GL_STORE(2, d, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLdouble)GLPLATFORM_GL_LOAD(1, d), (GLdouble)GLPLATFORM_GL_LOAD(2, d)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribL2dv, (GLuint a0, const GLdouble * a1), (a0, a1), "vi8", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLdouble *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribL3d, (GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3), (a0, a1, a2, a3), "viddd", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, d, a1), GLPLATFORM_GL_STORE(2, d, a2), GLPLATFORM_GL_STORE(3, d, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLdouble)GLPLATFORM_GL_LOAD(1, d), (GLdouble)GLPLATFORM_GL_LOAD(2, d), (GLdouble)GLPLATFORM_GL_LOAD(3, d)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribL3dv, (GLuint a0, const GLdouble * a1), (a0, a1), "vi8", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLdouble *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribL4d, (GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4), (a0, a1, a2, a3, a4), "vidddd", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, d, a1), GLPLATFORM_GL_STORE(2, d, a2), GLPLATFORM_GL_STORE(3, d, a3), GLPLATFORM_GL_STORE(4, d, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLdouble)GLPLATFORM_GL_LOAD(1, d), (GLdouble)GLPLATFORM_GL_LOAD(2, d), (GLdouble)GLPLATFORM_GL_LOAD(3, d), (GLdouble)GLPLATFORM_GL_LOAD(4, d)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribL4dv, (GLuint a0, const GLdouble * a1), (a0, a1), "vi8", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLdouble *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribLFormat, (GLuint a0, GLint a1, GLenum a2, GLuint a3), (a0, a1, a2, a3), "viiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLuint)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribLPointer, (GLuint a0, GLint a1, GLenum a2, GLsizei a3, const void * a4), (a0, a1, a2, a3, a4), "viiinp", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, p, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i), (const void *)GLPLATFORM_GL_LOAD(4, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribP1ui, (GLuint a0, GLenum a1, GLboolean a2, GLuint a3), (a0, a1, a2, a3), "viiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLboolean)GLPLATFORM_GL_LOAD(2, i), (GLuint)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribP1uiv, (GLuint a0, GLenum a1, GLboolean a2, const GLuint * a3), (a0, a1, a2, a3), "viii4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLboolean)GLPLATFORM_GL_LOAD(2, i), (const GLuint *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribP2ui, (GLuint a0, GLenum a1, GLboolean a2, GLuint a3), (a0, a1, a2, a3), "viiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLboolean)GLPLATFORM_GL_LOAD(2, i), (GLuint)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribP2uiv, (GLuint a0, GLenum a1, GLboolean a2, const GLuint * a3), (a0, a1, a2, a3), "viii4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLboolean)GLPLATFORM_GL_LOAD(2, i), (const GLuint *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribP3ui, (GLuint a0, GLenum a1, GLboolean a2, GLuint a3), (a0, a1, a2, a3), "viiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLboolean)GLPLATFORM_GL_LOAD(2, i), (GLuint)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribP3uiv, (GLuint a0, GLenum a1, GLboolean a2, const GLuint * a3), (a0, a1, a2, a3), "viii4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLboolean)GLPLATFORM_GL_LOAD(2, i), (const GLuint *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribP4ui, (GLuint a0, GLenum a1, GLboolean a2, GLuint a3), (a0, a1, a2, a3), "viiii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLboolean)GLPLATFORM_GL_LOAD(2, i), (GLuint)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribP4uiv, (GLuint a0, GLenum a1, GLboolean a2, const GLuint * a3), (a0, a1, a2, a3), "viii4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, p, a3)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLenum)GLPLATFORM_GL_LOAD(1, i), (GLboolean)GLPLATFORM_GL_LOAD(2, i), (const GLuint *)GLPLATFORM_GL_LOAD(3, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexAttribPointer, (GLuint a0, GLint a1, GLenum a2, GLboolean a3, GLsizei a4, const void * a5), (a0, a1, a2, a3, a4, a5), "viiiinp", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3), GLPLATFORM_GL_STORE(4, i, a4), GLPLATFORM_GL_STORE(5, p, a5)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLenum)GLPLATFORM_GL_LOAD(2, i), (GLboolean)GLPLATFORM_GL_LOAD(3, i), (GLsizei)GLPLATFORM_GL_LOAD(4, i), (const void *)GLPLATFORM_GL_LOAD(5, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glVertexBindingDivisor, (GLuint a0, GLuint a1), (a0, a1), "vii", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLuint)GLPLATFORM_GL_LOAD(1, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glViewport, (GLint a0, GLint a1, GLsizei a2, GLsizei a3), (a0, a1, a2, a3), "viinn", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, i, a2), GLPLATFORM_GL_STORE(3, i, a3)), ((GLint)GLPLATFORM_GL_LOAD(0, i), (GLint)GLPLATFORM_GL_LOAD(1, i), (GLsizei)GLPLATFORM_GL_LOAD(2, i), (GLsizei)GLPLATFORM_GL_LOAD(3, i)))
+GLPLATFORM_GL_VOID_SIGNATURE(glViewportArrayv, (GLuint a0, GLsizei a1, const GLfloat * a2), (a0, a1, a2), "vin4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, p, a2)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLsizei)GLPLATFORM_GL_LOAD(1, i), (const GLfloat *)GLPLATFORM_GL_LOAD(2, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glViewportIndexedf, (GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4), (a0, a1, a2, a3, a4), "viffff", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, f, a1), GLPLATFORM_GL_STORE(2, f, a2), GLPLATFORM_GL_STORE(3, f, a3), GLPLATFORM_GL_STORE(4, f, a4)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (GLfloat)GLPLATFORM_GL_LOAD(1, f), (GLfloat)GLPLATFORM_GL_LOAD(2, f), (GLfloat)GLPLATFORM_GL_LOAD(3, f), (GLfloat)GLPLATFORM_GL_LOAD(4, f)))
+GLPLATFORM_GL_VOID_SIGNATURE(glViewportIndexedfv, (GLuint a0, const GLfloat * a1), (a0, a1), "vi4", (GLPLATFORM_GL_STORE(0, i, a0), GLPLATFORM_GL_STORE(1, p, a1)), ((GLuint)GLPLATFORM_GL_LOAD(0, i), (const GLfloat *)GLPLATFORM_GL_LOAD(1, p)))
+GLPLATFORM_GL_VOID_SIGNATURE(glWaitSync, (GLsync a0, GLbitfield a1, GLuint64 a2), (a0, a1, a2), "vsil", (GLPLATFORM_GL_STORE(0, s, a0), GLPLATFORM_GL_STORE(1, i, a1), GLPLATFORM_GL_STORE(2, l, a2)), ((GLsync)GLPLATFORM_GL_LOAD(0, s), (GLbitfield)GLPLATFORM_GL_LOAD(1, i), (GLuint64)GLPLATFORM_GL_LOAD(2, l)))
+
+#undef GLPLATFORM_GL_FUNC
+#undef GLPLATFORM_GL_VOID_FUNC
+#undef GLPLATFORM_GL_EXTENSION
+#undef GLPLATFORM_GL_SIGNATURE
+#undef GLPLATFORM_GL_VOID_SIGNATURE
+#endif
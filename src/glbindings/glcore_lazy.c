@@ -0,0 +1,121 @@
+//
+// Lazy binding of the OpenGL entry points listed in glcore_entry_points.h.
+//
+// glplatform_glcore_init_lazy() points every entry point at a trampoline
+// instead of resolving it. The first call through a trampoline resolves the
+// real address and patches the function pointer, so applications only pay for
+// the entry points they actually use.
+//
+
+#ifndef _WIN32
+#ifdef GLPLATFORM_USE_EGL
+extern void (*eglGetProcAddress(const unsigned char *))(void);
+static inline void *LoadProcAddress(const char *name) { return eglGetProcAddress((const unsigned char *)name); }
+#else
+extern void (*glXGetProcAddress(const unsigned char *))(void);
+static inline void *LoadProcAddress(const char *name) { return glXGetProcAddress((const unsigned char *)name); }
+#endif
+#else
+#include <windows.h>
+#include <wingdi.h>
+static PROC LoadProcAddress(const char *name) {
+	PROC addr = wglGetProcAddress((LPCSTR)name);
+	if (addr) return addr;
+	else return (PROC)GetProcAddress(GetModuleHandleA("OpenGL32.dll"), (LPCSTR)name);
+}
+#endif
+
+#define GLPLATFORM_GL_VERSION 45
+#define GLPLATFORM_GL_ENABLE_ALL
+#include "glcore_entry_points.h"
+#include "glcore.h"
+#include "glplatform.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void *resolve(const char *name)
+{
+	void *addr = (void *)LoadProcAddress(name);
+	if (!addr) {
+		fprintf(stderr, "glplatform: %s is not available\n", name);
+		abort();
+	}
+	return addr;
+}
+
+//
+// Each trampoline caches the resolved address and only patches the global
+// function pointer if it still points at the trampoline, so layers that
+// wrap the bindings (e.g. the state filter) keep their wrappers installed.
+//
+#define GLPLATFORM_GL_FUNC(ret, name, params, args) \
+	static ret (*lazy_addr_##name) params; \
+	static ret lazy_##name params \
+	{ \
+		if (!lazy_addr_##name) \
+			lazy_addr_##name = (ret (*) params)resolve(#name); \
+		if (name == lazy_##name) \
+			name = lazy_addr_##name; \
+		return lazy_addr_##name args; \
+	}
+#define GLPLATFORM_GL_VOID_FUNC(name, params, args) \
+	static void (*lazy_addr_##name) params; \
+	static void lazy_##name params \
+	{ \
+		if (!lazy_addr_##name) \
+			lazy_addr_##name = (void (*) params)resolve(#name); \
+		if (name == lazy_##name) \
+			name = lazy_addr_##name; \
+		lazy_addr_##name args; \
+	}
+#include "glcore_entry_points.h"
+
+struct lazy_extension {
+	const char *name;
+	bool *support_flag;
+};
+
+static const struct lazy_extension lazy_extensions[] = {
+#define GLPLATFORM_GL_EXTENSION(name) \
+	{#name, &GLPLATFORM_##name},
+#include "glcore_entry_points.h"
+};
+
+static int compare_extension(const void *key, const void *elem)
+{
+	return strcmp((const char *)key, ((const struct lazy_extension *)elem)->name);
+}
+
+bool glplatform_glcore_init_lazy(int maj, int min)
+{
+	int req_version = maj * 10 + min;
+	int actual_maj, actual_min, num_extensions, i;
+	if (req_version < 32 || req_version > 45)
+		return false;
+
+#define GLPLATFORM_GL_FUNC(ret, name, params, args) \
+	name = lazy_##name;
+#define GLPLATFORM_GL_VOID_FUNC(name, params, args) \
+	name = lazy_##name;
+#include "glcore_entry_points.h"
+
+	glGetIntegerv(GL_NUM_EXTENSIONS, &num_extensions);
+	glGetIntegerv(GL_MAJOR_VERSION, &actual_maj);
+	glGetIntegerv(GL_MINOR_VERSION, &actual_min);
+	if (actual_maj * 10 + actual_min < req_version)
+		return false;
+
+	for (i = 0; i < sizeof(lazy_extensions) / sizeof(lazy_extensions[0]); i++)
+		*lazy_extensions[i].support_flag = false;
+	for (i = 0; i < num_extensions; i++) {
+		const char *extname = (const char *)glGetStringi(GL_EXTENSIONS, i);
+		const struct lazy_extension *match = bsearch(extname, lazy_extensions,
+				sizeof(lazy_extensions) / sizeof(lazy_extensions[0]),
+				sizeof(lazy_extensions[0]), compare_extension);
+		if (match)
+			*match->support_flag = true;
+	}
+	return true;
+}
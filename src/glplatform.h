@@ -10,6 +10,7 @@
 #include <stdbool.h>
 
 struct glplatform_win;
+struct glplatform_frame_limiter;
 
 typedef intptr_t glplatform_gl_context_t;
 
@@ -180,6 +181,31 @@ struct glplatform_win_callbacks {
 	 */
 	void (*on_fd_event)(struct glplatform_win *, int fd, uint32_t event, intptr_t user_data);
 
+	/*
+	 * on_visibility_change(win, visible)
+	 *
+	 * Called when the window becomes visible or invisible. A window is
+	 * invisible while it is unmapped, minimized or, where the window system
+	 * reports it, fully covered by other windows.
+	 *
+	 * win - Window
+	 *
+	 * visible - New visibility of the window. Same as glplatform_win_is_visible()
+	 *
+	 */
+	void (*on_visibility_change)(struct glplatform_win *, bool visible);
+
+	/*
+	 * on_present_complete(win)
+	 *
+	 * Called when the window system has finished reading a buffer passed to
+	 * glplatform_shm_win_present(). The buffer may be reused.
+	 *
+	 * win - Window
+	 *
+	 */
+	void (*on_present_complete)(struct glplatform_win *);
+
 #ifndef _WIN32
 	/*
 	 * on_x_event(event)
@@ -196,6 +222,25 @@ struct glplatform_win_callbacks {
 #endif
 };
 
+enum glplatform_visibility_policy {
+	//
+	// Swap invisible windows normally (default)
+	//
+	GLPLATFORM_VISIBILITY_RENDER,
+
+	//
+	// Swaps of invisible windows return immediately without swapping
+	//
+	GLPLATFORM_VISIBILITY_SKIP_SWAP,
+
+	//
+	// Swaps of invisible windows are skipped and block for up to 100ms or
+	// until window system events arrive. This limits a render loop driving
+	// only invisible windows to a low rate.
+	//
+	GLPLATFORM_VISIBILITY_THROTTLE
+};
+
 struct glplatform_fbformat {
 	int color_bits;
 	int alpha_bits;
@@ -216,9 +261,18 @@ struct glplatform_win {
 	uint32_t glx_window; //GLXWindow
 	int x_state_mask;
 	uint32_t colormap; //Colormap
+	void *shm_surface;
+	int64_t swap_target_msc;
+	int64_t swap_sbc;
 #endif
 	bool fullscreen;
 	bool show_cursor;
+	bool mapped;
+	bool obscured;
+	bool low_latency;
+	int swap_interval;
+	struct glplatform_frame_limiter *frame_limiter;
+	enum glplatform_visibility_policy visibility_policy;
 	struct glplatform_fbformat fbformat;
 	struct glplatform_win_callbacks callbacks;
 	int width;
@@ -283,6 +337,162 @@ struct glplatform_win *glplatform_create_window(const char *title,
 		int width,
 		int height);
 
+/*
+ * glplatform_create_shm_window()
+ *
+ * Create a window for presenting CPU rendered frames without OpenGL. Frames
+ * are written to one of two buffers shared with the X server through the MIT-SHM
+ * extension and presented with glplatform_shm_win_present() without further
+ * copies. The window uses the same callbacks and event processing as windows
+ * created with glplatform_create_window() but OpenGL contexts can't be used with
+ * it and glplatform_swap_buffers() must not be called on it.
+ *
+ * Returns NULL if the window could not be created or the X server does not
+ * support MIT-SHM, which is the case for remote displays. Always returns NULL
+ * on Windows.
+ *
+ */
+struct glplatform_win *glplatform_create_shm_window(const char *title,
+		const struct glplatform_win_callbacks *callbacks,
+		int width, int height);
+
+/*
+ * glplatform_shm_win_get_buffer()
+ *
+ * Get the buffer to write the next frame of a window created with
+ * glplatform_create_shm_window() to. The buffer is in the X server's default
+ * visual format, typically 32-bit pixels with blue in the least significant byte.
+ * It is reallocated when the window size changes so it's contents are undefined.
+ *
+ * width, height - Set to the buffer dimentions
+ *
+ * stride - Set to the number of bytes between rows
+ *
+ * Returns NULL if the buffer is still being read by the X server. Wait for the
+ * on_present_complete callback before trying again.
+ *
+ */
+void *glplatform_shm_win_get_buffer(struct glplatform_win *win, int *width, int *height, int *stride);
+
+/*
+ * glplatform_shm_win_present()
+ *
+ * Present the buffer returned by glplatform_shm_win_get_buffer() and make the
+ * other buffer the target of the next frame. on_present_complete will be called
+ * from glplatform_process_events() when the X server is done with the buffer.
+ *
+ * Returns false if there is no buffer to present.
+ *
+ */
+bool glplatform_shm_win_present(struct glplatform_win *win);
+
+//
+// X pixmap or window contents wrapped as an OpenGL texture. Only the
+// fields in the first group may be read by the application.
+//
+struct glplatform_pixmap_texture {
+	int width;
+	int height;
+
+	/* Row 0 of the texture is the top row of the pixmap */
+	bool y_inverted;
+
+	/* The drawable was damaged since it was last bound */
+	bool dirty;
+
+	bool bound;
+	uint32_t pixmap; //Pixmap
+	uint32_t glx_pixmap; //GLXPixmap
+	uint32_t window; //Window xid when wrapping a redirected window
+	uint32_t damage; //Damage
+	struct glplatform_pixmap_texture *next;
+};
+
+/*
+ * glplatform_create_pixmap_texture()
+ *
+ * Wrap an X pixmap so it's contents can be used as an OpenGL texture without
+ * copying them through the client. Requires GLX_EXT_texture_from_pixmap. The
+ * pixmap must stay valid for the lifetime of the returned object.
+ *
+ * pixmap - Pixmap xid
+ *
+ * Returns NULL if the pixmap can't be bound to a texture. Always returns NULL
+ * on Windows.
+ *
+ */
+struct glplatform_pixmap_texture *glplatform_create_pixmap_texture(intptr_t pixmap);
+
+/*
+ * glplatform_create_window_texture()
+ *
+ * Like glplatform_create_pixmap_texture() but wraps another client's window.
+ * The window is redirected with the Composite extension (it stays visible on
+ * screen) and the wrapper follows the window's storage when it is resized.
+ *
+ * xid - Window xid
+ *
+ * Returns NULL if the window can't be wrapped or glplatform was built without
+ * Xcomposite.
+ *
+ */
+struct glplatform_pixmap_texture *glplatform_create_window_texture(intptr_t xid);
+
+/*
+ * glplatform_destroy_pixmap_texture()
+ *
+ * Release the wrapper. A wrapped window is unredirected.
+ *
+ */
+void glplatform_destroy_pixmap_texture(struct glplatform_pixmap_texture *ptex);
+
+/*
+ * glplatform_pixmap_texture_bind()
+ *
+ * Bind the drawable's contents to the texture currently bound to GL_TEXTURE_2D
+ * in the current context and clear the 'dirty' flag. The contents may be
+ * copied at this point so the texture must be rebound to see later updates.
+ * When glplatform is built with Xdamage 'dirty' is set from
+ * glplatform_process_events() when the drawable changes, otherwise it stays
+ * false after the first bind.
+ *
+ * Returns false if the drawable is no longer available.
+ *
+ */
+bool glplatform_pixmap_texture_bind(struct glplatform_pixmap_texture *ptex);
+
+/*
+ * glplatform_pixmap_texture_release()
+ *
+ * Release the drawable from the texture. Should be called once rendering with
+ * the texture for the frame has been submitted.
+ *
+ */
+void glplatform_pixmap_texture_release(struct glplatform_pixmap_texture *ptex);
+
+/*
+ * glplatform_pool_windows()
+ *
+ * Keep 'count' hidden windows with framebuffer format 'fbformat' ready
+ * for reuse. glplatform_create_window() takes windows from the pool when
+ * one with the requested format is available which leaves only renaming
+ * and resizing the window to be done. glplatform_destroy_window() returns
+ * windows to the pool while it holds fewer than 'count' windows.
+ * Passing a count of zero releases the pooled windows.
+ *
+ * The framebuffer configuration, visual and colormap for a format are
+ * cached on first use regardless of pooling.
+ *
+ * fbformat - Format of pooled windows. If NULL the default format used by
+ * 	glplatform_create_window() is pooled.
+ *
+ * Returns the number of windows in the pool or -1 if the format is not
+ * supported. Windows pooling isn't implemented on Windows where this
+ * always returns 0.
+ *
+ */
+int glplatform_pool_windows(const struct glplatform_fbformat *fbformat, int count);
+
 /*
  * glplatform_destroy_window
  *
@@ -330,11 +540,29 @@ int glplatform_get_events(bool block);
  * glplatform_make_current()
  *
  * Make 'context' current for this thread. All subsequent OpenGL calls
- * in the current thread will execute in this context.
+ * in the current thread will execute in this context. If 'context' is
+ * already current in this thread with the same window the call returns
+ * without involving the window system. 'win' must be NULL for contexts
+ * created with glplatform_create_offscreen_context().
  *
  */
 void glplatform_make_current(struct glplatform_win *win, glplatform_gl_context_t context);
 
+/*
+ * glplatform_glcore_init_lazy()
+ *
+ * Alternative to glplatform_glcore_init() that binds the OpenGL entry
+ * points lazily. Every function pointer starts at a trampoline that
+ * resolves the real entry point on its first call, so startup does not
+ * pay for looking up entry points the application never calls. The
+ * extension flags reflect the extensions advertised by the context.
+ * Calling an entry point the driver doesn't provide aborts.
+ *
+ * Returns false if the context's version is lower than maj.min
+ *
+ */
+bool glplatform_glcore_init_lazy(int maj, int min);
+
 /*
  * glplatform_process_events()
  *
@@ -380,6 +608,185 @@ void glplatform_fd_unbind(int fd);
  */
 glplatform_gl_context_t glplatform_create_context(struct glplatform_win *win, int maj_ver, int min_ver);
 
+/*
+ * Context creation flags
+ *
+ * GLPLATFORM_CONTEXT_RELEASE_NONE - Don't flush the context when it is
+ * 	released by glplatform_make_current(). Requires
+ * 	GLX_ARB_context_flush_control or WGL_ARB_context_flush_control and is
+ * 	ignored if unavailable. Applications must call glFlush() themselves
+ * 	before results rendered in the context are consumed by a different
+ * 	context.
+ *
+ * GLPLATFORM_CONTEXT_NO_ERROR - Create a context without error checking
+ * 	(ARB_create_context_no_error). Invalid API usage has undefined results
+ * 	instead of generating GL errors, which removes validation overhead from
+ * 	every call. Ignored if unavailable or if combined with
+ * 	GLPLATFORM_CONTEXT_DEBUG or GLPLATFORM_CONTEXT_ROBUST.
+ *
+ * GLPLATFORM_CONTEXT_DEBUG - Create a debug context.
+ *
+ * GLPLATFORM_CONTEXT_ROBUST - Create a context with robust buffer access
+ * 	that is lost on GPU reset (ARB_create_context_robustness).
+ *
+ * GLPLATFORM_CONTEXT_FORWARD_COMPATIBLE - Create a forward compatible
+ * 	context.
+ *
+ */
+#define GLPLATFORM_CONTEXT_RELEASE_NONE (1 << 0)
+#define GLPLATFORM_CONTEXT_NO_ERROR (1 << 1)
+#define GLPLATFORM_CONTEXT_DEBUG (1 << 2)
+#define GLPLATFORM_CONTEXT_ROBUST (1 << 3)
+#define GLPLATFORM_CONTEXT_FORWARD_COMPATIBLE (1 << 4)
+
+struct glplatform_context_attribs {
+	/* Minimum OpenGL version required */
+	int maj_ver;
+	int min_ver;
+
+	/* Bitwise OR of GLPLATFORM_CONTEXT_* flags */
+	uint32_t flags;
+};
+
+/*
+ * glplatform_create_context_attribs()
+ *
+ * Attempts to create a core-profile OpenGL context as described by
+ * 'attribs'. Optional flags that the window system doesn't support are
+ * dropped rather than failing the creation, use glplatform_get_context_flags()
+ * to find out which flags were applied.
+ *
+ */
+glplatform_gl_context_t glplatform_create_context_attribs(struct glplatform_win *win, const struct glplatform_context_attribs *attribs);
+
+/*
+ * glplatform_create_context_flags()
+ *
+ * Same as glplatform_create_context() with additional creation flags.
+ *
+ * flags - Bitwise OR of GLPLATFORM_CONTEXT_* flags
+ *
+ */
+glplatform_gl_context_t glplatform_create_context_flags(struct glplatform_win *win, int maj_ver, int min_ver, uint32_t flags);
+
+/*
+ * glplatform_create_offscreen_context()
+ *
+ * Create a context that is not tied to a window, backed by a small pbuffer.
+ * It is made current by passing NULL as the window to glplatform_make_current().
+ * Useful for worker threads that create or upload OpenGL objects.
+ *
+ * attribs - Context version and flags, see glplatform_create_context_attribs()
+ *
+ * share - Context to share objects with or 0
+ *
+ * Returns 0 on failure. Not implemented on Windows where it always returns 0.
+ *
+ */
+glplatform_gl_context_t glplatform_create_offscreen_context(const struct glplatform_context_attribs *attribs, glplatform_gl_context_t share);
+
+/*
+ * glplatform_destroy_context()
+ *
+ * Destroy a context. If it is current in the calling thread it is released
+ * first. It must not be current in any other thread.
+ *
+ * The context's remaining streaming buffers and upload queues are destroyed
+ * with it, as is its text renderer, which invalidates typefaces obtained with
+ * the context current. Their OpenGL objects are only deleted if the context
+ * is current in the calling thread, otherwise they go away with the context.
+ *
+ */
+void glplatform_destroy_context(glplatform_gl_context_t context);
+
+/*
+ * glplatform_get_context_flags()
+ *
+ * Returns the GLPLATFORM_CONTEXT_* flags that were in effect when
+ * 'context' was created.
+ *
+ */
+uint32_t glplatform_get_context_flags(glplatform_gl_context_t context);
+
+struct glplatform_make_current_stats {
+	/* Calls to glplatform_make_current() */
+	uint64_t calls;
+
+	/* Calls that reached the window system */
+	uint64_t switches;
+
+	/* Calls skipped because the context and window were already current */
+	uint64_t elided;
+};
+
+/*
+ * glplatform_get_make_current_stats()
+ *
+ * Read the process wide glplatform_make_current() counters.
+ *
+ */
+void glplatform_get_make_current_stats(struct glplatform_make_current_stats *stats);
+
+#define GLPLATFORM_STATS_X_EVENT_TYPES 64
+
+struct glplatform_stats {
+	/* X events processed, indexed by event type. Types past the end of the
+	 * array, such as extension events, are counted in the last entry */
+	uint64_t x_events[GLPLATFORM_STATS_X_EVENT_TYPES];
+
+	/* File descriptor events dispatched by glplatform_process_events() */
+	uint64_t fd_events;
+
+	/* Window callbacks and file descriptor handlers invoked */
+	uint64_t callbacks;
+
+	/* glplatform_get_events() calls that returned new events */
+	uint64_t epoll_wakeups;
+
+	/* glplatform_make_current() calls and the ones that reached the window system */
+	uint64_t make_current_calls;
+	uint64_t make_current_switches;
+
+	/* Buffer swaps issued to the window system */
+	uint64_t swaps;
+
+	/* Glyphs mapped by gltext_prepare_render() and drawn by gltext_submit_render() */
+	uint64_t glyphs_prepared;
+	uint64_t glyphs_submitted;
+
+	/* Bytes written through streaming buffers */
+	uint64_t stream_bytes;
+
+	/* Fonts currently loaded and the size of their resident atlas textures */
+	uint64_t fonts;
+	uint64_t atlas_bytes;
+};
+
+/*
+ * glplatform_get_stats()
+ *
+ * Read the process wide runtime counters. The counters are updated with
+ * relaxed atomics so a snapshot taken while other threads are running may
+ * be slightly inconsistent between fields. The X event and epoll counters
+ * stay at zero on Windows.
+ *
+ */
+void glplatform_get_stats(struct glplatform_stats *stats);
+
+/*
+ * glplatform_trace_write()
+ *
+ * Write the internal spans recorded by all threads (event waits, event
+ * dispatch, context switches, swaps, text rendering) to 'path' as Chrome
+ * trace event JSON, which chrome://tracing and the Perfetto UI can open. Each
+ * thread keeps its most recent 16384 spans. Only available when glplatform is
+ * configured with --enable-trace, otherwise no spans are recorded.
+ *
+ * Returns false if tracing isn't built or the file can't be written.
+ *
+ */
+bool glplatform_trace_write(const char *path);
+
 enum glplatform_win_types {
 	GLWIN_POPUP,
 	GLWIN_NORMAL,
@@ -406,6 +813,28 @@ void glplatform_set_win_type(struct glplatform_win *win, enum glplatform_win_typ
  */
 void glplatform_set_win_transient_for(struct glplatform_win *win, intptr_t xid);
 
+/*
+ * glplatform_win_is_visible()
+ *
+ * Returns true if the window is mapped and not minimized or known to be
+ * fully covered by other windows. Compositing window managers typically
+ * don't report occlusion so a covered window may still be considered
+ * visible.
+ *
+ */
+bool glplatform_win_is_visible(struct glplatform_win *win);
+
+/*
+ * glplatform_set_visibility_policy()
+ *
+ * Select how glplatform_swap_buffers() and glplatform_swap_buffers_multi()
+ * treat the window while it is invisible. See enum glplatform_visibility_policy.
+ * Applications can also check glplatform_win_is_visible() to skip rendering
+ * to windows whose swaps will be dropped.
+ *
+ */
+void glplatform_set_visibility_policy(struct glplatform_win *win, enum glplatform_visibility_policy policy);
+
 /*
  * glplatform_swap_buffers()
  *
@@ -414,6 +843,32 @@ void glplatform_set_win_transient_for(struct glplatform_win *win, intptr_t xid);
  */
 void glplatform_swap_buffers(struct glplatform_win *win);
 
+/*
+ * glplatform_swap_buffers_multi()
+ *
+ * Swap the backbuffers of several windows. All swaps are issued before
+ * waiting on the window system once, rather than once per window as with
+ * repeated glplatform_swap_buffers() calls. On Linux when GLX_OML_sync_control
+ * is available each swap is scheduled for the next vertical blank of the
+ * display showing its window, so windows on the same display flip together.
+ *
+ * wins - Array of windows to swap
+ *
+ * count - Number of windows in 'wins'
+ *
+ * missed - Optional array of 'count' entries. Each entry is set to true if the
+ * 	window's swap issued by the PREVIOUS glplatform_swap_buffers_multi() call
+ * 	was still pending after the vertical blank it was scheduled for. The
+ * 	check doesn't wait for that swap, so a swap that completed late but
+ * 	before this call isn't reported. Always false when swaps can't be
+ * 	scheduled.
+ *
+ * Returns the number of windows whose swap from the previous call missed its
+ * vertical blank.
+ *
+ */
+int glplatform_swap_buffers_multi(struct glplatform_win **wins, int count, bool *missed);
+
 /*
  * glplatform_show_window()
  *
@@ -449,6 +904,61 @@ void glplatform_show_cursor(struct glplatform_win *win);
  */
 void glplatform_fullscreen_win(struct glplatform_win *win, bool fullscreen);
 
+/*
+ * glplatform_low_latency_fullscreen_win()
+ *
+ * Like glplatform_fullscreen_win() but additionally asks the compositing
+ * manager to stop compositing the window (_NET_WM_BYPASS_COMPOSITOR on Linux)
+ * and selects the swap interval with the least buffering the driver supports:
+ * adaptive vsync where late swaps tear if available, otherwise no vsync.
+ * Leaving low latency fullscreen restores a swap interval of 1.
+ *
+ * The window system applies these requests asynchronously. Once the window
+ * has been resized glplatform_get_presentation_info() reports the state of the
+ * requests, but not whether the compositor actually stopped compositing the
+ * window.
+ *
+ */
+void glplatform_low_latency_fullscreen_win(struct glplatform_win *win, bool enable);
+
+struct glplatform_presentation_info {
+	/* The window manager reports the window as fullscreen */
+	bool fullscreen;
+
+	/* Low latency fullscreen was requested for the window */
+	bool low_latency;
+
+	/* A compositing manager is running */
+	bool compositor_running;
+
+	/* The window manager advertises support for compositor bypass */
+	bool bypass_supported;
+
+	/*
+	 * The window asks the compositor to stop compositing it. This only
+	 * reports the request, X provides no way to query whether the
+	 * compositor honored it.
+	 */
+	bool bypass_requested;
+
+	/* Swap interval selected for the window. -1 means adaptive vsync */
+	int swap_interval;
+};
+
+/*
+ * glplatform_get_presentation_info()
+ *
+ * Query what was requested for the presentation of a window's swaps and what
+ * the window manager reports. Whether swaps actually bypass the compositor
+ * can't be queried, so bypass_requested only reflects the request. On Linux
+ * this reads the window's and the root window's properties and so requires
+ * round trips to the X server.
+ *
+ * Returns false if the information could not be retrieved.
+ *
+ */
+bool glplatform_get_presentation_info(struct glplatform_win *win, struct glplatform_presentation_info *info);
+
 /*
  * glplatform_is_button_pressed()
  *
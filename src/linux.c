@@ -2,6 +2,9 @@
 
 #include <X11/Xlib.h>
 #include <X11/Xatom.h>
+#include <X11/extensions/XShm.h>
+#include <sys/ipc.h>
+#include <sys/shm.h>
 #include <sys/epoll.h>
 #include <sys/resource.h>
 #include <stdlib.h>
@@ -10,8 +13,31 @@
 #include <pthread.h>
 #include <ctype.h>
 #include <unistd.h>
+#include <string.h>
+#include <poll.h>
 #include "glplatform-glx.h"
 #include "priv.h"
+#include "trace.h"
+
+#ifdef HAVE_LIBXCOMPOSITE
+#include <X11/extensions/Xcomposite.h>
+#endif
+
+#ifdef HAVE_LIBXDAMAGE
+#include <X11/extensions/Xdamage.h>
+#endif
+
+#ifndef GLX_TEXTURE_TARGET_EXT
+#define GLX_TEXTURE_TARGET_EXT 0x20d6
+#endif
+
+#ifndef GLX_Y_INVERTED_EXT
+#define GLX_Y_INVERTED_EXT 0x20d4
+#endif
+
+#ifndef GLX_CONTEXT_OPENGL_NO_ERROR_ARB
+#define GLX_CONTEXT_OPENGL_NO_ERROR_ARB 0x31b3
+#endif
 
 int glplatform_epoll_fd = -1;
 
@@ -28,6 +54,7 @@ static int g_glplatform_win_count = 0;
 
 struct fd_binding {
 	struct glplatform_win *win;
+	void (*handler)(int fd, uint32_t events, intptr_t user_data);
 	intptr_t user_data;
 };
 
@@ -37,6 +64,43 @@ static pthread_key_t g_context_tls;
 
 static Cursor g_empty_cursor;
 
+static int g_shm_completion_event = -1;
+
+#ifdef HAVE_LIBXDAMAGE
+static int g_damage_notify_event = -1;
+#endif
+
+static struct glplatform_pixmap_texture *g_pixmap_textures = NULL;
+
+#define WINDOW_EVENT_MASK (KeymapStateMask | \
+		KeyPressMask | \
+		ExposureMask | \
+		VisibilityChangeMask | \
+		KeyReleaseMask | \
+		ButtonPressMask | \
+		ButtonReleaseMask | \
+		PointerMotionMask | \
+		StructureNotifyMask | \
+		SubstructureNotifyMask)
+
+static bool g_oml_sync_control;
+
+static bool glx_has_extension(const char *name)
+{
+	const char *extensions = glXQueryExtensionsString(g_display, g_screen);
+	size_t len = strlen(name);
+	while (extensions && *extensions) {
+		const char *end = strchr(extensions, ' ');
+		size_t ext_len = end ? end - extensions : strlen(extensions);
+		if (ext_len == len && !strncmp(extensions, name, len))
+			return true;
+		if (!end)
+			break;
+		extensions = end + 1;
+	}
+	return false;
+}
+
 static struct glplatform_win *find_glplatform_win(Window w)
 {
 	struct glplatform_win *win = g_win_list;
@@ -110,6 +174,430 @@ bool glplatform_is_control_pressed(struct glplatform_win *win)
 	return win->x_state_mask & ControlMask;
 }
 
+//
+// Double buffered MIT-SHM surface for windows created with
+// glplatform_create_shm_window(). A buffer is busy from the time it is
+// passed to XShmPutImage() until the server's completion event for it
+// has been processed.
+//
+struct shm_buffer {
+	XShmSegmentInfo info;
+	XImage *image;
+	bool attached;
+	bool busy;
+};
+
+struct shm_surface {
+	struct shm_buffer buffers[2];
+	int back;
+	GC gc;
+	Visual *visual;
+	int depth;
+};
+
+static void shm_free_buffer(struct shm_buffer *buffer)
+{
+	if (buffer->attached)
+		XShmDetach(g_display, &buffer->info);
+	if (buffer->image)
+		XDestroyImage(buffer->image);
+	if (buffer->info.shmaddr && buffer->info.shmaddr != (char *)-1)
+		shmdt(buffer->info.shmaddr);
+	memset(buffer, 0, sizeof(struct shm_buffer));
+}
+
+static bool shm_alloc_buffer(struct shm_surface *surface, struct shm_buffer *buffer, int width, int height)
+{
+	memset(buffer, 0, sizeof(struct shm_buffer));
+	buffer->image = XShmCreateImage(g_display, surface->visual, surface->depth,
+			ZPixmap, NULL, &buffer->info, width, height);
+	if (!buffer->image)
+		goto error;
+
+	buffer->info.shmid = shmget(IPC_PRIVATE, buffer->image->bytes_per_line * buffer->image->height,
+			IPC_CREAT | 0600);
+	if (buffer->info.shmid == -1)
+		goto error;
+
+	buffer->info.shmaddr = buffer->image->data = (char *)shmat(buffer->info.shmid, NULL, 0);
+	buffer->info.readOnly = True;
+
+	// The segment is destroyed once both we and the X server have detached
+	shmctl(buffer->info.shmid, IPC_RMID, NULL);
+	if (buffer->info.shmaddr == (char *)-1)
+		goto error;
+
+	if (!XShmAttach(g_display, &buffer->info))
+		goto error;
+	buffer->attached = true;
+	return true;
+error:
+	if (buffer->image)
+		buffer->image->data = NULL;
+	shm_free_buffer(buffer);
+	return false;
+}
+
+static void shm_free_surface(struct shm_surface *surface)
+{
+	int i;
+	XSync(g_display, 0);
+	for (i = 0; i < 2; i++)
+		shm_free_buffer(surface->buffers + i);
+	if (surface->gc)
+		XFreeGC(g_display, surface->gc);
+	free(surface);
+}
+
+static void shm_present_complete(struct glplatform_win *win, XShmCompletionEvent *event)
+{
+	struct shm_surface *surface = (struct shm_surface *)win->shm_surface;
+	int i;
+	for (i = 0; i < 2; i++) {
+		if (surface->buffers[i].info.shmseg == event->shmseg)
+			surface->buffers[i].busy = false;
+	}
+	if (win->callbacks.on_present_complete) {
+		glplatform_count(&glplatform_counters.callbacks);
+		win->callbacks.on_present_complete(win);
+	}
+}
+
+struct glplatform_win *glplatform_create_shm_window(const char *title,
+		const struct glplatform_win_callbacks *callbacks,
+		int width, int height)
+{
+	if (g_shm_completion_event == -1)
+		return NULL;
+
+	struct shm_surface *surface = (struct shm_surface *)calloc(1, sizeof(struct shm_surface));
+	if (!surface)
+		return NULL;
+	surface->visual = DefaultVisual(g_display, g_screen);
+	surface->depth = DefaultDepth(g_display, g_screen);
+
+	XSetWindowAttributes w_attr;
+	w_attr.background_pixel = 0;
+	w_attr.border_pixel = 0;
+	w_attr.event_mask = WINDOW_EVENT_MASK;
+
+	Window window = XCreateWindow(g_display,
+			RootWindow(g_display, g_screen),
+			0, 0,
+			width, height,
+			0,
+			surface->depth,
+			InputOutput,
+			surface->visual,
+			CWBackPixel | CWBorderPixel | CWEventMask,
+			&w_attr);
+	if (!window)
+		goto error1;
+
+	Atom wm_atoms[] = { g_delete_atom };
+	XSetWMProtocols(g_display, window, wm_atoms, 1);
+	XStoreName(g_display, window, title);
+
+	surface->gc = XCreateGC(g_display, window, 0, NULL);
+	if (!surface->gc)
+		goto error2;
+
+	struct glplatform_win *win = (struct glplatform_win *) calloc(1, sizeof(struct glplatform_win));
+	if (!win)
+		goto error2;
+	win->callbacks = *callbacks;
+	win->width = width;
+	win->height = height;
+	win->window = window;
+	win->swap_interval = 1;
+	win->shm_surface = surface;
+
+	register_glplatform_win(win);
+	if (win->callbacks.on_create) {
+		glplatform_count(&glplatform_counters.callbacks);
+		win->callbacks.on_create(win);
+	}
+	return win;
+error2:
+	XDestroyWindow(g_display, window);
+error1:
+	shm_free_surface(surface);
+	return NULL;
+}
+
+void *glplatform_shm_win_get_buffer(struct glplatform_win *win, int *width, int *height, int *stride)
+{
+	struct shm_surface *surface = (struct shm_surface *)win->shm_surface;
+	struct shm_buffer *buffer = surface->buffers + surface->back;
+
+	if (buffer->busy)
+		return NULL;
+
+	if (!buffer->image || buffer->image->width != win->width || buffer->image->height != win->height) {
+		shm_free_buffer(buffer);
+		if (!shm_alloc_buffer(surface, buffer, win->width, win->height))
+			return NULL;
+	}
+	*width = buffer->image->width;
+	*height = buffer->image->height;
+	*stride = buffer->image->bytes_per_line;
+	return buffer->image->data;
+}
+
+bool glplatform_shm_win_present(struct glplatform_win *win)
+{
+	struct shm_surface *surface = (struct shm_surface *)win->shm_surface;
+	struct shm_buffer *buffer = surface->buffers + surface->back;
+
+	if (buffer->busy || !buffer->image)
+		return false;
+
+	if (!XShmPutImage(g_display, win->window, surface->gc, buffer->image,
+			0, 0, 0, 0, buffer->image->width, buffer->image->height, True))
+		return false;
+	XFlush(g_display);
+	buffer->busy = true;
+	surface->back ^= 1;
+	return true;
+}
+
+//
+// Find a GLXFBConfig that can be bound to a 2D texture from a pixmap of the
+// given depth.
+//
+static bool choose_pixmap_fb_config(int depth, GLXFBConfig *fb_config, int *texture_format, bool *y_inverted)
+{
+	int fb_attributes[] = {
+		GLX_DRAWABLE_TYPE, GLX_PIXMAP_BIT,
+		GLX_BIND_TO_TEXTURE_TARGETS_EXT, GLX_TEXTURE_2D_BIT_EXT,
+		GLX_DOUBLEBUFFER, False,
+		GLX_Y_INVERTED_EXT, (int)GLX_DONT_CARE,
+		None
+	};
+	int fb_count;
+	int i;
+	bool found = false;
+	GLXFBConfig *fb_config_a = glXChooseFBConfig(g_display, g_screen, fb_attributes, &fb_count);
+
+	for (i = 0; fb_config_a && i < fb_count && !found; i++) {
+		int value;
+		XVisualInfo *visual_info = glXGetVisualFromFBConfig(g_display, fb_config_a[i]);
+		if (!visual_info)
+			continue;
+		if (visual_info->depth == depth) {
+			if (depth == 32) {
+				glXGetFBConfigAttrib(g_display, fb_config_a[i], GLX_BIND_TO_TEXTURE_RGBA_EXT, &value);
+				*texture_format = GLX_TEXTURE_FORMAT_RGBA_EXT;
+			} else {
+				glXGetFBConfigAttrib(g_display, fb_config_a[i], GLX_BIND_TO_TEXTURE_RGB_EXT, &value);
+				*texture_format = GLX_TEXTURE_FORMAT_RGB_EXT;
+			}
+			if (value) {
+				*fb_config = fb_config_a[i];
+				glXGetFBConfigAttrib(g_display, fb_config_a[i], GLX_Y_INVERTED_EXT, &value);
+				*y_inverted = value ? true : false;
+				found = true;
+			}
+		}
+		XFree(visual_info);
+	}
+	if (fb_config_a)
+		XFree(fb_config_a);
+	return found;
+}
+
+static bool pixmap_texture_attach(struct glplatform_pixmap_texture *ptex, Pixmap pixmap)
+{
+	Window root;
+	int x, y;
+	unsigned int width, height, border, depth;
+	GLXFBConfig fb_config;
+	int texture_format;
+	bool y_inverted;
+
+	if (!XGetGeometry(g_display, pixmap, &root, &x, &y, &width, &height, &border, &depth))
+		return false;
+
+	if (!choose_pixmap_fb_config(depth, &fb_config, &texture_format, &y_inverted))
+		return false;
+
+	int pixmap_attributes[] = {
+		GLX_TEXTURE_TARGET_EXT, GLX_TEXTURE_2D_EXT,
+		GLX_TEXTURE_FORMAT_EXT, texture_format,
+		None
+	};
+	GLXPixmap glx_pixmap = glXCreatePixmap(g_display, fb_config, pixmap, pixmap_attributes);
+	if (!glx_pixmap)
+		return false;
+
+	ptex->pixmap = pixmap;
+	ptex->glx_pixmap = glx_pixmap;
+	ptex->width = width;
+	ptex->height = height;
+	ptex->y_inverted = y_inverted;
+	ptex->dirty = true;
+#ifdef HAVE_LIBXDAMAGE
+	if (g_damage_notify_event != -1)
+		ptex->damage = XDamageCreate(g_display, ptex->window ? ptex->window : pixmap, XDamageReportNonEmpty);
+#endif
+	return true;
+}
+
+static void pixmap_texture_detach(struct glplatform_pixmap_texture *ptex)
+{
+	if (ptex->bound)
+		glplatform_pixmap_texture_release(ptex);
+#ifdef HAVE_LIBXDAMAGE
+	if (ptex->damage)
+		XDamageDestroy(g_display, ptex->damage);
+#endif
+	ptex->damage = 0;
+	if (ptex->glx_pixmap)
+		glXDestroyPixmap(g_display, ptex->glx_pixmap);
+	ptex->glx_pixmap = 0;
+	if (ptex->window && ptex->pixmap)
+		XFreePixmap(g_display, ptex->pixmap);
+	ptex->pixmap = 0;
+}
+
+struct glplatform_pixmap_texture *glplatform_create_pixmap_texture(intptr_t pixmap)
+{
+	if (!GLPLATFORM_GLX_EXT_texture_from_pixmap || !glx_has_extension("GLX_EXT_texture_from_pixmap"))
+		return NULL;
+
+	struct glplatform_pixmap_texture *ptex = (struct glplatform_pixmap_texture *)calloc(1, sizeof(struct glplatform_pixmap_texture));
+	if (!ptex)
+		return NULL;
+
+	if (!pixmap_texture_attach(ptex, (Pixmap)pixmap)) {
+		free(ptex);
+		return NULL;
+	}
+	ptex->next = g_pixmap_textures;
+	g_pixmap_textures = ptex;
+	return ptex;
+}
+
+struct glplatform_pixmap_texture *glplatform_create_window_texture(intptr_t xid)
+{
+#ifdef HAVE_LIBXCOMPOSITE
+	int event_base, error_base;
+	if (!GLPLATFORM_GLX_EXT_texture_from_pixmap || !glx_has_extension("GLX_EXT_texture_from_pixmap"))
+		return NULL;
+	if (!XCompositeQueryExtension(g_display, &event_base, &error_base))
+		return NULL;
+
+	struct glplatform_pixmap_texture *ptex = (struct glplatform_pixmap_texture *)calloc(1, sizeof(struct glplatform_pixmap_texture));
+	if (!ptex)
+		return NULL;
+
+	//
+	// Automatic redirection keeps the window visible on screen while giving us
+	// access to its off-screen storage. The storage is replaced when the window
+	// is resized so we track its configure events.
+	//
+	ptex->window = (Window)xid;
+	XCompositeRedirectWindow(g_display, ptex->window, CompositeRedirectAutomatic);
+	XSelectInput(g_display, ptex->window, StructureNotifyMask);
+
+	Pixmap pixmap = XCompositeNameWindowPixmap(g_display, ptex->window);
+	if (!pixmap || !pixmap_texture_attach(ptex, pixmap)) {
+		if (pixmap)
+			XFreePixmap(g_display, pixmap);
+		XCompositeUnredirectWindow(g_display, ptex->window, CompositeRedirectAutomatic);
+		free(ptex);
+		return NULL;
+	}
+	ptex->next = g_pixmap_textures;
+	g_pixmap_textures = ptex;
+	return ptex;
+#else
+	return NULL;
+#endif
+}
+
+void glplatform_destroy_pixmap_texture(struct glplatform_pixmap_texture *ptex)
+{
+	struct glplatform_pixmap_texture **pos = &g_pixmap_textures;
+	while (*pos != ptex)
+		pos = &(*pos)->next;
+	*pos = ptex->next;
+
+	pixmap_texture_detach(ptex);
+#ifdef HAVE_LIBXCOMPOSITE
+	if (ptex->window)
+		XCompositeUnredirectWindow(g_display, ptex->window, CompositeRedirectAutomatic);
+#endif
+	free(ptex);
+}
+
+bool glplatform_pixmap_texture_bind(struct glplatform_pixmap_texture *ptex)
+{
+	if (!ptex->glx_pixmap)
+		return false;
+	if (ptex->bound)
+		glXReleaseTexImageEXT(g_display, ptex->glx_pixmap, GLX_FRONT_LEFT_EXT);
+	glXBindTexImageEXT(g_display, ptex->glx_pixmap, GLX_FRONT_LEFT_EXT, NULL);
+	ptex->bound = true;
+	ptex->dirty = false;
+	return true;
+}
+
+void glplatform_pixmap_texture_release(struct glplatform_pixmap_texture *ptex)
+{
+	if (!ptex->bound)
+		return;
+	glXReleaseTexImageEXT(g_display, ptex->glx_pixmap, GLX_FRONT_LEFT_EXT);
+	ptex->bound = false;
+}
+
+//
+// Process events for drawables wrapped by glplatform_pixmap_texture's
+//
+static void handle_pixmap_texture_event(XEvent *event)
+{
+	struct glplatform_pixmap_texture *ptex = g_pixmap_textures;
+#ifdef HAVE_LIBXDAMAGE
+	if (event->type == g_damage_notify_event) {
+		XDamageNotifyEvent *damage_event = (XDamageNotifyEvent *)event;
+		for (; ptex; ptex = ptex->next) {
+			if (ptex->damage == damage_event->damage) {
+				XDamageSubtract(g_display, ptex->damage, None, None);
+				ptex->dirty = true;
+			}
+		}
+		return;
+	}
+#endif
+#ifdef HAVE_LIBXCOMPOSITE
+	if (event->type == ConfigureNotify) {
+		XConfigureEvent *configure_event = (XConfigureEvent *)event;
+		for (; ptex; ptex = ptex->next) {
+			if (ptex->window != configure_event->window)
+				continue;
+			if (ptex->width == configure_event->width && ptex->height == configure_event->height)
+				continue;
+			pixmap_texture_detach(ptex);
+			Pixmap pixmap = XCompositeNameWindowPixmap(g_display, ptex->window);
+			if (pixmap && !pixmap_texture_attach(ptex, pixmap))
+				XFreePixmap(g_display, pixmap);
+		}
+	}
+#endif
+}
+
+static void set_win_visibility(struct glplatform_win *win, bool mapped, bool obscured)
+{
+	bool was_visible = glplatform_win_is_visible(win);
+	win->mapped = mapped;
+	win->obscured = obscured;
+	bool visible = glplatform_win_is_visible(win);
+	if (visible != was_visible && win->callbacks.on_visibility_change) {
+		glplatform_count(&glplatform_counters.callbacks);
+		win->callbacks.on_visibility_change(win, visible);
+	}
+}
+
 static int handle_x_event(struct glplatform_win *win, XEvent *event)
 {
 	switch (event->type) {
@@ -121,8 +609,10 @@ static int handle_x_event(struct glplatform_win *win, XEvent *event)
 		if (win->width != configure_event->width || win->height != configure_event->height) {
 			win->width = configure_event->width;
 			win->height = configure_event->height;
-			if (win->callbacks.on_resize)
+			if (win->callbacks.on_resize) {
+				glplatform_count(&glplatform_counters.callbacks);
 				win->callbacks.on_resize(win);
+			}
 		}
 	} break;
 	case KeyPress: {
@@ -133,8 +623,10 @@ static int handle_x_event(struct glplatform_win *win, XEvent *event)
 		XKeyEvent key_event_copy = *((XKeyEvent *)event);
 		key_event_copy.state = 0;
 		XLookupString(&key_event_copy, buf, 20, &k, NULL);
-		if (win->callbacks.on_key_down)
+		if (win->callbacks.on_key_down) {
+			glplatform_count(&glplatform_counters.callbacks);
 			win->callbacks.on_key_down(win, toupper(k));
+		}
 	} break;
 	case KeyRelease: {
 		char buf[20];
@@ -144,8 +636,10 @@ static int handle_x_event(struct glplatform_win *win, XEvent *event)
 		XKeyEvent key_event_copy = *((XKeyEvent *)event);
 		key_event_copy.state = 0;
 		XLookupString(&key_event_copy, buf, 20, &k, NULL);
-		if (win->callbacks.on_key_up)
+		if (win->callbacks.on_key_up) {
+			glplatform_count(&glplatform_counters.callbacks);
 			win->callbacks.on_key_up(win, toupper(k));
+		}
 	} break;
 	case ButtonPress: {
 		XButtonEvent *button_event = (XButtonEvent *)event;
@@ -154,16 +648,22 @@ static int handle_x_event(struct glplatform_win *win, XEvent *event)
 		case 1:
 		case 2:
 		case 3:
-			if (win->callbacks.on_mouse_button_down)
+			if (win->callbacks.on_mouse_button_down) {
+				glplatform_count(&glplatform_counters.callbacks);
 				win->callbacks.on_mouse_button_down(win, button_event->button, button_event->x, button_event->y);
+			}
 			break;
 		case 4:
-			if (win->callbacks.on_mouse_wheel)
+			if (win->callbacks.on_mouse_wheel) {
+				glplatform_count(&glplatform_counters.callbacks);
 				win->callbacks.on_mouse_wheel(win, button_event->x, button_event->y, -1);
+			}
 			break;
 		case 5:
-			if (win->callbacks.on_mouse_wheel)
+			if (win->callbacks.on_mouse_wheel) {
+				glplatform_count(&glplatform_counters.callbacks);
 				win->callbacks.on_mouse_wheel(win, button_event->x, button_event->y, 1);
+			}
 			break;
 		}
 	} break;
@@ -174,37 +674,61 @@ static int handle_x_event(struct glplatform_win *win, XEvent *event)
 		case 1:
 		case 2:
 		case 3:
-			if (win->callbacks.on_mouse_button_up)
+			if (win->callbacks.on_mouse_button_up) {
+				glplatform_count(&glplatform_counters.callbacks);
 				win->callbacks.on_mouse_button_up(win, button_event->button, button_event->x, button_event->y);
+			}
 			break;
 		}
 	} break;
 	case MotionNotify: {
 		XMotionEvent *motion_event = (XMotionEvent *)event;
 		win->x_state_mask = motion_event->state;
-		if (win->callbacks.on_mouse_move)
+		if (win->callbacks.on_mouse_move) {
+			glplatform_count(&glplatform_counters.callbacks);
 			win->callbacks.on_mouse_move(win,
 				motion_event->x,
 				motion_event->y);
+		}
 	} break;
 	case Expose: {
 		XExposeEvent *expose_event = (XExposeEvent *)event;
 		if (expose_event->count == 0) {
-			if(win->callbacks.on_expose)
+			if (win->callbacks.on_expose) {
+				glplatform_count(&glplatform_counters.callbacks);
 				win->callbacks.on_expose(win);
+			}
 		}
 	} break;
+	case MapNotify: {
+		if (event->xmap.window == win->window)
+			set_win_visibility(win, true, win->obscured);
+	} break;
+	case UnmapNotify: {
+		if (event->xunmap.window == win->window)
+			set_win_visibility(win, false, win->obscured);
+	} break;
+	case VisibilityNotify: {
+		XVisibilityEvent *visibility_event = (XVisibilityEvent *)event;
+		set_win_visibility(win, win->mapped, visibility_event->state == VisibilityFullyObscured);
+	} break;
 	case ClientMessage: {
 		XClientMessageEvent *client_event = (XClientMessageEvent *)event;
 		if (client_event->data.l[0] == g_delete_atom)
-			if (win->callbacks.on_destroy)
+			if (win->callbacks.on_destroy) {
+				glplatform_count(&glplatform_counters.callbacks);
 				win->callbacks.on_destroy(win);
+			}
 	} break;
 	default:
+		if (event->type == g_shm_completion_event && win->shm_surface)
+			shm_present_complete(win, (XShmCompletionEvent *)event);
 		break;
 	}
-	if (win->callbacks.on_x_event)
+	if (win->callbacks.on_x_event) {
+		glplatform_count(&glplatform_counters.callbacks);
 		win->callbacks.on_x_event(win, event);
+	}
 	return 0;
 }
 
@@ -229,6 +753,9 @@ bool glplatform_init()
 	if (glplatform_epoll_fd == -1)
 		goto error1;
 
+	//Contexts may be made current in other threads, e.g. by loader threads,
+	//so Xlib must lock the display connection
+	XInitThreads();
 	g_display = XOpenDisplay(NULL);
 	if (g_display == NULL)
 		goto error2;
@@ -275,6 +802,18 @@ bool glplatform_init()
 
 	g_screen = DefaultScreen(g_display);
 	g_delete_atom = XInternAtom(g_display, "WM_DELETE_WINDOW", True);
+	g_oml_sync_control = GLPLATFORM_GLX_OML_sync_control && glx_has_extension("GLX_OML_sync_control");
+#ifdef HAVE_LIBXDAMAGE
+	int damage_event_base, damage_error_base;
+	if (XDamageQueryExtension(g_display, &damage_event_base, &damage_error_base))
+		g_damage_notify_event = damage_event_base + XDamageNotify;
+	else
+		g_damage_notify_event = -1;
+#endif
+	if (XShmQueryExtension(g_display))
+		g_shm_completion_event = XShmGetEventBase(g_display) + ShmCompletion;
+	else
+		g_shm_completion_event = -1;
 	return true;
 error3:
 	XCloseDisplay(g_display);
@@ -288,40 +827,67 @@ error1:
 	return false;
 }
 
-void glplatform_shutdown()
+//
+// X resources that only depend on the framebuffer format are created
+// once per format and shared by all windows using it. Hidden windows
+// kept for reuse by glplatform_create_window() hang off the same entry.
+//
+struct pooled_window {
+	Window window;
+	GLXWindow glx_window;
+	struct pooled_window *next;
+};
+
+struct fbformat_cache {
+	struct glplatform_fbformat fbformat;
+	GLXFBConfig fb_config;
+	XVisualInfo *visual_info;
+	Colormap colormap;
+	struct pooled_window *pool;
+	int pool_size;
+	int pool_target;
+	struct fbformat_cache *next;
+};
+
+static struct fbformat_cache *g_fbformat_cache = NULL;
+
+static const struct glplatform_fbformat g_default_fbformat = {
+	.color_bits = 24,
+	.alpha_bits = 8,
+	.stencil_bits = 8,
+	.depth_bits = 24,
+	.accum_bits = 0
+};
+
+static bool fbformat_equal(const struct glplatform_fbformat *a, const struct glplatform_fbformat *b)
 {
-	XCloseDisplay(g_display);
-	close(glplatform_epoll_fd);
-	pthread_key_delete(g_context_tls);
-	g_display = NULL;
-	g_context_tls = 0;
-	glplatform_epoll_fd = -1;
+	return a->color_bits == b->color_bits &&
+		a->alpha_bits == b->alpha_bits &&
+		a->stencil_bits == b->stencil_bits &&
+		a->depth_bits == b->depth_bits &&
+		a->accum_bits == b->accum_bits;
 }
 
-struct glplatform_win *glplatform_create_window(const char *title,
-		const struct glplatform_win_callbacks *callbacks,
-		const struct glplatform_fbformat *fbformat,
-		int width, int height)
+static struct fbformat_cache *find_fbformat_cache(const struct glplatform_fbformat *fbformat)
 {
-	static struct glplatform_fbformat default_fbformat = {
-		.color_bits = 24,
-		.alpha_bits = 8,
-		.stencil_bits = 8,
-		.depth_bits = 24,
-		.accum_bits = 0
-	};
-
-	if (fbformat == NULL) {
-		fbformat = &default_fbformat;
+	struct fbformat_cache *cache = g_fbformat_cache;
+	while (cache) {
+		if (fbformat_equal(&cache->fbformat, fbformat))
+			return cache;
+		cache = cache->next;
 	}
+	return NULL;
+}
+
+static struct fbformat_cache *get_fbformat_cache(const struct glplatform_fbformat *fbformat)
+{
+	struct fbformat_cache *cache = find_fbformat_cache(fbformat);
+	if (cache)
+		return cache;
 
 	if (fbformat->color_bits % 3)
 		return NULL;
 
-	GLXFBConfig fb_config;
-	Window window;
-	GLXWindow glx_window;
-
 	int fb_attributes[] = {
 		/* attribute/value pairs */
 		GLX_DRAWABLE_TYPE, GLX_WINDOW_BIT,
@@ -339,81 +905,207 @@ struct glplatform_win *glplatform_create_window(const char *title,
 		None
 	};
 
-	XVisualInfo *visual_info = NULL;
 	int fb_count;
-	GLXFBConfig *fb_config_a = NULL;
-
-	fb_config_a = glXChooseFBConfig(g_display, g_screen, fb_attributes, &fb_count);
+	GLXFBConfig *fb_config_a = glXChooseFBConfig(g_display, g_screen, fb_attributes, &fb_count);
 
-	if (fb_count == 0) {
+	if (!fb_config_a || fb_count == 0) {
+		if (fb_config_a)
+			XFree(fb_config_a);
 		return NULL;
 	}
 
-	fb_config = fb_config_a[0];
+	cache = (struct fbformat_cache *)calloc(1, sizeof(struct fbformat_cache));
+	if (!cache) {
+		XFree(fb_config_a);
+		return NULL;
+	}
+	cache->fbformat = *fbformat;
+	cache->fb_config = fb_config_a[0];
 	XFree(fb_config_a);
 
-	visual_info = glXGetVisualFromFBConfig(g_display, fb_config);
+	cache->visual_info = glXGetVisualFromFBConfig(g_display, cache->fb_config);
+	if (!cache->visual_info) {
+		free(cache);
+		return NULL;
+	}
+	cache->colormap = XCreateColormap(g_display, RootWindow(g_display, g_screen), cache->visual_info->visual, AllocNone);
+	cache->next = g_fbformat_cache;
+	g_fbformat_cache = cache;
+	return cache;
+}
 
+static bool create_x_window(struct fbformat_cache *cache, int width, int height, Window *window_ret, GLXWindow *glx_window_ret)
+{
 	XSetWindowAttributes w_attr;
-	Colormap colormap = XCreateColormap(g_display, RootWindow(g_display, g_screen), visual_info->visual, AllocNone);
 	w_attr.background_pixel = 0;
 	w_attr.border_pixel = 0;
-	w_attr.colormap = colormap;
-	w_attr.event_mask = KeymapStateMask |
-		     KeyPressMask |
-		     ExposureMask |
-		     KeyReleaseMask |
-		     ButtonPressMask |
-		     ButtonReleaseMask |
-		     PointerMotionMask |
-		     StructureNotifyMask |
-		     SubstructureNotifyMask;
-
-	window = XCreateWindow(g_display,
+	w_attr.colormap = cache->colormap;
+	w_attr.event_mask = WINDOW_EVENT_MASK;
+
+	Window window = XCreateWindow(g_display,
 			RootWindow(g_display, g_screen), /* parent */
 			0, 0,    /* position */
 			width, height, /* size */
 			0, /* border width */
-			visual_info->depth, /* depth */
+			cache->visual_info->depth, /* depth */
 			InputOutput, /* class */
-			visual_info->visual,
+			cache->visual_info->visual,
 			CWBackPixel | CWColormap | CWBorderPixel | CWEventMask, /* attribute valuemask */
 			&w_attr);        /*attributes */
 
-	XFree(visual_info);
-
-	if (!window) {
-		XFreeColormap(g_display, colormap);
-		return NULL;
-	}
-
-	XStoreName(g_display, window, title);
+	if (!window)
+		return false;
 
 	//Tell X that we want to process delete window client messages
 	Atom wm_atoms[] = { g_delete_atom };
 	XSetWMProtocols(g_display, window, wm_atoms, 1);
 
-	glx_window = glXCreateWindow(g_display, fb_config, window, NULL);
+	GLXWindow glx_window = glXCreateWindow(g_display, cache->fb_config, window, NULL);
 
 	if (!glx_window) {
 		XDestroyWindow(g_display, window);
-		XFreeColormap(g_display, colormap);
+		return false;
+	}
+	*window_ret = window;
+	*glx_window_ret = glx_window;
+	return true;
+}
+
+static void destroy_x_window(Window window, GLXWindow glx_window)
+{
+	glXDestroyWindow(g_display, glx_window);
+	XSync(g_display, 0);
+	XDestroyWindow(g_display, window);
+}
+
+//
+// Put a window back in the state create_x_window() returns it in so the
+// next user of a pooled window doesn't inherit properties from the last.
+//
+static void reset_x_window(Window window)
+{
+	XEvent event;
+	XUnmapWindow(g_display, window);
+	XDefineCursor(g_display, window, None);
+	XDeleteProperty(g_display, window, XInternAtom(g_display, "_NET_WM_WINDOW_TYPE", False));
+	XDeleteProperty(g_display, window, XInternAtom(g_display, "_NET_WM_STATE", False));
+	XDeleteProperty(g_display, window, XA_WM_TRANSIENT_FOR);
+	XDeleteProperty(g_display, window, XInternAtom(g_display, "_NET_WM_BYPASS_COMPOSITOR", False));
+	XSync(g_display, 0);
+	while (XCheckWindowEvent(g_display, window, ~0L, &event) == True)
+		;
+}
+
+int glplatform_pool_windows(const struct glplatform_fbformat *fbformat, int count)
+{
+	if (fbformat == NULL)
+		fbformat = &g_default_fbformat;
+
+	struct fbformat_cache *cache = get_fbformat_cache(fbformat);
+	if (!cache)
+		return -1;
+
+	cache->pool_target = count;
+	while (cache->pool_size < count) {
+		struct pooled_window *pooled = (struct pooled_window *)malloc(sizeof(struct pooled_window));
+		if (!pooled)
+			break;
+		if (!create_x_window(cache, 1, 1, &pooled->window, &pooled->glx_window)) {
+			free(pooled);
+			break;
+		}
+		pooled->next = cache->pool;
+		cache->pool = pooled;
+		cache->pool_size++;
+	}
+	while (cache->pool_size > count) {
+		struct pooled_window *pooled = cache->pool;
+		cache->pool = pooled->next;
+		cache->pool_size--;
+		destroy_x_window(pooled->window, pooled->glx_window);
+		free(pooled);
+	}
+	return cache->pool_size;
+}
+
+static void free_fbformat_caches()
+{
+	while (g_fbformat_cache) {
+		struct fbformat_cache *cache = g_fbformat_cache;
+		g_fbformat_cache = cache->next;
+		while (cache->pool) {
+			struct pooled_window *pooled = cache->pool;
+			cache->pool = pooled->next;
+			destroy_x_window(pooled->window, pooled->glx_window);
+			free(pooled);
+		}
+		XFreeColormap(g_display, cache->colormap);
+		XFree(cache->visual_info);
+		free(cache);
+	}
+}
+
+void glplatform_shutdown()
+{
+	free_fbformat_caches();
+	XCloseDisplay(g_display);
+	close(glplatform_epoll_fd);
+	pthread_key_delete(g_context_tls);
+	g_display = NULL;
+	g_context_tls = 0;
+	glplatform_epoll_fd = -1;
+}
+
+struct glplatform_win *glplatform_create_window(const char *title,
+		const struct glplatform_win_callbacks *callbacks,
+		const struct glplatform_fbformat *fbformat,
+		int width, int height)
+{
+	if (fbformat == NULL) {
+		fbformat = &g_default_fbformat;
+	}
+
+	struct fbformat_cache *cache = get_fbformat_cache(fbformat);
+	if (!cache)
+		return NULL;
+
+	Window window;
+	GLXWindow glx_window;
+
+	if (cache->pool) {
+		struct pooled_window *pooled = cache->pool;
+		cache->pool = pooled->next;
+		cache->pool_size--;
+		window = pooled->window;
+		glx_window = pooled->glx_window;
+		free(pooled);
+		XResizeWindow(g_display, window, width, height);
+	} else if (!create_x_window(cache, width, height, &window, &glx_window)) {
 		return NULL;
 	}
 
-	struct glplatform_win *win = (struct glplatform_win *) malloc(sizeof(struct glplatform_win));
+	XStoreName(g_display, window, title);
+
+	struct glplatform_win *win = (struct glplatform_win *) calloc(1, sizeof(struct glplatform_win));
+	if (!win) {
+		destroy_x_window(window, glx_window);
+		return NULL;
+	}
 	win->fbformat = *fbformat;
 	win->callbacks = *callbacks;
 	win->width = width;
 	win->height = height;
-	win->fb_config = fb_config;
+	win->fb_config = cache->fb_config;
 	win->window = window;
 	win->glx_window = glx_window;
-	win->colormap = colormap;
+	win->colormap = cache->colormap;
+	win->swap_interval = 1;
 
 	register_glplatform_win(win);
-	if (win->callbacks.on_create)
+	if (win->callbacks.on_create) {
+		glplatform_count(&glplatform_counters.callbacks);
 		win->callbacks.on_create(win);
+	}
 	return win;
 }
 
@@ -457,11 +1149,42 @@ void glplatform_set_win_type(struct glplatform_win *win, enum glplatform_win_typ
 void glplatform_make_current(struct glplatform_win *win, glplatform_gl_context_t ctx)
 {
 	struct glplatform_context *context = (struct glplatform_context*)ctx;
+	struct glplatform_context *prev = (struct glplatform_context *)pthread_getspecific(g_context_tls);
+
+	glplatform_count(&glplatform_make_current_counters.calls);
+
+	//Offscreen contexts are made current with their own pbuffer
+	GLXDrawable drawable = win ? win->glx_window : (context ? context->pbuffer : None);
+
+	//A context can only be current in one thread so the drawable recorded
+	//in the context tells us if this call would change anything.
+	if (context && context == prev && context->drawable == drawable)
+		return;
+
+	glplatform_count(&glplatform_make_current_counters.switches);
+	GLPLATFORM_TRACE_BEGIN(trace);
+	if (prev)
+		prev->drawable = None;
 	pthread_setspecific(g_context_tls, context);
+	glplatform_gl_dispatch = context ? context->dispatch : NULL;
+	if (context) {
+		glXMakeContextCurrent(g_display, drawable, drawable, context->ctx);
+		context->drawable = drawable;
+	} else {
+		glXMakeContextCurrent(g_display, drawable, drawable, NULL);
+	}
+	GLPLATFORM_TRACE_END(trace, "make_current");
+}
+
+//
+// Forget which drawable the calling thread's context is bound to
+// so the next glplatform_make_current() goes to the window system.
+//
+static void invalidate_current_drawable()
+{
+	struct glplatform_context *context = glplatform_get_context_priv();
 	if (context)
-		glXMakeContextCurrent(g_display, win->glx_window, win->glx_window, context->ctx);
-	else
-		glXMakeContextCurrent(g_display, win->glx_window, win->glx_window, NULL);
+		context->drawable = None;
 }
 
 struct glplatform_context *glplatform_get_context_priv()
@@ -471,17 +1194,220 @@ struct glplatform_context *glplatform_get_context_priv()
 
 glplatform_gl_context_t glplatform_create_context(struct glplatform_win *win, int maj_ver, int min_ver)
 {
-	int attribList[] = {
-		GLX_CONTEXT_MAJOR_VERSION_ARB, maj_ver,
-		GLX_CONTEXT_MINOR_VERSION_ARB, min_ver,
-		GLX_CONTEXT_PROFILE_MASK_ARB, GLX_CONTEXT_CORE_PROFILE_BIT_ARB,
-		0
+	return glplatform_create_context_flags(win, maj_ver, min_ver, 0);
+}
+
+glplatform_gl_context_t glplatform_create_context_flags(struct glplatform_win *win, int maj_ver, int min_ver, uint32_t flags)
+{
+	struct glplatform_context_attribs attribs = {
+		.maj_ver = maj_ver,
+		.min_ver = min_ver,
+		.flags = flags
 	};
-	GLXContext ctx = glXCreateContextAttribsARB(g_display, win->fb_config, 0, 1, attribList);
+	return glplatform_create_context_attribs(win, &attribs);
+}
+
+//
+// Error trap for context creation. Xlib's error handler is process wide so
+// creating contexts on several threads, e.g. on loader threads, must not
+// interleave the handler swaps. Errors for requests issued before the trap
+// was set up are passed on to the previous handler. The trap can't tell
+// which thread issued a request, so while it is set up errors caused by other
+// threads' requests on the display are swallowed and fail the creation.
+//
+static pthread_mutex_t g_x_error_lock = PTHREAD_MUTEX_INITIALIZER;
+static int g_x_error;
+static unsigned long g_x_error_serial;
+static int (*g_prev_x_error_handler)(Display *, XErrorEvent *);
+
+static int trap_x_error(Display *display, XErrorEvent *event)
+{
+	if (display != g_display || event->serial < g_x_error_serial)
+		return g_prev_x_error_handler ? g_prev_x_error_handler(display, event) : 0;
+	g_x_error = event->error_code;
+	return 0;
+}
+
+//
+// Returns the GLX attribute list for 'flags' and strips
+// flags that can't be honored from 'flags'.
+//
+static void context_attrib_list(int *attrib_list, int maj_ver, int min_ver, uint32_t *flags)
+{
+	int i = 0;
+	int context_flags = 0;
+
+	if (*flags & (GLPLATFORM_CONTEXT_DEBUG | GLPLATFORM_CONTEXT_ROBUST))
+		*flags &= ~GLPLATFORM_CONTEXT_NO_ERROR;
+	if ((*flags & GLPLATFORM_CONTEXT_NO_ERROR) && !glx_has_extension("GLX_ARB_create_context_no_error"))
+		*flags &= ~GLPLATFORM_CONTEXT_NO_ERROR;
+	if ((*flags & GLPLATFORM_CONTEXT_ROBUST) && !glx_has_extension("GLX_ARB_create_context_robustness"))
+		*flags &= ~GLPLATFORM_CONTEXT_ROBUST;
+	if ((*flags & GLPLATFORM_CONTEXT_RELEASE_NONE) && !glx_has_extension("GLX_ARB_context_flush_control"))
+		*flags &= ~GLPLATFORM_CONTEXT_RELEASE_NONE;
+
+	attrib_list[i++] = GLX_CONTEXT_MAJOR_VERSION_ARB;
+	attrib_list[i++] = maj_ver;
+	attrib_list[i++] = GLX_CONTEXT_MINOR_VERSION_ARB;
+	attrib_list[i++] = min_ver;
+	attrib_list[i++] = GLX_CONTEXT_PROFILE_MASK_ARB;
+	attrib_list[i++] = GLX_CONTEXT_CORE_PROFILE_BIT_ARB;
+
+	if (*flags & GLPLATFORM_CONTEXT_DEBUG)
+		context_flags |= GLX_CONTEXT_DEBUG_BIT_ARB;
+	if (*flags & GLPLATFORM_CONTEXT_FORWARD_COMPATIBLE)
+		context_flags |= GLX_CONTEXT_FORWARD_COMPATIBLE_BIT_ARB;
+	if (*flags & GLPLATFORM_CONTEXT_ROBUST) {
+		context_flags |= GLX_CONTEXT_ROBUST_ACCESS_BIT_ARB;
+		attrib_list[i++] = GLX_CONTEXT_RESET_NOTIFICATION_STRATEGY_ARB;
+		attrib_list[i++] = GLX_LOSE_CONTEXT_ON_RESET_ARB;
+	}
+	if (context_flags) {
+		attrib_list[i++] = GLX_CONTEXT_FLAGS_ARB;
+		attrib_list[i++] = context_flags;
+	}
+	if (*flags & GLPLATFORM_CONTEXT_NO_ERROR) {
+		attrib_list[i++] = GLX_CONTEXT_OPENGL_NO_ERROR_ARB;
+		attrib_list[i++] = True;
+	}
+	if (*flags & GLPLATFORM_CONTEXT_RELEASE_NONE) {
+		attrib_list[i++] = GLX_CONTEXT_RELEASE_BEHAVIOR_ARB;
+		attrib_list[i++] = GLX_CONTEXT_RELEASE_BEHAVIOR_NONE_ARB;
+	}
+	attrib_list[i] = 0;
+}
+
+static GLXContext create_glx_context(GLXFBConfig fb_config, GLXContext share, int maj_ver, int min_ver, uint32_t *flags)
+{
+	int attrib_list[20];
+	const uint32_t optional_flags = GLPLATFORM_CONTEXT_NO_ERROR | GLPLATFORM_CONTEXT_RELEASE_NONE;
+
+	//Drivers may advertise an extension and still reject the attribute
+	//so trap the X error and retry without the optional attributes
+	//instead of letting Xlib's default handler exit the process.
+	pthread_mutex_lock(&g_x_error_lock);
+	XSync(g_display, False);
+	g_x_error_serial = NextRequest(g_display);
+	g_prev_x_error_handler = XSetErrorHandler(trap_x_error);
+	g_x_error = 0;
+	context_attrib_list(attrib_list, maj_ver, min_ver, flags);
+	GLXContext ctx = glXCreateContextAttribsARB(g_display, fb_config, share, True, attrib_list);
+	XSync(g_display, False);
+	if ((!ctx || g_x_error) && (*flags & optional_flags)) {
+		if (ctx) {
+			glXDestroyContext(g_display, ctx);
+			XSync(g_display, False);
+		}
+		g_x_error = 0;
+		*flags &= ~optional_flags;
+		context_attrib_list(attrib_list, maj_ver, min_ver, flags);
+		ctx = glXCreateContextAttribsARB(g_display, fb_config, share, True, attrib_list);
+		XSync(g_display, False);
+	}
+	if (g_x_error && ctx) {
+		glXDestroyContext(g_display, ctx);
+		XSync(g_display, False);
+		ctx = NULL;
+	}
+	XSetErrorHandler(g_prev_x_error_handler);
+	pthread_mutex_unlock(&g_x_error_lock);
+	return ctx;
+}
+
+glplatform_gl_context_t glplatform_create_context_attribs(struct glplatform_win *win, const struct glplatform_context_attribs *attribs)
+{
+	uint32_t flags = attribs->flags;
+	GLXContext ctx = create_glx_context(win->fb_config, NULL, attribs->maj_ver, attribs->min_ver, &flags);
+	if (!ctx)
+		return 0;
 	struct glplatform_context *context = calloc(1, sizeof(struct glplatform_context));
-	if (context)
+	if (context) {
 		context->ctx = ctx;
+		context->flags = flags;
+	} else {
+		glXDestroyContext(g_display, ctx);
+	}
+	return (glplatform_gl_context_t)context;
+}
+
+glplatform_gl_context_t glplatform_create_offscreen_context(const struct glplatform_context_attribs *attribs, glplatform_gl_context_t share)
+{
+	struct glplatform_context *share_context = (struct glplatform_context *)share;
+	uint32_t flags = attribs->flags;
+	int fb_attributes[] = {
+		GLX_DRAWABLE_TYPE, GLX_PBUFFER_BIT,
+		GLX_RENDER_TYPE, GLX_RGBA_BIT,
+		GLX_RED_SIZE, 8,
+		GLX_GREEN_SIZE, 8,
+		GLX_BLUE_SIZE, 8,
+		None
+	};
+	int pbuffer_attributes[] = {
+		GLX_PBUFFER_WIDTH, 1,
+		GLX_PBUFFER_HEIGHT, 1,
+		None
+	};
+	int fb_count;
+
+	GLXFBConfig *fb_config_a = glXChooseFBConfig(g_display, g_screen, fb_attributes, &fb_count);
+	if (!fb_config_a || fb_count == 0)
+		goto error1;
+
+	GLXContext ctx = create_glx_context(fb_config_a[0], share_context ? share_context->ctx : NULL,
+			attribs->maj_ver, attribs->min_ver, &flags);
+	if (!ctx)
+		goto error1;
+
+	GLXPbuffer pbuffer = glXCreatePbuffer(g_display, fb_config_a[0], pbuffer_attributes);
+	if (!pbuffer)
+		goto error2;
+
+	struct glplatform_context *context = calloc(1, sizeof(struct glplatform_context));
+	if (!context)
+		goto error3;
+	context->ctx = ctx;
+	context->pbuffer = pbuffer;
+	context->flags = flags;
+	XFree(fb_config_a);
 	return (glplatform_gl_context_t)context;
+error3:
+	glXDestroyPbuffer(g_display, pbuffer);
+error2:
+	glXDestroyContext(g_display, ctx);
+error1:
+	if (fb_config_a)
+		XFree(fb_config_a);
+	return 0;
+}
+
+void glplatform_destroy_context(glplatform_gl_context_t ctx)
+{
+	struct glplatform_context *context = (struct glplatform_context*)ctx;
+	if (!context)
+		return;
+	bool current = glplatform_get_context_priv() == context;
+	glplatform_text_renderer_release(context->text_renderer, current);
+	glplatform_upload_queues_release(context, current);
+	glplatform_stream_buffers_release(context, current);
+	if (current) {
+		glXMakeContextCurrent(g_display, None, None, NULL);
+		pthread_setspecific(g_context_tls, NULL);
+		glplatform_gl_dispatch = NULL;
+	}
+	glXDestroyContext(g_display, context->ctx);
+	if (context->pbuffer)
+		glXDestroyPbuffer(g_display, context->pbuffer);
+	free(context->gl_state);
+	free(context->dispatch);
+	free(context->debug);
+	free(context->gpu_timer);
+	free(context);
+}
+
+uint32_t glplatform_get_context_flags(glplatform_gl_context_t ctx)
+{
+	struct glplatform_context *context = (struct glplatform_context*)ctx;
+	return context ? context->flags : 0;
 }
 
 void glplatform_fullscreen_win(struct glplatform_win *win, bool fullscreen)
@@ -529,6 +1455,99 @@ void glplatform_fullscreen_win(struct glplatform_win *win, bool fullscreen)
 	}
 }
 
+static void set_swap_interval(struct glplatform_win *win, bool low_latency)
+{
+	int interval = 1;
+	if (!GLPLATFORM_GLX_EXT_swap_control || !glx_has_extension("GLX_EXT_swap_control"))
+		return;
+	if (low_latency)
+		interval = glx_has_extension("GLX_EXT_swap_control_tear") ? -1 : 0;
+	glXSwapIntervalEXT(g_display, win->glx_window, interval);
+	win->swap_interval = interval;
+}
+
+void glplatform_low_latency_fullscreen_win(struct glplatform_win *win, bool enable)
+{
+	Atom net_wm_bypass_compositor = XInternAtom(g_display, "_NET_WM_BYPASS_COMPOSITOR", False);
+	if (enable) {
+		long bypass = 1;
+		XChangeProperty(g_display,
+			win->window,
+			net_wm_bypass_compositor,
+			XA_CARDINAL,
+			32,
+			PropModeReplace,
+			(const unsigned char *)&bypass,
+			1);
+	} else {
+		XDeleteProperty(g_display, win->window, net_wm_bypass_compositor);
+	}
+	win->low_latency = enable;
+	set_swap_interval(win, enable);
+	glplatform_fullscreen_win(win, enable);
+}
+
+static bool window_has_atom(Window w, Atom property, Atom atom)
+{
+	Atom type;
+	int format;
+	unsigned long count, bytes_after;
+	unsigned char *data = NULL;
+	bool found = false;
+
+	if (XGetWindowProperty(g_display, w, property, 0, 1024, False, XA_ATOM,
+			&type, &format, &count, &bytes_after, &data) != Success)
+		return false;
+	if (data && type == XA_ATOM && format == 32) {
+		Atom *atoms = (Atom *)data;
+		unsigned long i;
+		for (i = 0; i < count && !found; i++)
+			found = atoms[i] == atom;
+	}
+	if (data)
+		XFree(data);
+	return found;
+}
+
+static long window_cardinal(Window w, Atom property)
+{
+	Atom type;
+	int format;
+	unsigned long count, bytes_after;
+	unsigned char *data = NULL;
+	long value = 0;
+
+	if (XGetWindowProperty(g_display, w, property, 0, 1, False, XA_CARDINAL,
+			&type, &format, &count, &bytes_after, &data) != Success)
+		return 0;
+	if (data && type == XA_CARDINAL && format == 32 && count == 1)
+		value = *((long *)data);
+	if (data)
+		XFree(data);
+	return value;
+}
+
+bool glplatform_get_presentation_info(struct glplatform_win *win, struct glplatform_presentation_info *info)
+{
+	char cm_selection[32];
+	Window root = RootWindow(g_display, g_screen);
+	Atom net_supported = XInternAtom(g_display, "_NET_SUPPORTED", False);
+	Atom net_wm_state = XInternAtom(g_display, "_NET_WM_STATE", False);
+	Atom net_wm_state_fullscreen = XInternAtom(g_display, "_NET_WM_STATE_FULLSCREEN", False);
+	Atom net_wm_bypass_compositor = XInternAtom(g_display, "_NET_WM_BYPASS_COMPOSITOR", False);
+
+	// Compositing managers own the _NET_WM_CM_S<screen> selection
+	snprintf(cm_selection, sizeof(cm_selection), "_NET_WM_CM_S%d", g_screen);
+
+	info->fullscreen = window_has_atom(win->window, net_wm_state, net_wm_state_fullscreen);
+	info->low_latency = win->low_latency;
+	info->compositor_running = XGetSelectionOwner(g_display, XInternAtom(g_display, cm_selection, False)) != None;
+	info->bypass_supported = window_has_atom(root, net_supported, net_wm_bypass_compositor);
+	info->bypass_requested = window_cardinal(win->window, net_wm_bypass_compositor) == 1;
+	info->swap_interval = win->swap_interval;
+	return true;
+}
+
 static Bool match_any_event(Display *display, XEvent *event, XPointer arg)
 {
 	return True;
@@ -538,10 +1557,14 @@ int glplatform_get_events(bool block)
 {
 	int rc = 0;
 	if (g_event_count < 100) {
+		GLPLATFORM_TRACE_BEGIN(trace);
 		rc = epoll_wait(glplatform_epoll_fd, g_events + g_event_count, 100 - g_event_count, block ? -1 : 0);
+		GLPLATFORM_TRACE_END(trace, "epoll_wait");
 		if (rc == -1) {
 			fprintf(stderr, "glplatform_get_events(): epoll_wait() failed: %s", strerror(errno));
 		} else {
+			if (rc)
+				glplatform_count(&glplatform_counters.epoll_wakeups);
 			g_event_count += rc;
 		}
 	}
@@ -555,34 +1578,190 @@ bool glplatform_process_events()
 	for (i = 0; i < g_event_count; i++) {
 		int fd = g_events[i].data.fd;
 		struct glplatform_win *win = g_fd_binding[fd].win;
-		if (win)
-			if (win->callbacks.on_fd_event)
-				win->callbacks.on_fd_event(win, fd, g_events[i].events, g_fd_binding[fd].user_data);
+		GLPLATFORM_TRACE_BEGIN(trace);
+		glplatform_count(&glplatform_counters.fd_events);
+		if (g_fd_binding[fd].handler) {
+			glplatform_count(&glplatform_counters.callbacks);
+			g_fd_binding[fd].handler(fd, g_events[i].events, g_fd_binding[fd].user_data);
+		} else if (win && win->callbacks.on_fd_event) {
+			glplatform_count(&glplatform_counters.callbacks);
+			win->callbacks.on_fd_event(win, fd, g_events[i].events, g_fd_binding[fd].user_data);
+		}
+		GLPLATFORM_TRACE_END(trace, "fd_event");
 	}
 	g_event_count = 0;
 
+	GLPLATFORM_TRACE_BEGIN(drain);
 	while (XCheckIfEvent(g_display, &event, match_any_event, NULL) == True) {
 		struct glplatform_win *win = find_glplatform_win(event.xany.window);
+		GLPLATFORM_TRACE_BEGIN(trace);
+		glplatform_count_x_event(event.type);
 		if (win)
 			handle_x_event(win, &event);
+		else if (g_pixmap_textures)
+			handle_pixmap_texture_event(&event);
+		GLPLATFORM_TRACE_END(trace, "x_event");
 	}
+	GLPLATFORM_TRACE_END(drain, "x_event_drain");
+	glplatform_debug_process_messages();
 	return g_glplatform_win_count > 0;
 }
 
+//
+// Block for up to THROTTLE_TIMEOUT_MS or until there are X events to process
+// so that a render loop for hidden windows runs at a low rate but still wakes
+// up promptly when the window becomes visible again.
+//
+#define THROTTLE_TIMEOUT_MS 100
+
+static void throttle_hidden()
+{
+	struct pollfd pfd;
+	if (XEventsQueued(g_display, QueuedAfterFlush))
+		return;
+	pfd.fd = g_x11_fd;
+	pfd.events = POLLIN;
+	pfd.revents = 0;
+	poll(&pfd, 1, THROTTLE_TIMEOUT_MS);
+}
+
+static bool skip_swap(struct glplatform_win *win)
+{
+	return win->visibility_policy != GLPLATFORM_VISIBILITY_RENDER && !glplatform_win_is_visible(win);
+}
+
+bool glplatform_win_is_visible(struct glplatform_win *win)
+{
+	return win->mapped && !win->obscured;
+}
+
+void glplatform_set_visibility_policy(struct glplatform_win *win, enum glplatform_visibility_policy policy)
+{
+	win->visibility_policy = policy;
+}
+
 void glplatform_swap_buffers(struct glplatform_win *win)
 {
+	if (skip_swap(win)) {
+		if (win->visibility_policy == GLPLATFORM_VISIBILITY_THROTTLE)
+			throttle_hidden();
+		glplatform_end_frame();
+		return;
+	}
+	GLPLATFORM_TRACE_BEGIN(trace);
+	glplatform_count(&glplatform_counters.swaps);
 	glXSwapBuffers(g_display, win->glx_window);
 	XSync(g_display, 0);
+	GLPLATFORM_TRACE_END(trace, "swap_buffers");
+	glplatform_end_frame();
+}
+
+//
+// Read a window's vblank and swap counters without waiting. The last swap
+// glplatform_swap_buffers_multi() scheduled for the window missed if it is
+// still pending once the vblank it targeted has passed. Returns the MSC the
+// window's swap interval puts the next swap at, which depends on the CRTC
+// showing the window, or 0 to swap without a target if the counters can't
+// be read or the window doesn't wait for vblank.
+//
+static int64_t next_target_msc(struct glplatform_win *win, bool *missed)
+{
+	int64_t ust, msc, sbc;
+	*missed = false;
+	if (!glXGetSyncValuesOML(g_display, win->glx_window, &ust, &msc, &sbc))
+		return 0;
+	if (win->swap_target_msc && sbc < win->swap_sbc && msc >= win->swap_target_msc)
+		*missed = true;
+	if (win->swap_interval <= 0)
+		return 0;
+	return msc + win->swap_interval;
+}
+
+int glplatform_swap_buffers_multi(struct glplatform_win **wins, int count, bool *missed)
+{
+	int i;
+	int missed_count = 0;
+	int swap_count = 0;
+	bool throttle = false;
+
+	if (count <= 0)
+		return 0;
+
+	for (i = 0; i < count; i++) {
+		struct glplatform_win *win = wins[i];
+		bool win_missed = false;
+		if (skip_swap(win)) {
+			win->swap_target_msc = 0;
+			throttle = throttle || win->visibility_policy == GLPLATFORM_VISIBILITY_THROTTLE;
+		} else {
+			swap_count++;
+			if (g_oml_sync_control)
+				win->swap_target_msc = next_target_msc(win, &win_missed);
+		}
+		if (missed)
+			missed[i] = win_missed;
+		if (win_missed)
+			missed_count++;
+	}
+
+	if (!swap_count) {
+		if (throttle)
+			throttle_hidden();
+		glplatform_end_frame();
+		return missed_count;
+	}
+
+	GLPLATFORM_TRACE_BEGIN(trace);
+	for (i = 0; i < count; i++) {
+		struct glplatform_win *win = wins[i];
+		if (skip_swap(win))
+			continue;
+		glplatform_count(&glplatform_counters.swaps);
+		if (win->swap_target_msc) {
+			win->swap_sbc = glXSwapBuffersMscOML(g_display, win->glx_window, win->swap_target_msc, 0, 0);
+			if (!win->swap_sbc)
+				win->swap_target_msc = 0;
+		} else {
+			glXSwapBuffers(g_display, win->glx_window);
+		}
+	}
+	XSync(g_display, 0);
+	GLPLATFORM_TRACE_END(trace, "swap_buffers_multi");
+	glplatform_end_frame();
+	return missed_count;
 }
 
 void glplatform_destroy_window(struct glplatform_win *win)
 {
+	glplatform_frame_limiter_free(win);
 	glXMakeContextCurrent(g_display, None, None, NULL);
-	glXDestroyWindow(g_display, win->glx_window);
-	XSync(g_display, 0);
-	XDestroyWindow(g_display, win->window);
-	XFreeColormap(g_display, win->colormap);
+	invalidate_current_drawable();
 	retire_glplatform_win(win);
+
+	if (win->shm_surface) {
+		shm_free_surface((struct shm_surface *)win->shm_surface);
+		XDestroyWindow(g_display, win->window);
+		free(win);
+		return;
+	}
+
+	struct fbformat_cache *cache = find_fbformat_cache(&win->fbformat);
+	struct pooled_window *pooled = NULL;
+	if (cache && cache->pool_size < cache->pool_target)
+		pooled = (struct pooled_window *)malloc(sizeof(struct pooled_window));
+
+	if (pooled) {
+		if (win->swap_interval != 1)
+			set_swap_interval(win, false);
+		reset_x_window(win->window);
+		pooled->window = win->window;
+		pooled->glx_window = win->glx_window;
+		pooled->next = cache->pool;
+		cache->pool = pooled;
+		cache->pool_size++;
+	} else {
+		destroy_x_window(win->window, win->glx_window);
+	}
 	free(win);
 }
 
@@ -600,9 +1779,23 @@ void glplatform_fd_unbind(int fd)
 {
 	epoll_ctl(glplatform_epoll_fd, EPOLL_CTL_DEL, fd, NULL);
 	g_fd_binding[fd].win = NULL;
+	g_fd_binding[fd].handler = NULL;
 	g_fd_binding[fd].user_data = 0;
 }
 
+bool glplatform_fd_bind_handler(int fd, void (*handler)(int fd, uint32_t events, intptr_t user_data), intptr_t user_data)
+{
+	struct epoll_event ev;
+	ev.events = EPOLLIN;
+	ev.data.fd = fd;
+	if (fd >= g_max_fd || epoll_ctl(glplatform_epoll_fd, EPOLL_CTL_ADD, fd, &ev) == -1)
+		return false;
+	g_fd_binding[fd].win = NULL;
+	g_fd_binding[fd].handler = handler;
+	g_fd_binding[fd].user_data = user_data;
+	return true;
+}
+
 void glplatform_show_window(struct glplatform_win *win)
 {
 	XMapRaised(g_display, win->window);
@@ -619,6 +1812,7 @@ void glplatform_get_thread_state(struct glplatform_thread_state *state)
 
 void glplatform_set_thread_state(const struct glplatform_thread_state *state)
 {
+	invalidate_current_drawable();
 	glXMakeContextCurrent(state->display,
 			state->write_draw,
 			state->read_draw,
@@ -6,17 +6,156 @@
 #else
 #include "glplatform-glx.h"
 #endif
+#include <stdatomic.h>
 
 struct gltext_renderer;
+struct glplatform_gl_state;
+struct glplatform_gl_dispatch;
 struct glplatform_context {
 	struct gltext_renderer *text_renderer;
+	struct glplatform_gl_state *gl_state;
+	struct glplatform_gl_dispatch *dispatch; //Set by glplatform_glcore_init_context()
+	struct glplatform_stream_buffer *stream_buffers;
+	struct glplatform_upload_queue *upload_queues;
+	struct glplatform_debug *debug; //Set by glplatform_debug_enable()
+	struct glplatform_gpu_timer *gpu_timer; //Set by glplatform_gpu_timer_enable()
+	uint32_t flags;
 #ifdef _WIN32
 	HGLRC rc;
+	HDC hdc; //DC the context is current with in its thread
 #else
 	GLXContext ctx;
+	GLXDrawable drawable; //Drawable the context is current with in its thread
+	GLXPbuffer pbuffer; //Drawable of offscreen contexts
 #endif
 };
 
 struct glplatform_context *glplatform_get_context_priv();
 
+extern _Thread_local struct glplatform_gl_dispatch *glplatform_gl_dispatch;
+
+struct glplatform_make_current_counters {
+	atomic_uint_fast64_t calls;
+	atomic_uint_fast64_t switches;
+};
+
+extern struct glplatform_make_current_counters glplatform_make_current_counters;
+
+//
+// Process wide counters read by glplatform_get_stats(). 'fonts' and
+// 'atlas_bytes' go up and down with the resources they track, all others
+// only increase.
+//
+struct glplatform_counters {
+	atomic_uint_fast64_t x_events[GLPLATFORM_STATS_X_EVENT_TYPES];
+	atomic_uint_fast64_t fd_events;
+	atomic_uint_fast64_t callbacks;
+	atomic_uint_fast64_t epoll_wakeups;
+	atomic_uint_fast64_t swaps;
+	atomic_uint_fast64_t glyphs_prepared;
+	atomic_uint_fast64_t glyphs_submitted;
+	atomic_uint_fast64_t stream_bytes;
+	atomic_uint_fast64_t fonts;
+	atomic_uint_fast64_t atlas_bytes;
+};
+
+extern struct glplatform_counters glplatform_counters;
+
+static inline void glplatform_count(atomic_uint_fast64_t *counter)
+{
+	atomic_fetch_add_explicit(counter, 1, memory_order_relaxed);
+}
+
+static inline void glplatform_count_add(atomic_uint_fast64_t *counter, uint64_t n)
+{
+	atomic_fetch_add_explicit(counter, n, memory_order_relaxed);
+}
+
+static inline void glplatform_count_sub(atomic_uint_fast64_t *counter, uint64_t n)
+{
+	atomic_fetch_sub_explicit(counter, n, memory_order_relaxed);
+}
+
+static inline void glplatform_count_x_event(int type)
+{
+	//Extension events have dynamically assigned types, they share the last entry
+	if (type < 0 || type >= GLPLATFORM_STATS_X_EVENT_TYPES)
+		type = GLPLATFORM_STATS_X_EVENT_TYPES - 1;
+	glplatform_count(&glplatform_counters.x_events[type]);
+}
+
+#ifndef _WIN32
+//
+// Have glplatform_process_events() call 'handler' when 'fd' becomes
+// readable. Used by glplatform subsystems that deliver results through
+// the event loop. Remove with glplatform_fd_unbind().
+//
+bool glplatform_fd_bind_handler(int fd, void (*handler)(int fd, uint32_t events, intptr_t user_data), intptr_t user_data);
+#endif
+
+//
+// Release a window's frames in flight limiter. Called by
+// glplatform_destroy_window() before the window's context is released.
+//
+void glplatform_frame_limiter_free(struct glplatform_win *win);
+
+//
+// Called by glplatform_swap_buffers() with the swapping thread's
+// context current.
+//
+void glplatform_state_filter_end_frame();
+
+struct glplatform_stream_buffer;
+void glplatform_stream_end_frame(struct glplatform_stream_buffer *list);
+struct glplatform_upload_queue;
+void glplatform_upload_end_frame(struct glplatform_upload_queue *list);
+
+//
+// Free the text renderer, upload queues and streaming buffers of a context
+// being destroyed, in that order. Their OpenGL objects are deleted if
+// 'current' is set, i.e. the context is current in the calling thread, and
+// are otherwise left to be destroyed with the context.
+//
+void glplatform_text_renderer_release(struct gltext_renderer *inst, bool current);
+void glplatform_upload_queues_release(struct glplatform_context *context, bool current);
+void glplatform_stream_buffers_release(struct glplatform_context *context, bool current);
+
+struct glplatform_debug;
+void glplatform_debug_end_frame(struct glplatform_debug *debug);
+struct glplatform_gpu_timer;
+void glplatform_gpu_timer_end_frame(struct glplatform_gpu_timer *timer);
+
+//
+// Deliver debug messages queued by the driver. Called by
+// glplatform_process_events().
+//
+void glplatform_debug_process_messages();
+
+//
+// Program cache steps, for building programs outside of
+// glplatform_program_create(). Load returns 0 on a miss and sets '*key' to 0
+// if the cache can't be used, in which case store does nothing. Programs to
+// store should be linked with GL_PROGRAM_BINARY_RETRIEVABLE_HINT set.
+//
+struct glplatform_shader_source;
+uint32_t glplatform_program_cache_load(const struct glplatform_shader_source *shaders, int count, uint64_t *key);
+void glplatform_program_cache_store(uint64_t key, uint32_t program);
+
+//Bytes per pixel of client pixel data, 0 if unknown
+size_t glplatform_pixel_size(uint32_t format, uint32_t type);
+
+//
+// Capture hooks, no-ops unless a capture is running in the calling thread.
+// Buffer writes report data written through persistent mappings, which the
+// capture can't observe on its own.
+//
+void glplatform_capture_end_frame();
+void glplatform_capture_buffer_write(uint32_t buffer, size_t offset, size_t size, const void *data);
+
+//
+// Per-frame work of the GL helpers. Called by the glplatform_swap_buffers*()
+// functions with the swapping thread's context current.
+//
+void glplatform_end_frame();
+
 #endif
@@ -0,0 +1,58 @@
+#include "glplatform.h"
+#include "glutil.h"
+#include "priv.h"
+#include "trace.h"
+
+struct glplatform_make_current_counters glplatform_make_current_counters;
+struct glplatform_counters glplatform_counters;
+
+void glplatform_get_make_current_stats(struct glplatform_make_current_stats *stats)
+{
+	uint64_t calls = atomic_load_explicit(&glplatform_make_current_counters.calls, memory_order_relaxed);
+	uint64_t switches = atomic_load_explicit(&glplatform_make_current_counters.switches, memory_order_relaxed);
+	stats->calls = calls;
+	stats->switches = switches;
+	stats->elided = calls > switches ? calls - switches : 0;
+}
+
+static uint64_t read_counter(atomic_uint_fast64_t *counter)
+{
+	return atomic_load_explicit(counter, memory_order_relaxed);
+}
+
+void glplatform_get_stats(struct glplatform_stats *stats)
+{
+	int i;
+	for (i = 0; i < GLPLATFORM_STATS_X_EVENT_TYPES; i++)
+		stats->x_events[i] = read_counter(&glplatform_counters.x_events[i]);
+	stats->fd_events = read_counter(&glplatform_counters.fd_events);
+	stats->callbacks = read_counter(&glplatform_counters.callbacks);
+	stats->epoll_wakeups = read_counter(&glplatform_counters.epoll_wakeups);
+	stats->make_current_calls = read_counter(&glplatform_make_current_counters.calls);
+	stats->make_current_switches = read_counter(&glplatform_make_current_counters.switches);
+	stats->swaps = read_counter(&glplatform_counters.swaps);
+	stats->glyphs_prepared = read_counter(&glplatform_counters.glyphs_prepared);
+	stats->glyphs_submitted = read_counter(&glplatform_counters.glyphs_submitted);
+	stats->stream_bytes = read_counter(&glplatform_counters.stream_bytes);
+	stats->fonts = read_counter(&glplatform_counters.fonts);
+	stats->atlas_bytes = read_counter(&glplatform_counters.atlas_bytes);
+}
+
+void glplatform_end_frame()
+{
+	struct glplatform_context *context = glplatform_get_context_priv();
+	GLPLATFORM_TRACE_BEGIN(trace);
+	glplatform_state_filter_end_frame();
+	glplatform_profile_end_frame();
+	//Uploads are issued first so their staging data is fenced with the frame
+	if (context && context->upload_queues)
+		glplatform_upload_end_frame(context->upload_queues);
+	if (context && context->stream_buffers)
+		glplatform_stream_end_frame(context->stream_buffers);
+	if (context && context->debug)
+		glplatform_debug_end_frame(context->debug);
+	if (context && context->gpu_timer)
+		glplatform_gpu_timer_end_frame(context->gpu_timer);
+	glplatform_capture_end_frame();
+	GLPLATFORM_TRACE_END(trace, "end_frame");
+}
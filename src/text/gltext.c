@@ -1,5 +1,7 @@
 #include "gltext.h"
+#include "glutil.h"
 #include "priv.h"
+#include "trace.h"
 
 #include <math.h>
 
@@ -7,6 +9,8 @@
 
 #define GLPLATFORM_GL_VERSION 33
 #include "glcore.h"
+#define GLPLATFORM_GL_USE_DISPATCH
+#include "glcore_dispatch.h"
 
 #include <ft2build.h>
 #include FT_FREETYPE_H
@@ -16,6 +20,19 @@
 
 #define FONT_FORMAT_VERSION 1
 
+//
+// Initial size of the glyph instance stream buffer. The buffer is
+// recreated at a larger size if a single render does not fit.
+//
+#define STREAM_BUFFER_SIZE (256 * 1024)
+
+//
+// Upload queue atlases are uploaded through when a render needs a font's
+// texture, so large atlases are spread over several frames.
+//
+#define ATLAS_STAGING_SIZE (1024 * 1024)
+#define ATLAS_FRAME_BUDGET (1024 * 1024)
+
 enum vertex_attrib_locations {
 	POS_LOC = 0,
 	GLYPH_INDEX_LOC = 1
@@ -38,6 +55,8 @@ struct gltext_font {
 	int16_t *kerning_table;
 	int max_char;
 	bool sdf;
+	struct glplatform_upload_queue *upload_queue;
+	struct font_upload *upload;
 };
 
 const struct gltext_glyph *gltext_get_glyph(gltext_font_t font, char32_t c)
@@ -63,11 +82,10 @@ struct gltext_renderer
 	// OpenGL state
 	//
 	GLuint glsl_program;
-	GLuint fragment_shader;
-	GLuint vertex_shader;
-	GLuint geometry_shader;
 	GLuint gl_vertex_array;
-	GLuint stream_vbo;
+	struct glplatform_stream_buffer *stream;
+	struct glplatform_upload_queue *upload_queue;
+	size_t stream_offset;
 	int sampler_loc;
 	int color_loc;
 	int glyph_metric_sampler_loc;
@@ -78,6 +96,28 @@ struct gltext_renderer
 
 static bool init_renderer(struct gltext_renderer *inst);
 
+//
+// Point the vertex array's attributes at the current stream buffer
+//
+static void bind_stream_buffer(struct gltext_renderer *inst)
+{
+	glBindVertexArray(inst->gl_vertex_array);
+	glBindBuffer(GL_ARRAY_BUFFER, glplatform_stream_buffer_get_name(inst->stream));
+
+	glVertexAttribPointer(POS_LOC,
+		2,
+		GL_FLOAT,
+		GL_FALSE,
+		sizeof(struct gltext_glyph_instance),
+		(void *)offsetof(struct gltext_glyph_instance, pos));
+
+	glVertexAttribIPointer(GLYPH_INDEX_LOC,
+		1,
+		GL_UNSIGNED_INT,
+		sizeof(struct gltext_glyph_instance),
+		(void *)offsetof(struct gltext_glyph_instance, w));
+}
+
 static struct gltext_renderer *get_renderer()
 {
 	struct glplatform_context *context = glplatform_get_context_priv();
@@ -119,7 +159,8 @@ struct gltext_glyph_instance *gltext_prepare_render(gltext_font_t font, int num_
 	if (!inst)
 		return NULL;
 
-	if (!font->atlas_texture)
+	GLPLATFORM_TRACE_BEGIN(trace);
+	if (!font->atlas_texture && !gltext_font_create_texture_queued(font, inst->upload_queue, NULL, NULL))
 		gltext_font_create_texture(font);
 
 	glActiveTexture(GL_TEXTURE0);
@@ -127,20 +168,25 @@ struct gltext_glyph_instance *gltext_prepare_render(gltext_font_t font, int num_
 	glActiveTexture(GL_TEXTURE1);
 	glBindTexture(GL_TEXTURE_BUFFER, font->glyph_metric_texture);
 
-	//Orphan previous buffer
-	int buffer_size = sizeof(struct gltext_glyph_instance) * num_chars;
-	glBindBuffer(GL_ARRAY_BUFFER, inst->stream_vbo);
-	glBufferData(GL_ARRAY_BUFFER,
-			buffer_size,
-			NULL,
-			GL_STREAM_DRAW);
-
-	//Copy in new data
-	struct gltext_glyph_instance * ret = (struct gltext_glyph_instance *) glMapBufferRange(
-		GL_ARRAY_BUFFER,
-		0, buffer_size,
-		GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+	size_t buffer_size = sizeof(struct gltext_glyph_instance) * num_chars;
+	if (buffer_size > glplatform_stream_buffer_get_size(inst->stream)) {
+		struct glplatform_stream_buffer *stream = glplatform_stream_buffer_create(GL_ARRAY_BUFFER, buffer_size * 2);
+		if (!stream)
+			return NULL;
+		glplatform_stream_buffer_destroy(inst->stream);
+		inst->stream = stream;
+		bind_stream_buffer(inst);
+	}
+
+	struct gltext_glyph_instance *ret = (struct gltext_glyph_instance *) glplatform_stream_buffer_map(
+		inst->stream,
+		buffer_size,
+		sizeof(struct gltext_glyph_instance),
+		&inst->stream_offset);
 	inst->cur_font = font;
+	if (ret)
+		glplatform_count_add(&glplatform_counters.glyphs_prepared, num_chars);
+	GLPLATFORM_TRACE_END(trace, "gltext_prepare_render");
 	return ret;
 }
 
@@ -149,24 +195,36 @@ void gltext_submit_render(const struct gltext_color *color, int num_chars, const
 	struct gltext_renderer *inst = get_renderer();
 	if (!inst)
 		return;
+	GLPLATFORM_TRACE_BEGIN(trace);
 	glEnable(GL_BLEND);
 	glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
-	glUnmapBuffer(GL_ARRAY_BUFFER);
+	glplatform_gpu_scope_begin("gltext");
+	glplatform_stream_buffer_unmap(inst->stream, sizeof(struct gltext_glyph_instance) * num_chars);
 	glUseProgram(inst->glsl_program);
 	glBindVertexArray(inst->gl_vertex_array);
 	glUniformMatrix4fv(inst->mvp_loc, 1, GL_FALSE, mvp);
 	glUniform4fv(inst->color_loc, 1, (GLfloat *)color);
 	glUniform1i(inst->sdf_loc, inst->cur_font->sdf);
-	glDrawArrays(GL_POINTS, 0, num_chars);
+	glDrawArrays(GL_POINTS, inst->stream_offset / sizeof(struct gltext_glyph_instance), num_chars);
+	glplatform_count_add(&glplatform_counters.glyphs_submitted, num_chars);
+	glplatform_gpu_scope_end();
+	GLPLATFORM_TRACE_END(trace, "gltext_submit_render");
 }
 
-void deinit_renderer(struct gltext_renderer *inst)
+void glplatform_text_renderer_release(struct gltext_renderer *inst, bool current)
 {
-	glDeleteShader(inst->fragment_shader);
-	glDeleteShader(inst->geometry_shader);
-	glDeleteShader(inst->vertex_shader);
-	glDeleteProgram(inst->glsl_program);
+	if (!inst)
+		return;
+	if (current) {
+		//Finish pending atlas uploads so their fonts forget the queue
+		glplatform_upload_queue_flush(inst->upload_queue);
+		glplatform_upload_queue_destroy(inst->upload_queue);
+		glplatform_stream_buffer_destroy(inst->stream);
+		glDeleteVertexArrays(1, &inst->gl_vertex_array);
+		glDeleteProgram(inst->glsl_program);
+	}
 	FT_Done_FreeType(inst->ft_library);
+	free(inst);
 }
 
 gltext_typeface_t gltext_get_typeface(const char *path)
@@ -260,74 +318,34 @@ static bool init_renderer(struct gltext_renderer *inst)
 			"frag_color = color * vec4(texel);\n"
 		"}\n";
 
-	GLint success;
+	const struct glplatform_shader_source shaders[] = {
+		{GL_VERTEX_SHADER, vertex_shader_text},
+		{GL_GEOMETRY_SHADER, geometry_shader_text},
+		{GL_FRAGMENT_SHADER, fragment_shader_text}
+	};
+	char info_log[1000] = "";
+
 	glGenVertexArrays(1, &inst->gl_vertex_array);
 	glBindVertexArray(inst->gl_vertex_array);
 
-	inst->geometry_shader = glCreateShader(GL_GEOMETRY_SHADER);
-	glShaderSource(inst->geometry_shader, 1, (const char **)&geometry_shader_text, NULL);
-	glCompileShader(inst->geometry_shader);
-	glGetShaderiv(inst->geometry_shader, GL_COMPILE_STATUS, &success);
-	if (!success) {
-		char info_log[1000];
-		glGetShaderInfoLog(inst->geometry_shader, sizeof(info_log), NULL, info_log);
-		printf("renderer: Geometry shader compile failed\n%s", info_log);
-		goto error2;
-	}
-
-	inst->fragment_shader = glCreateShader(GL_FRAGMENT_SHADER);
-	glShaderSource(inst->fragment_shader, 1, (const char **)&fragment_shader_text, NULL);
-	glCompileShader(inst->fragment_shader);
-	glGetShaderiv(inst->fragment_shader, GL_COMPILE_STATUS, &success);
-	if (!success) {
-		char info_log[1000];
-		glGetShaderInfoLog(inst->fragment_shader, sizeof(info_log), NULL, info_log);
-		printf("renderer: Fragment shader compile failed\n%s", info_log);
-		goto error3;
-	}
-
-	inst->vertex_shader = glCreateShader(GL_VERTEX_SHADER);
-	glShaderSource(inst->vertex_shader, 1, (const char **)&vertex_shader_text, NULL);
-	glCompileShader(inst->vertex_shader);
-	glGetShaderiv(inst->vertex_shader, GL_COMPILE_STATUS, &success);
-	if (!success) {
-		char info_log[1000];
-		glGetShaderInfoLog(inst->vertex_shader, sizeof(info_log), NULL, info_log);
-		printf("renderer: Vertex shader compile failed\n%s", info_log);
-		goto error4;
-	}
-
-	inst->glsl_program = glCreateProgram();
-	glAttachShader(inst->glsl_program, inst->vertex_shader);
-	glAttachShader(inst->glsl_program, inst->geometry_shader);
-	glAttachShader(inst->glsl_program, inst->fragment_shader);
-	glLinkProgram(inst->glsl_program);
-	glGetProgramiv(inst->glsl_program, GL_LINK_STATUS, &success);
-	if (!success) {
-		char info_log[1000];
-		glGetProgramInfoLog(inst->glsl_program, sizeof(info_log), NULL, info_log);
-		printf("renderer: Program link failed\n%s", info_log);
-		goto error4;
+	//Built through the program cache so new contexts usually skip compilation
+	inst->glsl_program = glplatform_program_create(shaders, 3, info_log, sizeof(info_log));
+	if (!inst->glsl_program) {
+		printf("renderer: Program build failed\n%s", info_log);
+		goto error1;
 	}
 
 	glEnableVertexAttribArray(GLYPH_INDEX_LOC);
 	glEnableVertexAttribArray(POS_LOC);
 
-	glGenBuffers(1, &inst->stream_vbo);
-	glBindBuffer(GL_ARRAY_BUFFER, inst->stream_vbo);
-
-	glVertexAttribPointer(POS_LOC,
-		2,
-		GL_FLOAT,
-		GL_FALSE,
-		sizeof(struct gltext_glyph_instance),
-		(void *)offsetof(struct gltext_glyph_instance, pos));
+	inst->stream = glplatform_stream_buffer_create(GL_ARRAY_BUFFER, STREAM_BUFFER_SIZE);
+	if (!inst->stream)
+		goto error2;
+	bind_stream_buffer(inst);
 
-	glVertexAttribIPointer(GLYPH_INDEX_LOC,
-		1,
-		GL_UNSIGNED_INT,
-		sizeof(struct gltext_glyph_instance),
-		(void *)offsetof(struct gltext_glyph_instance, w));
+	inst->upload_queue = glplatform_upload_queue_create(ATLAS_STAGING_SIZE, ATLAS_FRAME_BUDGET);
+	if (!inst->upload_queue)
+		goto error3;
 
 	//Cache uniform locations
 	inst->mvp_loc = glGetUniformLocation(inst->glsl_program, "mvp");
@@ -340,25 +358,29 @@ static bool init_renderer(struct gltext_renderer *inst)
 	glUniform1i(inst->sampler_loc, 0);
 	glUniform1i(inst->glyph_metric_sampler_loc, 1);
 	return true;
-error4:
-	glDeleteProgram(inst->glsl_program);
-	inst->glsl_program = 0;
 error3:
-	glDeleteShader(inst->vertex_shader);
-	inst->vertex_shader = 0;
+	glplatform_stream_buffer_destroy(inst->stream);
+	inst->stream = NULL;
 error2:
-	glDeleteShader(inst->fragment_shader);
-	inst->fragment_shader = 0;
+	glDeleteProgram(inst->glsl_program);
+	inst->glsl_program = 0;
 error1:
-	glDeleteShader(inst->geometry_shader);
-	inst->geometry_shader = 0;
 	glDeleteVertexArrays(1, &inst->gl_vertex_array);
 	inst->gl_vertex_array = 0;
 	FT_Done_FreeType(inst->ft_library);
 	return false;
 }
 
-void gltext_font_create_texture(gltext_font_t f)
+static uint64_t atlas_size(gltext_font_t f)
+{
+	return (uint64_t)f->pot_size * f->pot_size * f->total_glyphs;
+}
+
+//
+// Create the font's textures. If 'atlas' is NULL the atlas storage is
+// allocated but left undefined.
+//
+static void create_texture(gltext_font_t f, const void *atlas)
 {
 	if (!f->atlas_texture) {
 		//
@@ -383,20 +405,114 @@ void gltext_font_create_texture(gltext_font_t f)
 			0, /* border */
 			GL_RED,
 			GL_UNSIGNED_BYTE,
-			f->atlas_buffer);
+			atlas);
 		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_REPEAT);
 		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_REPEAT);
+		glplatform_count_add(&glplatform_counters.atlas_bytes, atlas_size(f));
+	}
+}
+
+void gltext_font_create_texture(gltext_font_t f)
+{
+	create_texture(f, f->atlas_buffer);
+}
+
+struct font_upload {
+	gltext_font_t font;
+	void (*done)(gltext_font_t font, void *user_data);
+	void *user_data;
+};
+
+static void font_upload_done(void *arg)
+{
+	struct font_upload *upload = (struct font_upload *)arg;
+	gltext_font_t font = upload->font;
+	font->upload_queue = NULL;
+	font->upload = NULL;
+	if (upload->done)
+		upload->done(font, upload->user_data);
+	free(upload);
+}
+
+bool gltext_font_create_texture_queued(gltext_font_t font, struct glplatform_upload_queue *queue,
+		void (*done)(gltext_font_t font, void *user_data), void *user_data)
+{
+	if (font->atlas_texture)
+		return false;
+	struct font_upload *upload = (struct font_upload *)malloc(sizeof(struct font_upload));
+	if (!upload)
+		return false;
+	upload->font = font;
+	upload->done = done;
+	upload->user_data = user_data;
+
+	create_texture(font, NULL);
+	if (!glplatform_upload_texture(queue, font->atlas_texture, GL_TEXTURE_2D_ARRAY, 0,
+			0, 0, 0, font->pot_size, font->pot_size, font->total_glyphs,
+			GL_RED, GL_UNSIGNED_BYTE, font->atlas_buffer,
+			font_upload_done, upload)) {
+		gltext_font_destroy_texture(font);
+		free(upload);
+		return false;
 	}
+	font->upload_queue = queue;
+	font->upload = upload;
+	return true;
 }
 
+#ifndef _WIN32
+struct font_texture_job {
+	gltext_font_t font;
+	void (*done)(gltext_font_t font, void *user_data);
+	void *user_data;
+};
+
+static void font_texture_job(void *arg)
+{
+	struct font_texture_job *job = (struct font_texture_job *)arg;
+	gltext_font_create_texture(job->font);
+}
+
+static void font_texture_done(void *arg)
+{
+	struct font_texture_job *job = (struct font_texture_job *)arg;
+	if (job->done)
+		job->done(job->font, job->user_data);
+	free(job);
+}
+
+bool gltext_font_create_texture_async(gltext_font_t font, struct glplatform_loader *loader,
+		void (*done)(gltext_font_t font, void *user_data), void *user_data)
+{
+	struct font_texture_job *job = (struct font_texture_job *)malloc(sizeof(struct font_texture_job));
+	if (!job)
+		return false;
+	job->font = font;
+	job->done = done;
+	job->user_data = user_data;
+	if (!glplatform_loader_submit(loader, font_texture_job, font_texture_done, job)) {
+		free(job);
+		return false;
+	}
+	return true;
+}
+#endif
+
 void gltext_font_destroy_texture(gltext_font_t font)
 {
+	if (font->upload) {
+		glplatform_upload_queue_cancel(font->upload_queue, font->atlas_texture);
+		free(font->upload);
+		font->upload_queue = NULL;
+		font->upload = NULL;
+	}
 	if (font->atlas_texture) {
 		glDeleteBuffers(1, &font->glyph_metric_texture_buffer);
 		glDeleteTextures(1, &font->glyph_metric_texture);
 		glDeleteTextures(1, &font->atlas_texture);
+		glplatform_count_sub(&glplatform_counters.atlas_bytes, atlas_size(font));
 		font->glyph_metric_texture_buffer = 0;
 		font->glyph_metric_texture = 0;
 		font->atlas_texture = 0;
@@ -475,6 +591,7 @@ gltext_font_t gltext_font_load(const char *path)
 	if (count != rd_len)
 		goto error2;
 	fclose(f);
+	glplatform_count(&glplatform_counters.fonts);
 	return font;
 error2:
 	free(font->atlas_buffer);
@@ -758,6 +875,7 @@ gltext_font_t gltext_font_create(const char32_t *charset,
 	free(bitmap_pitch);
 	f->glyph_metric_array = glyph_metric_array;
 	f->atlas_buffer = atlas_buffer;
+	glplatform_count(&glplatform_counters.fonts);
 
 	return f;
 error:
@@ -794,5 +912,6 @@ bool gltext_font_free(gltext_font_t font)
 	free(font->glyph_map);
 	free(font->glyphs);
 	free(font);
+	glplatform_count_sub(&glplatform_counters.fonts, 1);
 	return true;
 }
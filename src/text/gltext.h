@@ -111,12 +111,44 @@ bool gltext_font_store(gltext_font_t font, const char *path);
  *
  * Create a GL texture for the font. This can be done anytime after a font is created. Must be called
  * in a thread with a current OpenGL context. The GL_TEXTURE_2D_ARRAY and GL_TEXTURE_BUFFER bindings
- * are affected. The texture will be created automatically on the first render that specifies this font
- * if this call is not made.
+ * are affected. If this call is not made the texture is created on the first render that specifies this
+ * font, and the atlas uploaded through an upload queue of the context over the following swaps. Glyphs
+ * rendered before the upload completes may be missing.
  *
  */
 void gltext_font_create_texture(gltext_font_t font);
 
+struct glplatform_upload_queue;
+
+/*
+ *
+ * gltext_font_create_texture_queued()
+ *
+ * Create the font's GL texture and upload the glyph atlas through a glplatform upload queue (see
+ * glutil.h), spreading large atlases over several frames. 'done' is called from the swap that
+ * completes the upload. Glyphs rendered before then may be missing. Returns false if the font
+ * already has a texture or the upload could not be queued.
+ *
+ */
+bool gltext_font_create_texture_queued(gltext_font_t font, struct glplatform_upload_queue *queue,
+		void (*done)(gltext_font_t font, void *user_data), void *user_data);
+
+#ifndef _WIN32
+struct glplatform_loader;
+
+/*
+ *
+ * gltext_font_create_texture_async()
+ *
+ * Create the font's GL texture on a glplatform loader thread (see glutil.h). 'done' is called from
+ * glplatform_process_events() once the texture is ready. The font must not be rendered or have it's
+ * texture destroyed until then. Returns false if the job could not be queued.
+ *
+ */
+bool gltext_font_create_texture_async(gltext_font_t font, struct glplatform_loader *loader,
+		void (*done)(gltext_font_t font, void *user_data), void *user_data);
+#endif
+
 /*
  *
  * gltext_font_destroy_texture()
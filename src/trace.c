@@ -0,0 +1,146 @@
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "glplatform.h"
+#include "priv.h"
+#include "trace.h"
+
+#ifdef GLPLATFORM_TRACE
+
+#include <stdlib.h>
+#include <stdio.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+//
+// Each thread records spans into its own ring so recording takes no locks.
+// The owning thread is the only writer, it fills a span and then publishes it
+// by advancing 'head'. glplatform_trace_write() copies a ring and then
+// discards any spans the writer may have overwritten during the copy. Rings
+// are allocated the first time a thread records a span and are kept until
+// process exit.
+//
+#define SPANS_PER_THREAD 16384
+
+struct span {
+	const char *name;
+	uint64_t start;
+	uint64_t end;
+};
+
+struct trace_thread {
+	struct span spans[SPANS_PER_THREAD];
+	atomic_uint_fast64_t head;
+	int tid;
+	struct trace_thread *next;
+};
+
+static _Atomic(struct trace_thread *) g_threads;
+static atomic_int g_next_tid;
+static _Thread_local struct trace_thread *t_trace;
+
+uint64_t glplatform_trace_now()
+{
+#ifdef _WIN32
+	static LARGE_INTEGER freq;
+	LARGE_INTEGER count;
+	if (!freq.QuadPart)
+		QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&count);
+	return (uint64_t)(count.QuadPart * (1e9 / freq.QuadPart));
+#else
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000ull + ts.tv_nsec;
+#endif
+}
+
+static struct trace_thread *get_trace()
+{
+	if (!t_trace) {
+		struct trace_thread *thread = calloc(1, sizeof(struct trace_thread));
+		if (!thread)
+			return NULL;
+		thread->tid = atomic_fetch_add(&g_next_tid, 1) + 1;
+		thread->next = atomic_load(&g_threads);
+		while (!atomic_compare_exchange_weak(&g_threads, &thread->next, thread));
+		t_trace = thread;
+	}
+	return t_trace;
+}
+
+void glplatform_trace_span(const char *name, uint64_t start)
+{
+	uint64_t end = glplatform_trace_now();
+	struct trace_thread *thread = get_trace();
+	if (!thread)
+		return;
+	uint64_t head = atomic_load_explicit(&thread->head, memory_order_relaxed);
+	struct span *span = thread->spans + (head % SPANS_PER_THREAD);
+	span->name = name;
+	span->start = start;
+	span->end = end;
+	atomic_store_explicit(&thread->head, head + 1, memory_order_release);
+}
+
+static void write_thread(FILE *out, struct trace_thread *thread, struct span *copy, bool *first)
+{
+	uint64_t head = atomic_load_explicit(&thread->head, memory_order_acquire);
+	uint64_t begin = head > SPANS_PER_THREAD ? head - SPANS_PER_THREAD : 0;
+	uint64_t i;
+
+	for (i = begin; i < head; i++)
+		copy[i % SPANS_PER_THREAD] = thread->spans[i % SPANS_PER_THREAD];
+
+	//Spans written while copying may have replaced the oldest ones. The
+	//writer may also be filling the slot of 'new_head', which is the slot
+	//of 'new_head - SPANS_PER_THREAD', so that span is dropped as well.
+	atomic_thread_fence(memory_order_acquire);
+	uint64_t new_head = atomic_load_explicit(&thread->head, memory_order_relaxed);
+	if (new_head + 1 > SPANS_PER_THREAD && new_head + 1 - SPANS_PER_THREAD > begin)
+		begin = new_head + 1 - SPANS_PER_THREAD;
+
+	for (i = begin; i < head; i++) {
+		const struct span *span = copy + (i % SPANS_PER_THREAD);
+		fprintf(out, "%s\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+			*first ? "" : ",",
+			span->name,
+			thread->tid,
+			span->start / 1000.0,
+			(span->end - span->start) / 1000.0);
+		*first = false;
+	}
+}
+
+bool glplatform_trace_write(const char *path)
+{
+	struct trace_thread *thread;
+	bool first = true;
+	FILE *out = fopen(path, "w");
+	if (!out)
+		return false;
+	struct span *copy = malloc(sizeof(struct span) * SPANS_PER_THREAD);
+	if (!copy) {
+		fclose(out);
+		return false;
+	}
+	fprintf(out, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+	for (thread = atomic_load(&g_threads); thread; thread = thread->next)
+		write_thread(out, thread, copy, &first);
+	fprintf(out, "\n]}\n");
+	free(copy);
+	return !fclose(out);
+}
+
+#else
+
+bool glplatform_trace_write(const char *path)
+{
+	return false;
+}
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef GLPLATFORM_TRACE_H
+#define GLPLATFORM_TRACE_H
+
+#include <stdint.h>
+
+//
+// Timeline instrumentation of glplatform internals. A span is opened with
+// GLPLATFORM_TRACE_BEGIN(var), which declares 'var' to hold the start time,
+// and recorded by GLPLATFORM_TRACE_END(var, name) in the same scope. 'name'
+// must be a string literal. Unless glplatform is configured with
+// --enable-trace both macros expand to nothing.
+//
+#ifdef GLPLATFORM_TRACE
+
+uint64_t glplatform_trace_now();
+void glplatform_trace_span(const char *name, uint64_t start);
+
+#define GLPLATFORM_TRACE_BEGIN(var) uint64_t var = glplatform_trace_now()
+#define GLPLATFORM_TRACE_END(var, name) glplatform_trace_span(name, var)
+
+#else
+
+#define GLPLATFORM_TRACE_BEGIN(var)
+#define GLPLATFORM_TRACE_END(var, name)
+
+#endif
+
+#endif
@@ -2,6 +2,7 @@
 
 #include <wingdi.h>
 #include <windowsx.h>
+#include <string.h>
 
 #include "wgl.h"
 
@@ -17,6 +18,10 @@
 
 #include "priv.h"
 
+#ifndef WGL_CONTEXT_OPENGL_NO_ERROR_ARB
+#define WGL_CONTEXT_OPENGL_NO_ERROR_ARB 0x31b3
+#endif
+
 static LRESULT CALLBACK PlatformWndProc(HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam);
 
 static struct glplatform_win *g_win_list = NULL;
@@ -185,6 +190,18 @@ static LRESULT CALLBACK PlatformWndProc(HWND hWnd, UINT Msg, WPARAM wParam, LPAR
 	}
 }
 
+static void set_win_visibility(struct glplatform_win *win, bool mapped, bool obscured)
+{
+	bool was_visible = glplatform_win_is_visible(win);
+	win->mapped = mapped;
+	win->obscured = obscured;
+	bool visible = glplatform_win_is_visible(win);
+	if (visible != was_visible && win->callbacks.on_visibility_change) {
+		glplatform_count(&glplatform_counters.callbacks);
+		win->callbacks.on_visibility_change(win, visible);
+	}
+}
+
 static LRESULT CALLBACK windows_event(struct glplatform_win *win, HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam)
 {
 	RECT cr;
@@ -202,17 +219,28 @@ static LRESULT CALLBACK windows_event(struct glplatform_win *win, HWND hWnd, UIN
 		return DefWindowProc(hWnd, Msg, wParam, lParam);
 	} break;
 	case WM_PAINT: {
-		if (win->callbacks.on_expose)
+		if (win->callbacks.on_expose) {
+			glplatform_count(&glplatform_counters.callbacks);
 			win->callbacks.on_expose(win);
+		}
 		ValidateRect(hWnd, NULL);
 	} break;
+	case WM_SHOWWINDOW: {
+		set_win_visibility(win, wParam ? true : false, win->obscured);
+		return DefWindowProc(hWnd, Msg, wParam, lParam);
+	} break;
 	case WM_SIZE: {
 		int width = LOWORD(lParam);
 		int height = HIWORD(lParam);
+		set_win_visibility(win, win->mapped, wParam == SIZE_MINIMIZED);
+		if (wParam == SIZE_MINIMIZED)
+			break;
 		win->width = width;
 		win->height = height;
-		if (win->callbacks.on_resize)
+		if (win->callbacks.on_resize) {
+			glplatform_count(&glplatform_counters.callbacks);
 			win->callbacks.on_resize(win);
+		}
 	} break;
 	case WM_CREATE: {
 		int width = cr.right;
@@ -242,56 +270,74 @@ static LRESULT CALLBACK windows_event(struct glplatform_win *win, HWND hWnd, UIN
 	} break;
 	case WM_KEYDOWN: {
 		WPARAM key = wParam;
-		if (win->callbacks.on_key_down)
+		if (win->callbacks.on_key_down) {
+			glplatform_count(&glplatform_counters.callbacks);
 			win->callbacks.on_key_down(win, (int)key);
+		}
 	} break;
 	case WM_KEYUP: {
 		WPARAM key = wParam;
-		if (win->callbacks.on_key_up)
+		if (win->callbacks.on_key_up) {
+			glplatform_count(&glplatform_counters.callbacks);
 			win->callbacks.on_key_up(win, (int)key);
+		}
 	} break;
 	case WM_LBUTTONDOWN: {
 		int x = GET_X_LPARAM(lParam);
 		int y = GET_Y_LPARAM(lParam);
-		if (win->callbacks.on_mouse_button_down)
+		if (win->callbacks.on_mouse_button_down) {
+			glplatform_count(&glplatform_counters.callbacks);
 			win->callbacks.on_mouse_button_down(win, 0, x, y);
+		}
 	} break;
 	case WM_LBUTTONUP: {
 		int x = GET_X_LPARAM(lParam);
 		int y = GET_Y_LPARAM(lParam);
-		if (win->callbacks.on_mouse_button_up)
+		if (win->callbacks.on_mouse_button_up) {
+			glplatform_count(&glplatform_counters.callbacks);
 			win->callbacks.on_mouse_button_up(win, 0, x, y);
+		}
 	} break;
 	case WM_RBUTTONDOWN: {
 		int x = GET_X_LPARAM(lParam);
 		int y = GET_Y_LPARAM(lParam);
-		if (win->callbacks.on_mouse_button_down)
+		if (win->callbacks.on_mouse_button_down) {
+			glplatform_count(&glplatform_counters.callbacks);
 			win->callbacks.on_mouse_button_down(win, 2, x, y);
+		}
 	} break;
 	case WM_RBUTTONUP: {
 		int x = GET_X_LPARAM(lParam);
 		int y = GET_Y_LPARAM(lParam);
-		if (win->callbacks.on_mouse_button_up)
+		if (win->callbacks.on_mouse_button_up) {
+			glplatform_count(&glplatform_counters.callbacks);
 			win->callbacks.on_mouse_button_up(win, 2, x, y);
+		}
 	} break;
 	case WM_MOUSEMOVE: {
 		int x = GET_X_LPARAM(lParam);
 		int y = GET_Y_LPARAM(lParam);
 		int lbutton_down = wParam & MK_LBUTTON;
 		int rbutton_down = wParam & MK_RBUTTON;
-		if (win->callbacks.on_mouse_move)
+		if (win->callbacks.on_mouse_move) {
+			glplatform_count(&glplatform_counters.callbacks);
 			win->callbacks.on_mouse_move(win, x, y);
+		}
 	} break;
 	case WM_MOUSEWHEEL: {
 		int x = GET_X_LPARAM(lParam);
 		int y = GET_Y_LPARAM(lParam);
 		int delta = GET_WHEEL_DELTA_WPARAM(wParam);
-		if (win->callbacks.on_mouse_wheel)
+		if (win->callbacks.on_mouse_wheel) {
+			glplatform_count(&glplatform_counters.callbacks);
 			win->callbacks.on_mouse_wheel(win, x, y, delta / WHEEL_DELTA);
+		}
 	} break;
 	case WM_CLOSE: {
-		if (win->callbacks.on_destroy)
+		if (win->callbacks.on_destroy) {
+			glplatform_count(&glplatform_counters.callbacks);
 			win->callbacks.on_destroy(win);
+		}
 	} break;
 		/*
 		case WM_DESTROY:{
@@ -329,6 +375,12 @@ struct glplatform_win *glplatform_create_window(const char *title,
 	win->fbformat = *fbformat;
 	win->callbacks = *callbacks;
 	win->fullscreen = false;
+	win->mapped = false;
+	win->obscured = false;
+	win->visibility_policy = GLPLATFORM_VISIBILITY_RENDER;
+	win->low_latency = false;
+	win->swap_interval = 1;
+	win->frame_limiter = NULL;
 	win->show_cursor = true;
 	RECT wr = { 0, 0, width, height };
 	AdjustWindowRect(&wr, WS_OVERLAPPEDWINDOW, FALSE);
@@ -351,12 +403,59 @@ struct glplatform_win *glplatform_create_window(const char *title,
 	}
 	win->hwnd = hwnd;
 	register_glplatform_win(win);
-	if (win->callbacks.on_create)
+	if (win->callbacks.on_create) {
+		glplatform_count(&glplatform_counters.callbacks);
 		win->callbacks.on_create(win);
+	}
 
 	return win;
 }
 
+struct glplatform_win *glplatform_create_shm_window(const char *title,
+		const struct glplatform_win_callbacks *callbacks,
+		int width, int height)
+{
+	return NULL;
+}
+
+void *glplatform_shm_win_get_buffer(struct glplatform_win *win, int *width, int *height, int *stride)
+{
+	return NULL;
+}
+
+bool glplatform_shm_win_present(struct glplatform_win *win)
+{
+	return false;
+}
+
+struct glplatform_pixmap_texture *glplatform_create_pixmap_texture(intptr_t pixmap)
+{
+	return NULL;
+}
+
+struct glplatform_pixmap_texture *glplatform_create_window_texture(intptr_t xid)
+{
+	return NULL;
+}
+
+void glplatform_destroy_pixmap_texture(struct glplatform_pixmap_texture *ptex)
+{
+}
+
+bool glplatform_pixmap_texture_bind(struct glplatform_pixmap_texture *ptex)
+{
+	return false;
+}
+
+void glplatform_pixmap_texture_release(struct glplatform_pixmap_texture *ptex)
+{
+}
+
+int glplatform_pool_windows(const struct glplatform_fbformat *fbformat, int count)
+{
+	return 0;
+}
+
 //TODO
 //void glplatform_set_win_transient_for(struct glplatform_win *win, intptr_t id)
 
@@ -367,15 +466,112 @@ struct glplatform_win *glplatform_create_window(const char *title,
 void glplatform_make_current(struct glplatform_win *win, glplatform_gl_context_t ctx)
 {
 	struct glplatform_context *context = (struct glplatform_context*)ctx;
+	struct glplatform_context *prev = (struct glplatform_context *)TlsGetValue(g_context_tls);
 
+	glplatform_count(&glplatform_make_current_counters.calls);
+
+	//A context can only be current in one thread so the DC recorded
+	//in the context tells us if this call would change anything.
+	if (context && context == prev && context->hdc == win->hdc)
+		return;
+
+	glplatform_count(&glplatform_make_current_counters.switches);
+	if (prev)
+		prev->hdc = NULL;
 	TlsSetValue(g_context_tls, context);
-	if (context)
+	glplatform_gl_dispatch = context ? context->dispatch : NULL;
+	if (context) {
 		wglMakeCurrent(win->hdc, context->rc);
-	else
+		context->hdc = win->hdc;
+	} else {
 		wglMakeCurrent(win->hdc, 0);
+	}
+}
+
+static void invalidate_current_hdc()
+{
+	struct glplatform_context *context = glplatform_get_context_priv();
+	if (context)
+		context->hdc = NULL;
+}
+
+static bool wgl_has_extension(HDC hdc, const char *name)
+{
+	const char *extensions = wglGetExtensionsStringARB ? wglGetExtensionsStringARB(hdc) : NULL;
+	size_t len = strlen(name);
+	while (extensions && *extensions) {
+		const char *end = strchr(extensions, ' ');
+		size_t ext_len = end ? end - extensions : strlen(extensions);
+		if (ext_len == len && !strncmp(extensions, name, len))
+			return true;
+		if (!end)
+			break;
+		extensions = end + 1;
+	}
+	return false;
 }
 
 glplatform_gl_context_t glplatform_create_context(struct glplatform_win *win, int maj_ver, int min_ver)
+{
+	return glplatform_create_context_flags(win, maj_ver, min_ver, 0);
+}
+
+glplatform_gl_context_t glplatform_create_context_flags(struct glplatform_win *win, int maj_ver, int min_ver, uint32_t flags)
+{
+	struct glplatform_context_attribs attribs = {
+		.maj_ver = maj_ver,
+		.min_ver = min_ver,
+		.flags = flags
+	};
+	return glplatform_create_context_attribs(win, &attribs);
+}
+
+static void context_attrib_list(HDC hdc, int *attrib_list, int maj_ver, int min_ver, uint32_t *flags)
+{
+	int i = 0;
+	int context_flags = 0;
+
+	if (*flags & (GLPLATFORM_CONTEXT_DEBUG | GLPLATFORM_CONTEXT_ROBUST))
+		*flags &= ~GLPLATFORM_CONTEXT_NO_ERROR;
+	if ((*flags & GLPLATFORM_CONTEXT_NO_ERROR) && !wgl_has_extension(hdc, "WGL_ARB_create_context_no_error"))
+		*flags &= ~GLPLATFORM_CONTEXT_NO_ERROR;
+	if ((*flags & GLPLATFORM_CONTEXT_ROBUST) && !wgl_has_extension(hdc, "WGL_ARB_create_context_robustness"))
+		*flags &= ~GLPLATFORM_CONTEXT_ROBUST;
+	if ((*flags & GLPLATFORM_CONTEXT_RELEASE_NONE) && !wgl_has_extension(hdc, "WGL_ARB_context_flush_control"))
+		*flags &= ~GLPLATFORM_CONTEXT_RELEASE_NONE;
+
+	attrib_list[i++] = WGL_CONTEXT_MAJOR_VERSION_ARB;
+	attrib_list[i++] = maj_ver;
+	attrib_list[i++] = WGL_CONTEXT_MINOR_VERSION_ARB;
+	attrib_list[i++] = min_ver;
+	attrib_list[i++] = WGL_CONTEXT_PROFILE_MASK_ARB;
+	attrib_list[i++] = WGL_CONTEXT_CORE_PROFILE_BIT_ARB;
+
+	if (*flags & GLPLATFORM_CONTEXT_DEBUG)
+		context_flags |= WGL_CONTEXT_DEBUG_BIT_ARB;
+	if (*flags & GLPLATFORM_CONTEXT_FORWARD_COMPATIBLE)
+		context_flags |= WGL_CONTEXT_FORWARD_COMPATIBLE_BIT_ARB;
+	if (*flags & GLPLATFORM_CONTEXT_ROBUST) {
+		context_flags |= WGL_CONTEXT_ROBUST_ACCESS_BIT_ARB;
+		attrib_list[i++] = WGL_CONTEXT_RESET_NOTIFICATION_STRATEGY_ARB;
+		attrib_list[i++] = WGL_LOSE_CONTEXT_ON_RESET_ARB;
+	}
+	if (context_flags) {
+		attrib_list[i++] = WGL_CONTEXT_FLAGS_ARB;
+		attrib_list[i++] = context_flags;
+	}
+	if (*flags & GLPLATFORM_CONTEXT_NO_ERROR) {
+		attrib_list[i++] = WGL_CONTEXT_OPENGL_NO_ERROR_ARB;
+		attrib_list[i++] = TRUE;
+	}
+	if (*flags & GLPLATFORM_CONTEXT_RELEASE_NONE) {
+		attrib_list[i++] = WGL_CONTEXT_RELEASE_BEHAVIOR_ARB;
+		attrib_list[i++] = WGL_CONTEXT_RELEASE_BEHAVIOR_NONE_ARB;
+	}
+	attrib_list[i] = 0;
+}
+
+glplatform_gl_context_t glplatform_create_context_attribs(struct glplatform_win *win, const struct glplatform_context_attribs *attribs)
 {
 	HGLRC temp = wglCreateContext(win->hdc);
 	if (!temp)
@@ -394,23 +590,60 @@ glplatform_gl_context_t glplatform_create_context(struct glplatform_win *win, in
 		return 0;
 	}
 
-	int attribList[] = {
-		WGL_CONTEXT_MAJOR_VERSION_ARB, maj_ver,
-		WGL_CONTEXT_MINOR_VERSION_ARB, min_ver,
-		WGL_CONTEXT_PROFILE_MASK_ARB, WGL_CONTEXT_CORE_PROFILE_BIT_ARB,
-		0
-	};
+	int attribList[20];
+	uint32_t flags = attribs->flags;
+	context_attrib_list(win->hdc, attribList, attribs->maj_ver, attribs->min_ver, &flags);
 
 	HGLRC rc = wglCreateContextAttribsARB(win->hdc, 0, attribList);
+	if (!rc && (flags & (GLPLATFORM_CONTEXT_NO_ERROR | GLPLATFORM_CONTEXT_RELEASE_NONE))) {
+		flags &= ~(GLPLATFORM_CONTEXT_NO_ERROR | GLPLATFORM_CONTEXT_RELEASE_NONE);
+		context_attrib_list(win->hdc, attribList, attribs->maj_ver, attribs->min_ver, &flags);
+		rc = wglCreateContextAttribsARB(win->hdc, 0, attribList);
+	}
 
 	if (!rc)
 		return 0;
 	struct glplatform_context *context = calloc(1, sizeof(struct glplatform_context));
-	if (context)
+	if (context) {
 		context->rc = rc;
+		context->flags = flags;
+	}
 	return (glplatform_gl_context_t)context;
 }
 
+glplatform_gl_context_t glplatform_create_offscreen_context(const struct glplatform_context_attribs *attribs, glplatform_gl_context_t share)
+{
+	return 0;
+}
+
+void glplatform_destroy_context(glplatform_gl_context_t ctx)
+{
+	struct glplatform_context *context = (struct glplatform_context*)ctx;
+	if (!context)
+		return;
+	bool current = TlsGetValue(g_context_tls) == context;
+	glplatform_text_renderer_release(context->text_renderer, current);
+	glplatform_upload_queues_release(context, current);
+	glplatform_stream_buffers_release(context, current);
+	if (current) {
+		wglMakeCurrent(NULL, NULL);
+		TlsSetValue(g_context_tls, NULL);
+		glplatform_gl_dispatch = NULL;
+	}
+	wglDeleteContext(context->rc);
+	free(context->gl_state);
+	free(context->dispatch);
+	free(context->debug);
+	free(context->gpu_timer);
+	free(context);
+}
+
+uint32_t glplatform_get_context_flags(glplatform_gl_context_t ctx)
+{
+	struct glplatform_context *context = (struct glplatform_context*)ctx;
+	return context ? context->flags : 0;
+}
+
 void glplatform_fullscreen_win(struct glplatform_win *win, bool fullscreen)
 {
 	DWORD dwStyle = GetWindowLong(win->hwnd, GWL_STYLE);
@@ -434,6 +667,40 @@ void glplatform_fullscreen_win(struct glplatform_win *win, bool fullscreen)
 	win->fullscreen = fullscreen;
 }
 
+//
+// wglSwapIntervalEXT() applies to the window of the current context so
+// the interval can only be changed while the window is current.
+//
+static void set_swap_interval(struct glplatform_win *win, bool low_latency)
+{
+	int interval = 1;
+	if (!GLPLATFORM_WGL_EXT_swap_control || wglGetCurrentDC() != win->hdc)
+		return;
+	if (low_latency)
+		interval = wgl_has_extension(win->hdc, "WGL_EXT_swap_control_tear") ? -1 : 0;
+	if (wglSwapIntervalEXT(interval))
+		win->swap_interval = interval;
+}
+
+void glplatform_low_latency_fullscreen_win(struct glplatform_win *win, bool enable)
+{
+	win->low_latency = enable;
+	set_swap_interval(win, enable);
+	glplatform_fullscreen_win(win, enable);
+}
+
+bool glplatform_get_presentation_info(struct glplatform_win *win, struct glplatform_presentation_info *info)
+{
+	// DWM doesn't expose whether a window is presented without composition
+	info->fullscreen = win->fullscreen;
+	info->low_latency = win->low_latency;
+	info->compositor_running = false;
+	info->bypass_supported = false;
+	info->bypass_requested = false;
+	info->swap_interval = win->swap_interval;
+	return true;
+}
+
 int glplatform_get_events(bool block)
 {
 	if (block) {
@@ -459,17 +726,90 @@ bool glplatform_process_events()
 		TranslateMessage(&Msg);
 		DispatchMessage(&Msg);
 	}
+	glplatform_debug_process_messages();
 	return g_glplatform_win_count > 0;
 }
 
+//
+// Block for up to THROTTLE_TIMEOUT_MS or until there are window messages to
+// process. See the Linux implementation.
+//
+#define THROTTLE_TIMEOUT_MS 100
+
+static void throttle_hidden()
+{
+	MsgWaitForMultipleObjects(0, NULL, FALSE, THROTTLE_TIMEOUT_MS, QS_ALLINPUT);
+}
+
+static bool skip_swap(struct glplatform_win *win)
+{
+	return win->visibility_policy != GLPLATFORM_VISIBILITY_RENDER && !glplatform_win_is_visible(win);
+}
+
+bool glplatform_win_is_visible(struct glplatform_win *win)
+{
+	return win->mapped && !win->obscured;
+}
+
+void glplatform_set_visibility_policy(struct glplatform_win *win, enum glplatform_visibility_policy policy)
+{
+	win->visibility_policy = policy;
+}
+
 void glplatform_swap_buffers(struct glplatform_win *win)
 {
+	if (skip_swap(win)) {
+		if (win->visibility_policy == GLPLATFORM_VISIBILITY_THROTTLE)
+			throttle_hidden();
+		glplatform_end_frame();
+		return;
+	}
+	glplatform_count(&glplatform_counters.swaps);
 	SwapBuffers(win->hdc);
+	glplatform_end_frame();
+}
+
+int glplatform_swap_buffers_multi(struct glplatform_win **wins, int count, bool *missed)
+{
+	int i;
+	int n = 0;
+	int swap_count = 0;
+	bool throttle = false;
+	WGLSWAP swaps[WGL_SWAPMULTIPLE_MAX];
+
+	// wglSwapMultipleBuffers() takes at most WGL_SWAPMULTIPLE_MAX windows per call
+	for (i = 0; i < count; i++) {
+		if (skip_swap(wins[i])) {
+			throttle = throttle || wins[i]->visibility_policy == GLPLATFORM_VISIBILITY_THROTTLE;
+			continue;
+		}
+		swaps[n].hdc = wins[i]->hdc;
+		swaps[n].uiFlags = 0;
+		n++;
+		swap_count++;
+		glplatform_count(&glplatform_counters.swaps);
+		if (n == WGL_SWAPMULTIPLE_MAX) {
+			wglSwapMultipleBuffers(n, swaps);
+			n = 0;
+		}
+	}
+	if (n)
+		wglSwapMultipleBuffers(n, swaps);
+	if (!swap_count && throttle)
+		throttle_hidden();
+	if (missed) {
+		for (i = 0; i < count; i++)
+			missed[i] = false;
+	}
+	glplatform_end_frame();
+	return 0;
 }
 
 void glplatform_destroy_window(struct glplatform_win *win)
 {
+	glplatform_frame_limiter_free(win);
 	wglMakeCurrent(win->hdc, 0);
+	invalidate_current_hdc();
 	DestroyWindow(win->hwnd);
 	retire_glplatform_win(win);
 	free(win);
@@ -489,5 +829,6 @@ void glplatform_get_thread_state(struct glplatform_thread_state *state)
 
 void glplatform_set_thread_state(const struct glplatform_thread_state *state)
 {
+	invalidate_current_hdc();
 	wglMakeContextCurrentARB(state->draw_dc, state->read_dc, state->context);
 }